@@ -133,6 +133,16 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Limit the global cache of loaded LUT file contents (i.e. shared by all the configs).
+ *
+ * By default the cache is unbounded. The limits are a maximum number of files and an approximate
+ * memory budget in bytes (i.e. based on the size of the LUT files), where 0 means no limit. When a
+ * limit is exceeded, the least recently used files are evicted from the cache and will be read
+ * again on their next use.
+ */
+extern OCIOEXPORT void SetFileCacheLimits(size_t maxEntries, size_t maxMemorySize);
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -184,6 +194,24 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Get the maximum number of pixels of an image line the CPU processors process at once.
+ *
+ * Long lines are split in chunks so the intermediate buffers stay in the CPU cache between
+ * the conversion from the input buffer, the color processing and the conversion to the output
+ * buffer. The default value is 0 which means the chunk size is derived from the detected L2
+ * cache size.
+ */
+extern OCIOEXPORT long GetCPUProcessorChunkSize();
+/**
+ * \brief Set the maximum number of pixels of an image line the CPU processors process at once
+ * (i.e. a tile width), or 0 to derive it from the detected L2 cache size.
+ *
+ * \note
+ *     The value is read when a CPUProcessor::apply() call starts.
+ */
+extern OCIOEXPORT void SetCPUProcessorChunkSize(long numPixels);
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -248,6 +276,27 @@ extern OCIOEXPORT void ExtractOCIOZArchive(
     const char * destinationDir
 );
 
+/**
+ * \brief Identifies a display/view processor to build in advance (see
+ * \ref Config::warmUpProcessors).
+ */
+struct OCIOEXPORT DisplayViewProcessorDesc
+{
+    /// Name of the source color space.
+    std::string m_srcColorSpace;
+    /// Name of the display.
+    std::string m_display;
+    /// Name of the view.
+    std::string m_view;
+    /**
+     * When not empty, the looks replace the ones of the view as done by
+     * \ref LegacyViewingPipeline::setLooksOverride.
+     */
+    std::string m_looks;
+};
+
+typedef std::vector<DisplayViewProcessorDesc> DisplayViewProcessorDescVec;
+
 /**
  * \brief
  * A config defines all the color spaces to be available at runtime.
@@ -1242,6 +1291,21 @@ public:
      */
     const char * getColorSpaceFromFilepath(const char * filePath, size_t & ruleIndex) const;
 
+    /**
+     * \brief Get the color spaces of several file paths in one call.
+     *
+     * It's equivalent to calling getColorSpaceFromFilepath(filePath, ruleIndex) for each path
+     * but the paths are processed by several threads. It's useful for applications (e.g. an
+     * ingest service) classifying a large number of files.
+     *
+     * \param filePaths The file paths to classify.
+     * \param colorSpaces Receives the color space name of each file path.
+     * \param ruleIndices Receives the index of the rule matching each file path.
+     */
+    void getColorSpacesFromFilepaths(const std::vector<std::string> & filePaths,
+                                     std::vector<std::string> & colorSpaces,
+                                     std::vector<size_t> & ruleIndices) const;
+
     /**
      * \brief
      * 
@@ -1333,6 +1397,34 @@ public:
                                      const ConstTransformRcPtr & transform,
                                      TransformDirection direction) const;
 
+    /**
+     * \brief Build in advance some display/view processors, along with their default CPU and GPU
+     * processors, so that the subsequent requests are immediate (i.e. they are found in the
+     * processor caches).
+     *
+     * The processors are built by several threads and the call returns once they are all built.
+     * As it could take a while, an interactive application should call it from a worker thread
+     * (e.g. when loading the config) to not block the user interface.
+     *
+     * The processors without looks are the ones from getProcessor(context, srcColorSpaceName,
+     * display, view, TRANSFORM_DIR_FORWARD), and the ones with looks are the ones from a
+     * \ref LegacyViewingPipeline using the looks override. Note that the processor caches must
+     * be enabled (see setProcessorCacheFlags()).
+     *
+     * \param context The context the application will use to get the processors.
+     * \param processors The display/view processors to build.
+     * \param callback Optional function called after each processor, returning false cancels the
+     *        remaining processors.
+     * \return The number of built processors. The processors failing to build are skipped.
+     */
+    size_t warmUpProcessors(const ConstContextRcPtr & context,
+                            const DisplayViewProcessorDescVec & processors,
+                            const ProcessorWarmUpCallback & callback) const;
+    /// Same as above for all the active displays and views of the source color space.
+    size_t warmUpProcessors(const ConstContextRcPtr & context,
+                            const char * srcColorSpaceName,
+                            const ProcessorWarmUpCallback & callback) const;
+
     /**
      * \brief Get a Processor to or from a known external color space.
      * 
@@ -1466,6 +1558,16 @@ public:
     /// properties are being used by the processor.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) const noexcept;
 
+    /**
+     * \brief Limit this config's cache of Processor instances.
+     *
+     * By default the cache is unbounded. The limits are a maximum number of processors and an
+     * approximate memory budget in bytes (i.e. based on the sizes of the LUTs used by the
+     * processors), where 0 means no limit. When a limit is exceeded, the least recently used
+     * processors are evicted from the cache.
+     */
+    void setProcessorCacheLimits(size_t maxEntries, size_t maxMemorySize) const noexcept;
+
     /**
      * \brief Clears this config's cache of Processor, CPUProcessor, and GPUProcessor instances. 
      * 
@@ -2648,6 +2750,12 @@ public:
     /// True if at least one dynamic property of any type exists and is dynamic.
     bool isDynamic() const noexcept;
 
+    /**
+     * Max absolute error of the LUT values introduced by the compact storage of the 3D LUTs
+     * (refer to OPTIMIZATION_LUT_COMPACT_STORAGE), or 0 if no LUT is stored compactly.
+     */
+    float getCompactLutMaxError() const noexcept;
+
     /**
      * \brief Apply to an image with any kind of channel ordering while
      * respecting the input and output bit-depths.
@@ -2655,6 +2763,19 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Same as apply() but the image is split in bands of lines processed concurrently
+     * by an internal pool of threads. The result is identical to apply().
+     *
+     * \param numThreads Maximum number of threads used, including the calling thread. The
+     * default value of 0 means one thread per hardware thread. Small images are processed on
+     * the calling thread only.
+     */
+    void applyParallel(const ImageDesc & imgDesc, unsigned numThreads = 0) const;
+    void applyParallel(const ImageDesc & srcImgDesc,
+                       ImageDesc & dstImgDesc,
+                       unsigned numThreads = 0) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -2667,6 +2788,44 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * \brief Enable the collection of the per-step statistics (i.e. wall time, number of calls
+     * and of pixels) of the image apply methods for profiling purposes.
+     *
+     * The steps are the conversion of the input pixels to the internal packed RGBA F32 buffer
+     * (i.e. the packing), each op of the color transformation, and the conversion of the internal
+     * buffer to the output pixels (i.e. the unpacking).
+     *
+     * The statistics are disabled by default unless the env. variable OCIO_CPU_STATISTICS is set
+     * when the CPU processor is created. The processing has no additional cost when they are
+     * disabled. Note that the ops are then processed one after the other on complete chunks of
+     * pixels instead of being interleaved by small blocks, so the timings are representative of
+     * the ops but the total processing time could differ.
+     *
+     * \note The CPU processors are cached by their \ref Processor so all the callers requesting
+     * the same CPU processor share the same instance, and then its statistics setting and
+     * counters. Set the env. variable OCIO_DISABLE_PROCESSOR_CACHES to get distinct instances.
+     */
+    void setStatisticsEnabled(bool enabled) const;
+    bool isStatisticsEnabled() const noexcept;
+    /// Reset all the statistics to zero.
+    void resetStatistics() const noexcept;
+    /// Number of processing steps, the statistics of each step are then accessed by index.
+    int getNumStatistics() const noexcept;
+    /// Name of the step e.g. "<MatrixOffsetOp>" or "Pack from 8ui".
+    const char * getStatisticsName(int index) const;
+    /// Wall time in seconds, summed over all the calls and all the threads.
+    double getStatisticsSeconds(int index) const;
+    /// Number of calls to the step (i.e. number of processed chunks of pixels).
+    unsigned long long getStatisticsNumCalls(int index) const;
+    /// Number of processed pixels.
+    unsigned long long getStatisticsNumPixels(int index) const;
+    /**
+     * All the statistics formatted as a JSON array. The returned string is valid until the next
+     * call to the method.
+     */
+    const char * getStatisticsAsJSON() const;
+
     CPUProcessor(const CPUProcessor &) = delete;
     CPUProcessor& operator= (const CPUProcessor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -280,6 +280,13 @@ enum LoggingLevel
 /// Define Compute Hash function signature.
 using ComputeHashFunction = std::function<std::string(const std::string &)>;
 
+/**
+ * Define the progress function signature of the processor warm-up (see
+ * Config::warmUpProcessors). It's called after each processor with the number of processed ones
+ * and the total number, and returning false cancels the remaining ones.
+ */
+using ProcessorWarmUpCallback = std::function<bool(size_t numDone, size_t numTotal)>;
+
 /**
  * OCIO does not mandate the image state of the main reference space and it is not
  * required to be scene-referred.  This enum is used in connection with the display color space
@@ -619,8 +626,16 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
-    /// Apply all possible optimizations.
-    OPTIMIZATION_ALL                             = 0xFFFFFFFF,
+    /**
+     * For CPU processor, store the forward 3D LUTs with 16-bit RGB entries (normalized integers
+     * when all the LUT values are in [0, 1], half floats otherwise) to reduce their memory
+     * footprint.  It is less accurate, refer to CPUProcessor::getCompactLutMaxError().  Note
+     * that this flag is not part of OPTIMIZATION_ALL (and then of OPTIMIZATION_DRAFT).
+     */
+    OPTIMIZATION_LUT_COMPACT_STORAGE             = 0x20000000,
+
+    /// Apply all possible optimizations (except OPTIMIZATION_LUT_COMPACT_STORAGE).
+    OPTIMIZATION_ALL                             = 0xFFFFFFFF & ~OPTIMIZATION_LUT_COMPACT_STORAGE,
 
     // The following groupings of flags are provided as a convenient way to select an overall
     // optimization level.
@@ -775,6 +790,33 @@ extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_USER_CATEGORIES_ENVVAR;
 
+/**
+ * The envvar 'OCIO_CPU_STATISTICS' enables the collection of the per-op statistics of all the
+ * CPU processors (see \ref CPUProcessor::setStatisticsEnabled) when set to a value other than
+ * "0". Remove the variable or set the value to empty to not use it.
+ */
+extern OCIOEXPORT const char * OCIO_CPU_STATISTICS_ENVVAR;
+
+/**
+ * The envvar 'OCIO_PROCESSOR_CACHE_DIR' enables the persistent processor cache using the
+ * directory it holds (which must exist). The processors using LUT files, and their optimized CPU
+ * ops, are then saved in it so that other processes could create them without loading the LUT
+ * files nor optimizing the ops. An entry is automatically ignored when a file it uses changes
+ * (i.e. its size or modification time), and old entries are never removed. Remove the variable
+ * or set the value to empty to not use it.
+ */
+extern OCIOEXPORT const char * OCIO_PROCESSOR_CACHE_DIR_ENVVAR;
+
+/**
+ * The envvar 'OCIO_LAZY_CONFIG_LOADING' defers the loading of the color space transforms of the
+ * config files to their first use when set to a value other than "0". It speeds up the loading
+ * of large configs where only a few color spaces are used, but some errors in the color space
+ * transforms are then only reported when used (or by \ref Config::validate). Note that the
+ * parsed YAML content of the transforms is kept until they are loaded, so the memory used by the
+ * config is not reduced. Remove the variable or set the value to empty to not use it.
+ */
+extern OCIOEXPORT const char * OCIO_LAZY_CONFIG_LOADING_ENVVAR;
+
 // TODO: Move to .rst
 /*!rst::
 Roles
@@ -10,6 +10,8 @@
 
 #include <immintrin.h>
 
+#include <limits>
+
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
 
@@ -65,6 +67,80 @@ inline void avx2RGBATranspose_4x4_4x4(__m256 row0, __m256 row1, __m256 row2, __m
 
 }
 
+// Fast log2, exp2 & power functions matching the SSE2 versions from SSE.h (i.e. same argument
+// reduction and same Chebyshev polynomials, so approximately 15 bits of mantissa) but processing
+// eight values at once. Note that the constants are local to the functions so that no AVX2
+// instruction could be executed at library load time on a CPU not supporting it.
+
+inline __m256 avx2Log2(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+    const __m256i ebias = _mm256_set1_epi32(127);
+
+    // y = log2( x ) = log2( 2^exponent * mantissa )
+    //               = exponent + log2( mantissa )
+
+    const __m256 mantissa = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x),
+                                         _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-2.800364054395965731506));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+                           ebias);
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+    //               = zf * mexp
+
+    // Note that floor_x is wrong for NaNs and values outside the int range, but these cases
+    // are either propagated by the polynomial (i.e. NaN) or handled at the bottom.
+    const __m256 floor_f = _mm256_floor_ps(x);
+    const __m256i floor_x = _mm256_cvttps_epi32(floor_f);
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    const __m256 zf = _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(127)), 23));
+
+    const __m256 fraction = _mm256_sub_ps(x, floor_f);
+
+    __m256 mexp = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle underflow i.e. the result is smaller than the smallest normal float.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+
+    // Handle overflow i.e. the result is larger than the largest float.
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(128.0f), _CMP_GE_OQ));
+
+    return exp2;
+}
+
+// pow( x, exp ) = exp2( exp * log2( x ) ) where the results from base values smaller or equal
+// to zero (and NaNs) are mapped to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    const __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
 // Note Packing functions perform no 0.0 - 1.0 normalization
 // but perform 0 - max value clamping for integer formats
 template<BitDepth BD> struct AVX2RGBAPack {};
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX.h"
+#if OCIO_USE_AVX
+
+#include <immintrin.h>
+#include <tuple>
+
+#include "BitDepthUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+#if OCIO_USE_F16C
+
+// Note that the image channels do not matter here i.e. the values are converted as a flat stream
+// whose length is always a multiple of 4.
+
+void HalfToFloat(const void * inImg, void * outImg, long numPixels)
+{
+    const half * in = (const half *)inImg;
+    float * out = (float *)outImg;
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    // Process 16 values (i.e. 4 pixels) per iteration.
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m256i h = _mm256_loadu_si256((const __m256i *)(in + idx));
+
+        _mm256_storeu_ps(out + idx,     _mm256_cvtph_ps(_mm256_castsi256_si128(h)));
+        _mm256_storeu_ps(out + idx + 8, _mm256_cvtph_ps(_mm256_extractf128_si256(h, 1)));
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numValues; idx += 4)
+    {
+        const __m128i h = _mm_loadl_epi64((const __m128i *)(in + idx));
+        _mm_storeu_ps(out + idx, _mm_cvtph_ps(h));
+    }
+}
+
+void FloatToHalf(const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    half * out = (half *)outImg;
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    // Process 16 values (i.e. 4 pixels) per iteration.
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m128i h0 = _mm256_cvtps_ph(_mm256_loadu_ps(in + idx),     _MM_FROUND_TO_NEAREST_INT);
+        const __m128i h1 = _mm256_cvtps_ph(_mm256_loadu_ps(in + idx + 8), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm256_storeu_si256((__m256i *)(out + idx),
+                            _mm256_insertf128_si256(_mm256_castsi128_si256(h0), h1, 1));
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numValues; idx += 4)
+    {
+        const __m128i h = _mm_cvtps_ph(_mm_loadu_ps(in + idx), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64((__m128i *)(out + idx), h);
+    }
+}
+
+#endif // OCIO_USE_F16C
+
+} // anonymous namespace
+
+BitDepthCastApplyFunc * AVXGetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD)
+{
+#if OCIO_USE_F16C
+    if (CPUInfo::instance().hasF16C())
+    {
+        if (inBD == BIT_DEPTH_F16 && outBD == BIT_DEPTH_F32)
+        {
+            return HalfToFloat;
+        }
+        else if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F16)
+        {
+            return FloatToHalf;
+        }
+    }
+#else
+    std::ignore = inBD;
+    std::ignore = outBD;
+#endif
+
+    return nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX
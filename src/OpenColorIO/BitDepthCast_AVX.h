@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHCAST_AVX_H
+#define INCLUDED_OCIO_BITDEPTHCAST_AVX_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+typedef void (BitDepthCastApplyFunc)(const void *, void *, long);
+
+#if OCIO_USE_AVX
+namespace OCIO_NAMESPACE
+{
+
+// Return the half <-> float conversion (requiring the F16C instructions) if any, null otherwise.
+BitDepthCastApplyFunc * AVXGetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX
+
+#endif /* INCLUDED_OCIO_BITDEPTHCAST_AVX_H */
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+#include <string.h>
+
+#include "BitDepthUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the image channels do not matter here i.e. the values are converted as a flat stream
+// whose length is always a multiple of 4.
+
+void HalfToFloat(const void * inImg, void * outImg, long numPixels)
+{
+    const half * in = (const half *)inImg;
+    float * out = (float *)outImg;
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    // Process 32 values (i.e. 8 pixels) per iteration.
+    for (; idx + 32 <= numValues; idx += 32)
+    {
+        const __m256i h0 = _mm256_loadu_si256((const __m256i *)(in + idx));
+        const __m256i h1 = _mm256_loadu_si256((const __m256i *)(in + idx + 16));
+
+        _mm512_storeu_ps(out + idx,      _mm512_cvtph_ps(h0));
+        _mm512_storeu_ps(out + idx + 16, _mm512_cvtph_ps(h1));
+    }
+
+    // Handle the leftover pixels.
+    while (idx < numValues)
+    {
+        const long count = std::min(numValues - idx, 16L);
+        const __mmask16 mask = (__mmask16)((1u << count) - 1u);
+
+        uint16_t buf[16] = { 0 };
+        memcpy(buf, in + idx, count * sizeof(half));
+
+        const __m256i h = _mm256_loadu_si256((const __m256i *)buf);
+        _mm512_mask_storeu_ps(out + idx, mask, _mm512_cvtph_ps(h));
+
+        idx += count;
+    }
+}
+
+void FloatToHalf(const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    half * out = (half *)outImg;
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    // Process 32 values (i.e. 8 pixels) per iteration.
+    for (; idx + 32 <= numValues; idx += 32)
+    {
+        const __m256i h0 = _mm512_cvtps_ph(_mm512_loadu_ps(in + idx),      _MM_FROUND_TO_NEAREST_INT);
+        const __m256i h1 = _mm512_cvtps_ph(_mm512_loadu_ps(in + idx + 16), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm256_storeu_si256((__m256i *)(out + idx),      h0);
+        _mm256_storeu_si256((__m256i *)(out + idx + 16), h1);
+    }
+
+    // Handle the leftover pixels.
+    while (idx < numValues)
+    {
+        const long count = std::min(numValues - idx, 16L);
+        const __mmask16 mask = (__mmask16)((1u << count) - 1u);
+
+        const __m512 v = _mm512_maskz_loadu_ps(mask, in + idx);
+
+        half buf[16];
+        _mm256_storeu_si256((__m256i *)buf, _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+        memcpy(out + idx, buf, count * sizeof(half));
+
+        idx += count;
+    }
+}
+
+} // anonymous namespace
+
+BitDepthCastApplyFunc * AVX512GetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD)
+{
+    if (inBD == BIT_DEPTH_F16 && outBD == BIT_DEPTH_F32)
+    {
+        return HalfToFloat;
+    }
+    else if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F16)
+    {
+        return FloatToHalf;
+    }
+
+    return nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
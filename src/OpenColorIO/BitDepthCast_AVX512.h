@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHCAST_AVX512_H
+#define INCLUDED_OCIO_BITDEPTHCAST_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+typedef void (BitDepthCastApplyFunc)(const void *, void *, long);
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Return the half <-> float conversion if any, null otherwise.
+BitDepthCastApplyFunc * AVX512GetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_BITDEPTHCAST_AVX512_H */
@@ -17,6 +17,9 @@ typedef __int64  int64_t;
 namespace OCIO_NAMESPACE
 {
 
+// Most of the processors have at least 256KB of L2 cache per core.
+static constexpr unsigned int DEFAULT_L2_CACHE_SIZE = 256 * 1024;
+
 #if !defined(__aarch64__) && OCIO_ARCH_X86 // Intel-based processor or Apple Rosetta x86_64.
 
 namespace {
@@ -72,6 +75,7 @@ static inline void cpuid(int index, int *data)
 CPUInfo::CPUInfo()
 {
     flags = 0, family = 0, model = 0;
+    l2CacheSize = DEFAULT_L2_CACHE_SIZE;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
@@ -156,6 +160,17 @@ CPUInfo::CPUInfo()
         }
     }
 
+    if (max_ext_level >= 0x80000006)
+    {
+        // L2 cache size in KB, reported the same way by Intel and AMD processors.
+        cpuid(0x80000006, info.i);
+        const uint32_t l2CacheSizeKB = info.reg.ecx >> 16;
+        if (l2CacheSizeKB > 0)
+        {
+            l2CacheSize = l2CacheSizeKB * 1024;
+        }
+    }
+
     if (!strncmp(vendor, "GenuineIntel", 12))
     {
         if (family == 6 && (model == 9 || model == 13 || model == 14))
@@ -188,6 +203,7 @@ CPUInfo::CPUInfo()
 CPUInfo::CPUInfo()
 {
     flags = 0;
+    l2CacheSize = DEFAULT_L2_CACHE_SIZE;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
@@ -215,6 +231,7 @@ CPUInfo::CPUInfo()
 CPUInfo::CPUInfo() // Unknown Processor
 {
     flags = 0;
+    l2CacheSize = DEFAULT_L2_CACHE_SIZE;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
     snprintf(name, sizeof(name), "%s", "Unknown");
@@ -44,6 +44,9 @@ struct CPUInfo
     char name[65];
     char vendor[13];
 
+    // Size in bytes of the L2 cache of one core (or a conservative default when unknown).
+    unsigned int l2CacheSize;
+
     CPUInfo();
 
     static CPUInfo& instance();
@@ -73,6 +76,8 @@ struct CPUInfo
 
     bool hasF16C() const { return x86_check_flags(F16C); }
 
+    unsigned int getL2CacheSize() const { return l2CacheSize; }
+
 };
 
 #undef x86_check_flags
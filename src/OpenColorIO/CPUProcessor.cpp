@@ -1,22 +1,55 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <memory>
 #include <string.h>
+#include <tuple>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthCast_AVX.h"
+#include "BitDepthCast_AVX512.h"
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "CPUProcessor.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
 #include "ScanlineHelper.h"
+#include "ThreadPool.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+// Get the fastest conversion function supported by the CPU, if any.
+BitDepthCastApplyFunc * GetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD)
+{
+    BitDepthCastApplyFunc * applyFunc = nullptr;
+
+    std::ignore = inBD;
+    std::ignore = outBD;
+
+#if OCIO_USE_AVX
+    if (CPUInfo::instance().hasAVX())
+    {
+        applyFunc = AVXGetBitDepthCastApplyFunc(inBD, outBD);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetBitDepthCastApplyFunc(inBD, outBD);
+    }
+#endif
+
+    return applyFunc;
+}
+
 template<BitDepth inBD, BitDepth outBD>
 class BitDepthCast : public OpCPU
 {
@@ -24,11 +57,20 @@ class BitDepthCast : public OpCPU
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
 public:
-    BitDepthCast() = default;
+    BitDepthCast()
+        : m_applyFunc(GetBitDepthCastApplyFunc(inBD, outBD))
+    {
+    }
     ~BitDepthCast() override {};
 
     void apply(const void * inImg, void * outImg, long numPixels) const override
     {
+        if (m_applyFunc)
+        {
+            m_applyFunc(inImg, outImg, numPixels);
+            return;
+        }
+
         const InType * in = reinterpret_cast<const InType*>(inImg);
         OutType * out = reinterpret_cast<OutType*>(outImg);
 
@@ -47,6 +89,9 @@ public:
 protected:
     const float m_scale = float(BitDepthInfo<outBD>::maxValue)
                             / float(BitDepthInfo<inBD>::maxValue);
+
+    // Only the half <-> float conversions have a SIMD implementation.
+    BitDepthCastApplyFunc * m_applyFunc = nullptr;
 };
 
 template<>
@@ -63,6 +108,21 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    bool hasPlanarApply() const override { return true; }
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override
+    {
+        for(int c=0; c<4; ++c)
+        {
+            if(inPlanes[c]!=outPlanes[c])
+            {
+                memcpy(outPlanes[c], inPlanes[c], numPixels*sizeof(float));
+            }
+        }
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -119,6 +179,299 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+// Number of pixels processed by all the ops of a FusedOpCPU before moving to the next ones
+// i.e. 2KB of packed RGBA F32 pixels which stay in the L1 cache across all the ops.
+constexpr long FUSED_OPS_BLOCK_SIZE = 128;
+
+// Apply a chain of CPU ops by blocks of pixels instead of running each op over the complete
+// buffer before running the next one. A long scanline then goes through the memory hierarchy
+// only once instead of once per op. The result is identical as each pixel still goes through
+// the same ops in the same order.
+class FusedOpCPU : public OpCPU
+{
+public:
+    FusedOpCPU() = delete;
+    FusedOpCPU(const FusedOpCPU &) = delete;
+    explicit FusedOpCPU(const ConstOpCPURcPtrVec & ops);
+    ~FusedOpCPU() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override;
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+    bool isDynamic() const override;
+    bool hasDynamicProperty(DynamicPropertyType type) const override;
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
+
+private:
+    const ConstOpCPURcPtrVec m_ops;
+};
+
+FusedOpCPU::FusedOpCPU(const ConstOpCPURcPtrVec & ops)
+    :   OpCPU()
+    ,   m_ops(ops)
+{
+}
+
+void FusedOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const size_t numOps = m_ops.size();
+
+    for (long idx = 0; idx < numPixels; idx += FUSED_OPS_BLOCK_SIZE)
+    {
+        const long numBlockPixels = std::min(FUSED_OPS_BLOCK_SIZE, numPixels - idx);
+
+        m_ops[0]->apply(in, out, numBlockPixels);
+        for (size_t i = 1; i < numOps; ++i)
+        {
+            m_ops[i]->apply(out, out, numBlockPixels);
+        }
+
+        in  += 4 * numBlockPixels;
+        out += 4 * numBlockPixels;
+    }
+}
+
+bool FusedOpCPU::hasPlanarApply() const
+{
+    // The ops without a planar apply process a packed copy of each block of pixels (refer to
+    // applyPlanar()) so a single planar op is enough to avoid packing the complete lines.
+    for (const auto & op : m_ops)
+    {
+        if (op->hasPlanarApply())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+namespace
+{
+
+void PackPlanes(const float * const * planes, float * rgba, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        rgba[0] = planes[0][idx];
+        rgba[1] = planes[1][idx];
+        rgba[2] = planes[2][idx];
+        rgba[3] = planes[3][idx];
+        rgba += 4;
+    }
+}
+
+void UnpackPlanes(const float * rgba, float * const * planes, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        planes[0][idx] = rgba[0];
+        planes[1][idx] = rgba[1];
+        planes[2][idx] = rgba[2];
+        planes[3][idx] = rgba[3];
+        rgba += 4;
+    }
+}
+
+} // anon.
+
+void FusedOpCPU::applyPlanar(const float * const * inPlanes,
+                             float * const * outPlanes,
+                             long numPixels) const
+{
+    const size_t numOps = m_ops.size();
+
+    float rgba[4 * FUSED_OPS_BLOCK_SIZE];
+
+    for (long idx = 0; idx < numPixels; idx += FUSED_OPS_BLOCK_SIZE)
+    {
+        const long numBlockPixels = std::min(FUSED_OPS_BLOCK_SIZE, numPixels - idx);
+
+        const float * in[4]{ inPlanes[0] + idx, inPlanes[1] + idx,
+                             inPlanes[2] + idx, inPlanes[3] + idx };
+        float * out[4]{ outPlanes[0] + idx, outPlanes[1] + idx,
+                        outPlanes[2] + idx, outPlanes[3] + idx };
+
+        for (size_t i = 0; i < numOps; ++i)
+        {
+            const float * const * src = (i == 0) ? in : out;
+
+            if (m_ops[i]->hasPlanarApply())
+            {
+                m_ops[i]->applyPlanar(src, out, numBlockPixels);
+                continue;
+            }
+
+            // Process the consecutive ops without a planar apply on a packed copy of the
+            // block, which stays in the L1 cache.
+            PackPlanes(src, rgba, numBlockPixels);
+            for (; i < numOps && !m_ops[i]->hasPlanarApply(); ++i)
+            {
+                m_ops[i]->apply(rgba, rgba, numBlockPixels);
+            }
+            UnpackPlanes(rgba, out, numBlockPixels);
+            --i;
+        }
+    }
+}
+
+bool FusedOpCPU::isDynamic() const
+{
+    for (const auto & op : m_ops)
+    {
+        if (op->isDynamic())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FusedOpCPU::hasDynamicProperty(DynamicPropertyType type) const
+{
+    for (const auto & op : m_ops)
+    {
+        if (op->hasDynamicProperty(type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+DynamicPropertyRcPtr FusedOpCPU::getDynamicProperty(DynamicPropertyType type) const
+{
+    for (const auto & op : m_ops)
+    {
+        if (op->hasDynamicProperty(type))
+        {
+            return op->getDynamicProperty(type);
+        }
+    }
+
+    throw Exception("Cannot find dynamic property; not used by CPU processor.");
+}
+
+// Replace a chain of several CPU ops by a single op processing them by blocks of pixels.
+void FuseCPUOps(ConstOpCPURcPtrVec & cpuOps)
+{
+    if (cpuOps.size() > 1)
+    {
+        ConstOpCPURcPtr fusedOp = std::make_shared<FusedOpCPU>(cpuOps);
+
+        cpuOps.clear();
+        cpuOps.push_back(fusedOp);
+    }
+}
+
+// Record the statistics of a CPU op.
+class TimedOpCPU : public OpCPU
+{
+public:
+    TimedOpCPU() = delete;
+    TimedOpCPU(const TimedOpCPU &) = delete;
+    TimedOpCPU(const ConstOpCPURcPtr & op, const CPUStatisticsCountersRcPtr & statistics)
+        :   OpCPU()
+        ,   m_op(op)
+        ,   m_statistics(statistics)
+    {
+    }
+    ~TimedOpCPU() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_op->apply(inImg, outImg, numPixels);
+        m_statistics->add(std::chrono::steady_clock::now() - start, numPixels);
+    }
+
+    bool hasPlanarApply() const override { return m_op->hasPlanarApply(); }
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_op->applyPlanar(inPlanes, outPlanes, numPixels);
+        m_statistics->add(std::chrono::steady_clock::now() - start, numPixels);
+    }
+
+    bool isDynamic() const override { return m_op->isDynamic(); }
+    bool hasDynamicProperty(DynamicPropertyType type) const override
+    {
+        return m_op->hasDynamicProperty(type);
+    }
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override
+    {
+        return m_op->getDynamicProperty(type);
+    }
+
+private:
+    const ConstOpCPURcPtr m_op;
+    const CPUStatisticsCountersRcPtr m_statistics;
+};
+
+// Record the statistics of the packing & unpacking steps of a scanline helper.
+class TimedScanlineHelper : public ScanlineHelper
+{
+public:
+    TimedScanlineHelper() = delete;
+    TimedScanlineHelper(ScanlineHelper * helper,
+                        const CPUStatisticsCountersRcPtr & packStatistics,
+                        const CPUStatisticsCountersRcPtr & unpackStatistics)
+        :   ScanlineHelper()
+        ,   m_helper(helper)
+        ,   m_packStatistics(packStatistics)
+        ,   m_unpackStatistics(unpackStatistics)
+    {
+    }
+
+    void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override
+    {
+        m_helper->init(srcImg, dstImg);
+    }
+
+    void init(const ImageDesc & img) override { m_helper->init(img); }
+
+    void setLineRange(long yBegin, long yEnd) override { m_helper->setLineRange(yBegin, yEnd); }
+
+    void prepRGBAScanline(float** buffer, long & numPixels) override
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_helper->prepRGBAScanline(buffer, numPixels);
+
+        if (numPixels > 0)
+        {
+            m_numPixels = numPixels;
+            m_packStatistics->add(std::chrono::steady_clock::now() - start, numPixels);
+        }
+    }
+
+    void finishRGBAScanline() override
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_helper->finishRGBAScanline();
+        m_unpackStatistics->add(std::chrono::steady_clock::now() - start, m_numPixels);
+    }
+
+private:
+    const std::unique_ptr<ScanlineHelper> m_helper;
+    const CPUStatisticsCountersRcPtr m_packStatistics;
+    const CPUStatisticsCountersRcPtr m_unpackStatistics;
+
+    // The number of pixels of the current chunk.
+    long m_numPixels = 0;
+};
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -128,10 +481,32 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // The names of the remaining CPU Ops.
+                     std::vector<std::string> & cpuOpNames,
+                     // The max error of the 3D LUTs stored compactly.
+                     float & compactLutMaxError)
 {
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
+    const bool lutCompactStorage = HasFlag(oFlags, OPTIMIZATION_LUT_COMPACT_STORAGE);
+
+    compactLutMaxError = 0.f;
+
+    auto getCPUOp = [fastLogExpPow, lutCompactStorage, &compactLutMaxError](const ConstOpRcPtr & op)
+    {
+        ConstOpDataRcPtr opData = op->data();
+        if (lutCompactStorage && opData->getType() == OpData::Lut3DType)
+        {
+            ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(opData);
+            float maxError = 0.f;
+            ConstOpCPURcPtr renderer = GetLut3DRenderer(lut, true, maxError);
+            compactLutMaxError = std::max(compactLutMaxError, maxError);
+            return renderer;
+        }
+        return op->getCPUOp(fastLogExpPow);
+    };
+
     for(size_t idx=0; idx<maxOps; ++idx)
     {
         ConstOpRcPtr op = ops[idx];
@@ -146,12 +521,13 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inBitDepthOp = getCPUOp(op);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp(op));
+                cpuOpNames.push_back(op->getInfo());
             }
 
             if(maxOps==1)
@@ -168,17 +544,42 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outBitDepthOp = getCPUOp(op);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp(op));
+                cpuOpNames.push_back(op->getInfo());
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            cpuOps.push_back(getCPUOp(op));
+            cpuOpNames.push_back(op->getInfo());
+        }
+    }
+}
+
+// Planar F32 images could be processed without packing complete lines if all the CPU Ops
+// support it. Note that a fused op supports it as soon as one of its ops does.
+void CreatePlanarOps(BitDepth in, BitDepth out, CPUEngine & engine)
+{
+    engine.m_planarOps.clear();
+    if (in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32)
+    {
+        ConstOpCPURcPtrVec planarOps;
+        planarOps.push_back(engine.m_inBitDepthOp);
+        planarOps.insert(planarOps.end(), engine.m_cpuOps.begin(), engine.m_cpuOps.end());
+        planarOps.push_back(engine.m_outBitDepthOp);
+
+        const bool hasPlanarApply
+            = std::all_of(planarOps.begin(), planarOps.end(),
+                          [](const ConstOpCPURcPtr & op) { return op->hasPlanarApply(); });
+
+        if (hasPlanarApply)
+        {
+            engine.m_planarOps = planarOps;
         }
     }
 }
@@ -239,14 +640,36 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+ScanlineHelper * CreateScanlineHelper(BitDepth in, BitDepth out, const CPUEngine & engine)
+{
+    ScanlineHelper * helper = CreateScanlineHelper(in, engine.m_inBitDepthOp,
+                                                   out, engine.m_outBitDepthOp);
+
+    if (engine.m_packStatistics)
+    {
+        helper = new TimedScanlineHelper(helper,
+                                         engine.m_packStatistics,
+                                         engine.m_unpackStatistics);
+    }
+
+    return helper;
+}
+
+void CPUStatisticsCounters::reset() noexcept
+{
+    m_nanoseconds = 0;
+    m_numCalls    = 0;
+    m_numPixels   = 0;
+}
+
 bool CPUProcessor::Impl::isDynamic() const noexcept
 {
-    if (m_inBitDepthOp->isDynamic())
+    if (m_engine.m_inBitDepthOp->isDynamic())
     {
         return true;
     }
 
-    for (const auto & op : m_cpuOps)
+    for (const auto & op : m_engine.m_cpuOps)
     {
         if (op->isDynamic())
         {
@@ -254,7 +677,7 @@ bool CPUProcessor::Impl::isDynamic() const noexcept
         }
     }
 
-    if (m_outBitDepthOp->isDynamic())
+    if (m_engine.m_outBitDepthOp->isDynamic())
     {
         return true;
     }
@@ -264,12 +687,12 @@ bool CPUProcessor::Impl::isDynamic() const noexcept
 
 bool CPUProcessor::Impl::hasDynamicProperty(DynamicPropertyType type) const noexcept
 {
-    if (m_inBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_inBitDepthOp->hasDynamicProperty(type))
     {
         return true;
     }
 
-    for (const auto & op : m_cpuOps)
+    for (const auto & op : m_engine.m_cpuOps)
     {
         if (op->hasDynamicProperty(type))
         {
@@ -277,7 +700,7 @@ bool CPUProcessor::Impl::hasDynamicProperty(DynamicPropertyType type) const noex
         }
     }
 
-    if (m_outBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_outBitDepthOp->hasDynamicProperty(type))
     {
         return true;
     }
@@ -287,12 +710,12 @@ bool CPUProcessor::Impl::hasDynamicProperty(DynamicPropertyType type) const noex
 
 DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType type) const
 {
-    if (m_inBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_inBitDepthOp->hasDynamicProperty(type))
     {
-        return m_inBitDepthOp->getDynamicProperty(type);
+        return m_engine.m_inBitDepthOp->getDynamicProperty(type);
     }
 
-    for (const auto & op : m_cpuOps)
+    for (const auto & op : m_engine.m_cpuOps)
     {
         if (op->hasDynamicProperty(type))
         {
@@ -300,9 +723,9 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
         }
     }
 
-    if (m_outBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_outBitDepthOp->hasDynamicProperty(type))
     {
-        return m_outBitDepthOp->getDynamicProperty(type);
+        return m_engine.m_outBitDepthOp->getDynamicProperty(type);
     }
 
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
@@ -342,13 +765,20 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
                                   OptimizationFlags oFlags)
 {
-    AutoMutex lock(m_mutex);
-
     // Get the ops of the color transformation without the bit-depth adjustments.
 
     OpRcPtrVec ops;
     FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
 
+    finalizeOptimizedOps(ops, in, out, oFlags);
+}
+
+void CPUProcessor::Impl::finalizeOptimizedOps(const OpRcPtrVec & ops,
+                                              BitDepth in, BitDepth out,
+                                              OptimizationFlags oFlags)
+{
+    AutoMutex lock(m_mutex);
+
     m_inBitDepth  = in;
     m_outBitDepth = out;
 
@@ -360,10 +790,43 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
 
     // Get the CPU Ops while taking care of the input and output bit-depths.
 
-    m_cpuOps.clear();
-    m_inBitDepthOp = nullptr;
-    m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    m_engine = CPUEngine();
+
+    ConstOpCPURcPtrVec cpuOps;
+    std::vector<std::string> cpuOpNames;
+    CreateCPUEngine(ops, in, out, oFlags,
+                    m_engine.m_inBitDepthOp, cpuOps, m_engine.m_outBitDepthOp, cpuOpNames,
+                    m_compactLutMaxError);
+
+    m_engine.m_cpuOps = cpuOps;
+    FuseCPUOps(m_engine.m_cpuOps);
+
+    CreatePlanarOps(in, out, m_engine);
+
+    // The statistics of all the steps. Note that the input & output bit-depth ops are part of
+    // the packing & unpacking steps.
+
+    m_unfusedCpuOps = cpuOps;
+
+    m_statistics.clear();
+    m_statistics.push_back(
+        std::make_shared<CPUStatisticsCounters>(std::string("Pack from ") + BitDepthToString(in)));
+    for (const auto & name : cpuOpNames)
+    {
+        m_statistics.push_back(std::make_shared<CPUStatisticsCounters>(name));
+    }
+    m_statistics.push_back(
+        std::make_shared<CPUStatisticsCounters>(std::string("Unpack to ") + BitDepthToString(out)));
+
+    m_statisticsEnabled = false;
+    {
+        AutoMutex guard(m_timedEngineMutex);
+        m_timedEngine    = CPUEngine();
+        m_hasTimedEngine = false;
+    }
+
+    const std::string statisticsEnv = GetEnvVariable(OCIO_CPU_STATISTICS_ENVVAR);
+    setStatisticsEnabled(!statisticsEnv.empty() && statisticsEnv != "0");
 
     // Compute the cache id.
 
@@ -376,75 +839,274 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
-
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+namespace
+{
 
+// Process all the lines selected by the scanline helper.
+void ProcessScanlines(ScanlineHelper & scanlineBuilder, const ConstOpCPURcPtrVec & cpuOps)
+{
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
+        const size_t numOps = cpuOps.size();
         for(size_t i = 0; i<numOps; ++i)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+        }
+
+        scanlineBuilder.finishRGBAScanline();
+    }
+}
+
+// Is the image made of separate 32-bit float planes which could be directly processed?
+bool IsPlanarFloatImage(const ImageDesc & img)
+{
+    return dynamic_cast<const PlanarImageDesc *>(&img)
+        && img.getBitDepth() == BIT_DEPTH_F32
+        && img.getXStrideBytes() == sizeof(float);
+}
+
+float * GetPlanarLine(void * plane, ptrdiff_t yStrideBytes, long y)
+{
+    return reinterpret_cast<float *>(reinterpret_cast<char *>(plane) + yStrideBytes * y);
+}
+
+// Process the lines [yBegin, yEnd) of planar F32 images without packing the pixels i.e. the
+// ops directly process the R, G, B & A planes.
+void ProcessPlanarLines(const ImageDesc & srcImg, const ImageDesc & dstImg,
+                        long yBegin, long yEnd,
+                        const ConstOpCPURcPtrVec & planarOps)
+{
+    const long width = dstImg.getWidth();
+    const long chunkSize = GetChunkSize(width);
+
+    // A missing alpha plane is read as zeros, and written to a scratch buffer.
+    const std::vector<float> srcAlpha(srcImg.getAData() ? 0 : chunkSize, 0.0f);
+    std::vector<float> dstAlpha(dstImg.getAData() ? 0 : chunkSize);
+
+    void * srcPlanes[4]{ srcImg.getRData(), srcImg.getGData(),
+                         srcImg.getBData(), srcImg.getAData() };
+    void * dstPlanes[4]{ dstImg.getRData(), dstImg.getGData(),
+                         dstImg.getBData(), dstImg.getAData() };
+
+    const ptrdiff_t srcYStrideBytes = srcImg.getYStrideBytes();
+    const ptrdiff_t dstYStrideBytes = dstImg.getYStrideBytes();
+
+    for (long y = yBegin; y < yEnd; ++y)
+    {
+        for (long x = 0; x < width; x += chunkSize)
+        {
+            const long numPixels = std::min(chunkSize, width - x);
+
+            const float * in[4];
+            float * out[4];
+
+            for (int c = 0; c < 3; ++c)
+            {
+                in[c]  = GetPlanarLine(srcPlanes[c], srcYStrideBytes, y) + x;
+                out[c] = GetPlanarLine(dstPlanes[c], dstYStrideBytes, y) + x;
+            }
+
+            in[3]  = srcPlanes[3] ? GetPlanarLine(srcPlanes[3], srcYStrideBytes, y) + x
+                                  : srcAlpha.data();
+            out[3] = dstPlanes[3] ? GetPlanarLine(dstPlanes[3], dstYStrideBytes, y) + x
+                                  : dstAlpha.data();
+
+            planarOps[0]->applyPlanar(in, out, numPixels);
+            for (size_t i = 1; i < planarOps.size(); ++i)
+            {
+                planarOps[i]->applyPlanar(out, out, numPixels);
+            }
         }
+    }
+}
+
+// Minimum number of pixels of a band of lines to amortize the cost of its scheduling.
+constexpr long MIN_PIXELS_PER_BAND = 16 * 1024;
+
+// Number of bands per thread. Having several bands per thread balances the load when some
+// areas of the image are slower to process than others.
+constexpr long BANDS_PER_THREAD = 4;
 
-        scanlineBuilder->finishRGBAScanline();
+long GetLinesPerBand(long width, long height, unsigned numThreads)
+{
+    const long minLines = std::max(1L, MIN_PIXELS_PER_BAND / std::max(1L, width));
+    const long lines = height / (long(numThreads) * BANDS_PER_THREAD);
+
+    return std::max(minLines, lines);
+}
+
+unsigned GetMaxThreads(const ThreadPool & pool, unsigned numThreads)
+{
+    return numThreads == 0 ? pool.getNumThreads() : std::min(numThreads, pool.getNumThreads());
+}
+
+} // anon.
+
+bool CPUProcessor::Impl::canApplyPlanar(const ImageDesc & srcImgDesc,
+                                        const ImageDesc & dstImgDesc) const
+{
+    if (m_engine.m_planarOps.empty()
+        || !IsPlanarFloatImage(srcImgDesc) || !IsPlanarFloatImage(dstImgDesc))
+    {
+        return false;
+    }
+
+    if (srcImgDesc.getWidth() != dstImgDesc.getWidth()
+        || srcImgDesc.getHeight() != dstImgDesc.getHeight())
+    {
+        throw Exception("Dimension inconsistency between source and destination image buffers.");
+    }
+
+    return true;
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
+{
+    const CPUEngine & engine = getEngine();
+
+    if (canApplyPlanar(imgDesc, imgDesc))
+    {
+        ProcessPlanarLines(imgDesc, imgDesc, 0, imgDesc.getHeight(), engine.m_planarOps);
+        return;
     }
+
+    // Get the ScanlineHelper for this thread (no significant performance impact).
+    std::unique_ptr<ScanlineHelper> 
+        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_outBitDepth, engine));
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    ProcessScanlines(*scanlineBuilder, engine.m_cpuOps);
 }
 
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
+    const CPUEngine & engine = getEngine();
+
+    if (canApplyPlanar(srcImgDesc, dstImgDesc))
+    {
+        ProcessPlanarLines(srcImgDesc, dstImgDesc, 0, dstImgDesc.getHeight(), engine.m_planarOps);
+        return;
+    }
+
     // Get the ScanlineHelper for this thread (no significant performance impact).
     std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_outBitDepth, engine));
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    ProcessScanlines(*scanlineBuilder, engine.m_cpuOps);
+}
 
-    while(true)
+void CPUProcessor::Impl::applyParallel(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    const CPUEngine & engine = getEngine();
+    ThreadPool & pool = GetThreadPool();
+
+    const unsigned maxThreads = GetMaxThreads(pool, numThreads);
+    const long linesPerBand
+        = GetLinesPerBand(imgDesc.getWidth(), imgDesc.getHeight(), maxThreads);
+
+    if (maxThreads <= 1 || linesPerBand >= imgDesc.getHeight())
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        apply(imgDesc);
+        return;
+    }
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+    if (canApplyPlanar(imgDesc, imgDesc))
+    {
+        pool.parallelFor(imgDesc.getHeight(), linesPerBand, maxThreads,
+                         [&](long yBegin, long yEnd, unsigned /*slot*/)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            ProcessPlanarLines(imgDesc, imgDesc, yBegin, yEnd, engine.m_planarOps);
+        });
+        return;
+    }
+
+    // One ScanlineHelper (i.e. one set of intermediate buffers) per thread.
+    std::vector<std::unique_ptr<ScanlineHelper>> scanlineBuilders(maxThreads);
+
+    pool.parallelFor(imgDesc.getHeight(), linesPerBand, maxThreads,
+                     [&](long yBegin, long yEnd, unsigned slot)
+    {
+        std::unique_ptr<ScanlineHelper> & scanlineBuilder = scanlineBuilders[slot];
+        if (!scanlineBuilder)
+        {
+            scanlineBuilder.reset(CreateScanlineHelper(m_inBitDepth, m_outBitDepth, engine));
+            scanlineBuilder->init(imgDesc);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        scanlineBuilder->setLineRange(yBegin, yEnd);
+        ProcessScanlines(*scanlineBuilder, engine.m_cpuOps);
+    });
+}
+
+void CPUProcessor::Impl::applyParallel(const ImageDesc & srcImgDesc,
+                                       ImageDesc & dstImgDesc,
+                                       unsigned numThreads) const
+{
+    const CPUEngine & engine = getEngine();
+    ThreadPool & pool = GetThreadPool();
+
+    const unsigned maxThreads = GetMaxThreads(pool, numThreads);
+    const long linesPerBand
+        = GetLinesPerBand(dstImgDesc.getWidth(), dstImgDesc.getHeight(), maxThreads);
+
+    if (maxThreads <= 1 || linesPerBand >= dstImgDesc.getHeight())
+    {
+        apply(srcImgDesc, dstImgDesc);
+        return;
+    }
+
+    if (canApplyPlanar(srcImgDesc, dstImgDesc))
+    {
+        pool.parallelFor(dstImgDesc.getHeight(), linesPerBand, maxThreads,
+                         [&](long yBegin, long yEnd, unsigned /*slot*/)
+        {
+            ProcessPlanarLines(srcImgDesc, dstImgDesc, yBegin, yEnd, engine.m_planarOps);
+        });
+        return;
     }
+
+    // One ScanlineHelper (i.e. one set of intermediate buffers) per thread.
+    std::vector<std::unique_ptr<ScanlineHelper>> scanlineBuilders(maxThreads);
+
+    pool.parallelFor(dstImgDesc.getHeight(), linesPerBand, maxThreads,
+                     [&](long yBegin, long yEnd, unsigned slot)
+    {
+        std::unique_ptr<ScanlineHelper> & scanlineBuilder = scanlineBuilders[slot];
+        if (!scanlineBuilder)
+        {
+            scanlineBuilder.reset(CreateScanlineHelper(m_inBitDepth, m_outBitDepth, engine));
+            scanlineBuilder->init(srcImgDesc, dstImgDesc);
+        }
+
+        scanlineBuilder->setLineRange(yBegin, yEnd);
+        ProcessScanlines(*scanlineBuilder, engine.m_cpuOps);
+    });
 }
 
 void CPUProcessor::Impl::applyRGB(float * pixel) const
 {
     float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
 
-    m_inBitDepthOp->apply(v, v, 1);
+    m_engine.m_inBitDepthOp->apply(v, v, 1);
 
-    const size_t numOps = m_cpuOps.size();
+    const size_t numOps = m_engine.m_cpuOps.size();
     for(size_t i = 0; i<numOps; ++i)
     {
-        m_cpuOps[i]->apply(v, v, 1);
+        m_engine.m_cpuOps[i]->apply(v, v, 1);
     }
 
-    m_outBitDepthOp->apply(v, v, 1);
+    m_engine.m_outBitDepthOp->apply(v, v, 1);
 
     pixel[0] = v[0];
     pixel[1] = v[1];
@@ -453,15 +1115,126 @@ void CPUProcessor::Impl::applyRGB(float * pixel) const
 
 void CPUProcessor::Impl::applyRGBA(float * pixel) const
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
+    m_engine.m_inBitDepthOp->apply(pixel, pixel, 1);
 
-    const size_t numOps = m_cpuOps.size();
+    const size_t numOps = m_engine.m_cpuOps.size();
     for(size_t i = 0; i<numOps; ++i)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
+        m_engine.m_cpuOps[i]->apply(pixel, pixel, 1);
+    }
+
+    m_engine.m_outBitDepthOp->apply(pixel, pixel, 1);
+}
+
+void CPUProcessor::Impl::createTimedEngine() const
+{
+    // The same CPU Ops but recording their statistics. Note that the ops are not fused so each
+    // op is timed on complete chunks of pixels.
+
+    CPUEngine engine;
+    engine.m_packStatistics   = m_statistics.front();
+    engine.m_unpackStatistics = m_statistics.back();
+    engine.m_inBitDepthOp     = m_engine.m_inBitDepthOp;
+    engine.m_outBitDepthOp    = m_engine.m_outBitDepthOp;
+    for (size_t idx = 0; idx < m_unfusedCpuOps.size(); ++idx)
+    {
+        engine.m_cpuOps.push_back(
+            std::make_shared<TimedOpCPU>(m_unfusedCpuOps[idx], m_statistics[idx + 1]));
+    }
+
+    if (!m_engine.m_planarOps.empty())
+    {
+        // There is no packing so the input & output bit-depth ops are directly timed.
+        engine.m_planarOps.push_back(
+            std::make_shared<TimedOpCPU>(m_engine.m_inBitDepthOp, m_statistics.front()));
+        // The ops without a planar apply need the block processing of the fused op.
+        ConstOpCPURcPtrVec timedCpuOps = engine.m_cpuOps;
+        if (!std::all_of(timedCpuOps.begin(), timedCpuOps.end(),
+                         [](const ConstOpCPURcPtr & op) { return op->hasPlanarApply(); }))
+        {
+            FuseCPUOps(timedCpuOps);
+        }
+        engine.m_planarOps.insert(engine.m_planarOps.end(),
+                                  timedCpuOps.begin(),
+                                  timedCpuOps.end());
+        engine.m_planarOps.push_back(
+            std::make_shared<TimedOpCPU>(m_engine.m_outBitDepthOp, m_statistics.back()));
     }
 
-    m_outBitDepthOp->apply(pixel, pixel, 1);
+    m_timedEngine = engine;
+}
+
+void CPUProcessor::Impl::setStatisticsEnabled(bool enabled) const
+{
+    if (enabled)
+    {
+        AutoMutex guard(m_timedEngineMutex);
+        if (!m_hasTimedEngine)
+        {
+            createTimedEngine();
+            m_hasTimedEngine = true;
+        }
+    }
+
+    // The timed engine is complete before any apply could use it.
+    m_statisticsEnabled.store(enabled, std::memory_order_release);
+}
+
+void CPUProcessor::Impl::resetStatistics() const noexcept
+{
+    for (const auto & statistics : m_statistics)
+    {
+        statistics->reset();
+    }
+}
+
+const CPUStatisticsCounters & CPUProcessor::Impl::getStatistics(int index) const
+{
+    if (index < 0 || index >= getNumStatistics())
+    {
+        std::ostringstream oss;
+        oss << "CPUProcessor statistics index " << index << " is invalid, there are "
+            << getNumStatistics() << " processing steps.";
+        throw Exception(oss.str().c_str());
+    }
+
+    return *m_statistics[index];
+}
+
+const char * CPUProcessor::Impl::getStatisticsAsJSON() const
+{
+    std::ostringstream oss;
+    oss.precision(9);
+
+    oss << "[";
+
+    for (size_t idx = 0; idx < m_statistics.size(); ++idx)
+    {
+        const CPUStatisticsCounters & stats = *m_statistics[idx];
+
+        // Escape the characters having a special meaning in a JSON string.
+        std::string name;
+        for (const char c : stats.getName())
+        {
+            if (c == '"' || c == '\\')
+            {
+                name += '\\';
+            }
+            name += c;
+        }
+
+        oss << (idx == 0 ? "\n" : ",\n")
+            << "  { \"name\": \"" << name << "\""
+            << ", \"seconds\": " << stats.getSeconds()
+            << ", \"calls\": " << stats.getNumCalls()
+            << ", \"pixels\": " << stats.getNumPixels() << " }";
+    }
+
+    oss << "\n]";
+
+    AutoMutex guard(m_timedEngineMutex);
+    m_statisticsJSON = oss.str();
+    return m_statisticsJSON.c_str();
 }
 
 
@@ -503,6 +1276,11 @@ bool CPUProcessor::hasChannelCrosstalk() const
     return getImpl()->hasChannelCrosstalk();
 }
 
+float CPUProcessor::getCompactLutMaxError() const noexcept
+{
+    return getImpl()->getCompactLutMaxError();
+}
+
 const char * CPUProcessor::getCacheID() const
 {
     return getImpl()->getCacheID();
@@ -543,6 +1321,18 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::applyParallel(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->applyParallel(imgDesc, numThreads);
+}
+
+void CPUProcessor::applyParallel(const ImageDesc & srcImgDesc,
+                                 ImageDesc & dstImgDesc,
+                                 unsigned numThreads) const
+{
+    getImpl()->applyParallel(srcImgDesc, dstImgDesc, numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
@@ -553,4 +1343,49 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+void CPUProcessor::setStatisticsEnabled(bool enabled) const
+{
+    getImpl()->setStatisticsEnabled(enabled);
+}
+
+bool CPUProcessor::isStatisticsEnabled() const noexcept
+{
+    return getImpl()->isStatisticsEnabled();
+}
+
+void CPUProcessor::resetStatistics() const noexcept
+{
+    getImpl()->resetStatistics();
+}
+
+int CPUProcessor::getNumStatistics() const noexcept
+{
+    return getImpl()->getNumStatistics();
+}
+
+const char * CPUProcessor::getStatisticsName(int index) const
+{
+    return getImpl()->getStatistics(index).getName().c_str();
+}
+
+double CPUProcessor::getStatisticsSeconds(int index) const
+{
+    return getImpl()->getStatistics(index).getSeconds();
+}
+
+unsigned long long CPUProcessor::getStatisticsNumCalls(int index) const
+{
+    return getImpl()->getStatistics(index).getNumCalls();
+}
+
+unsigned long long CPUProcessor::getStatisticsNumPixels(int index) const
+{
+    return getImpl()->getStatistics(index).getNumPixels();
+}
+
+const char * CPUProcessor::getStatisticsAsJSON() const
+{
+    return getImpl()->getStatisticsAsJSON();
+}
+
 } // namespace OCIO_NAMESPACE
@@ -1,77 +1,172 @@
-// SPDX-License-Identifier: BSD-3-Clause
-// Copyright Contributors to the OpenColorIO Project.
-
-
-#ifndef INCLUDED_OCIO_CPUPROCESSOR_H
-#define INCLUDED_OCIO_CPUPROCESSOR_H
-
-
-#include <OpenColorIO/OpenColorIO.h>
-
-#include "Op.h"
-
-
-namespace OCIO_NAMESPACE
-{
-
-class ScanlineHelper;
-
-class CPUProcessor::Impl
-{
-public:
-    Impl() = default;
-    Impl(const Impl &) = delete;
-    Impl& operator=(const Impl &) = delete;
-
-    ~Impl() = default;
-
-    // Note: The in and out bit-depths must be equal for isNoOp to be true.
-    bool isNoOp() const noexcept { return m_isNoOp; }
-
-    // Note: Equivalent to isNoOp from the underlying Processor, 
-    // i.e., it ignores in/out bit-depth differences.
-    bool isIdentity() const noexcept { return m_isIdentity; }
-
-    bool hasChannelCrosstalk() const noexcept { return m_hasChannelCrosstalk; }
-
-    const char * getCacheID() const noexcept { return m_cacheID.c_str(); }
-
-    BitDepth getInputBitDepth() const noexcept { return m_inBitDepth; }
-    BitDepth getOutputBitDepth() const noexcept { return m_outBitDepth; }
-
-    bool isDynamic() const noexcept;
-    bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
-    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
-
-    void apply(const ImageDesc & imgDesc) const;
-    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
-
-    // Note that the method only accepts one packed RGB and 32-bit float pixel.
-    void applyRGB(float * pixel) const;
-    // Note that the method only accepts one packed RGBA and 32-bit float pixel.
-    void applyRGBA(float * pixel) const;
-
-    ////////////////////////////////////////////
-    //
-    // Functions not exposed to the OCIO public API.
-
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
-
-private:
-    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
-    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
-                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
-    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
-
-    BitDepth           m_inBitDepth = BIT_DEPTH_F32;
-    BitDepth           m_outBitDepth = BIT_DEPTH_F32;
-    bool               m_isNoOp = false;
-    bool               m_isIdentity = false;
-    bool               m_hasChannelCrosstalk = true;
-    std::string        m_cacheID;
-    Mutex              m_mutex;
-};
-
-} // namespace OCIO_NAMESPACE
-
-#endif // INCLUDED_OCIO_CPUPROCESSOR_H
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CPUPROCESSOR_H
+#define INCLUDED_OCIO_CPUPROCESSOR_H
+
+
+#include <atomic>
+#include <chrono>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class ScanlineHelper;
+
+// Cumulative statistics of one step of the CPU processing. The counters could be concurrently
+// updated by the threads of CPUProcessor::applyParallel().
+class CPUStatisticsCounters
+{
+public:
+    CPUStatisticsCounters() = delete;
+    CPUStatisticsCounters(const CPUStatisticsCounters &) = delete;
+    CPUStatisticsCounters& operator=(const CPUStatisticsCounters &) = delete;
+
+    explicit CPUStatisticsCounters(const std::string & name) : m_name(name) {}
+
+    void add(std::chrono::steady_clock::duration duration, long numPixels) noexcept
+    {
+        m_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        m_numCalls    += 1;
+        m_numPixels   += (unsigned long long)numPixels;
+    }
+
+    void reset() noexcept;
+
+    const std::string & getName() const noexcept { return m_name; }
+    double getSeconds() const noexcept { return double(m_nanoseconds.load()) * 1e-9; }
+    unsigned long long getNumCalls() const noexcept { return m_numCalls.load(); }
+    unsigned long long getNumPixels() const noexcept { return m_numPixels.load(); }
+
+private:
+    const std::string m_name;
+
+    std::atomic<long long> m_nanoseconds{ 0 };
+    std::atomic<unsigned long long> m_numCalls{ 0 };
+    std::atomic<unsigned long long> m_numPixels{ 0 };
+};
+
+typedef OCIO_SHARED_PTR<CPUStatisticsCounters> CPUStatisticsCountersRcPtr;
+typedef std::vector<CPUStatisticsCountersRcPtr> CPUStatisticsCountersVec;
+
+// The CPU Ops processing the images.
+struct CPUEngine
+{
+    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
+    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
+                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
+    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
+    ConstOpCPURcPtrVec m_planarOps;    // All the CPU Ops when they support the planar processing
+                                       // (i.e. in & out are F32), empty otherwise.
+
+    // The statistics of the packing & unpacking steps, if recorded.
+    CPUStatisticsCountersRcPtr m_packStatistics;
+    CPUStatisticsCountersRcPtr m_unpackStatistics;
+};
+
+// Get the ops of the color transformation without the bit-depth adjustments i.e. the finalized &
+// optimized ops the CPU processor uses.
+void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
+                       BitDepth in, BitDepth out,
+                       OptimizationFlags oFlags);
+
+class CPUProcessor::Impl
+{
+public:
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl& operator=(const Impl &) = delete;
+
+    ~Impl() = default;
+
+    // Note: The in and out bit-depths must be equal for isNoOp to be true.
+    bool isNoOp() const noexcept { return m_isNoOp; }
+
+    // Note: Equivalent to isNoOp from the underlying Processor, 
+    // i.e., it ignores in/out bit-depth differences.
+    bool isIdentity() const noexcept { return m_isIdentity; }
+
+    bool hasChannelCrosstalk() const noexcept { return m_hasChannelCrosstalk; }
+
+    float getCompactLutMaxError() const noexcept { return m_compactLutMaxError; }
+
+    const char * getCacheID() const noexcept { return m_cacheID.c_str(); }
+
+    BitDepth getInputBitDepth() const noexcept { return m_inBitDepth; }
+    BitDepth getOutputBitDepth() const noexcept { return m_outBitDepth; }
+
+    bool isDynamic() const noexcept;
+    bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
+
+    void apply(const ImageDesc & imgDesc) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
+
+    void applyParallel(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void applyParallel(const ImageDesc & srcImgDesc,
+                       ImageDesc & dstImgDesc,
+                       unsigned numThreads) const;
+
+    // Note that the method only accepts one packed RGB and 32-bit float pixel.
+    void applyRGB(float * pixel) const;
+    // Note that the method only accepts one packed RGBA and 32-bit float pixel.
+    void applyRGBA(float * pixel) const;
+
+    void setStatisticsEnabled(bool enabled) const;
+    bool isStatisticsEnabled() const noexcept { return m_statisticsEnabled; }
+    void resetStatistics() const noexcept;
+    int getNumStatistics() const noexcept { return static_cast<int>(m_statistics.size()); }
+    const CPUStatisticsCounters & getStatistics(int index) const;
+    const char * getStatisticsAsJSON() const;
+
+    ////////////////////////////////////////////
+    //
+    // Functions not exposed to the OCIO public API.
+
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+
+    // Same as finalize() but the ops are already optimized (see FinalizeOpsForCPU()).
+    void finalizeOptimizedOps(const OpRcPtrVec & ops, BitDepth in, BitDepth out,
+                              OptimizationFlags oFlags);
+
+private:
+    // Are the images planar F32 buffers the CPU Ops could directly process?
+    bool canApplyPlanar(const ImageDesc & srcImgDesc, const ImageDesc & dstImgDesc) const;
+
+    // Get the CPU Ops to use i.e. the ones recording the statistics only when enabled.
+    const CPUEngine & getEngine() const noexcept
+    {
+        return m_statisticsEnabled.load(std::memory_order_acquire) ? m_timedEngine : m_engine;
+    }
+
+    // Create the timed engine, only done the first time the statistics are enabled.
+    void createTimedEngine() const;
+
+    CPUEngine          m_engine;
+    ConstOpCPURcPtrVec m_unfusedCpuOps; // The CPU Ops of m_engine before their fusion.
+    mutable CPUEngine  m_timedEngine;   // Same ops as m_engine but recording their statistics.
+    mutable bool       m_hasTimedEngine = false;
+    mutable Mutex      m_timedEngineMutex;
+    CPUStatisticsCountersVec m_statistics; // The statistics of all the steps in processing order.
+    mutable std::atomic<bool> m_statisticsEnabled{ false };
+    mutable std::string m_statisticsJSON;
+
+    BitDepth           m_inBitDepth = BIT_DEPTH_F32;
+    BitDepth           m_outBitDepth = BIT_DEPTH_F32;
+    bool               m_isNoOp = false;
+    bool               m_isIdentity = false;
+    bool               m_hasChannelCrosstalk = true;
+    float              m_compactLutMaxError = 0.f;
+    std::string        m_cacheID;
+    Mutex              m_mutex;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_CPUPROCESSOR_H
@@ -26,4 +26,10 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
 }
+
+void SetFileCacheLimits(size_t maxEntries, size_t maxMemorySize)
+{
+    SetFileTransformCacheLimits(maxEntries, maxMemorySize);
+}
+
 } // namespace OCIO_NAMESPACE
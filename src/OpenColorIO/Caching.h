@@ -6,7 +6,14 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
-#include <map>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -20,16 +27,27 @@ namespace OCIO_NAMESPACE
 // Generic cache mechanism where EntryType is the instance type to cache and KeyType is the
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
-// of its length & where changes occur (e.g. absolute filepaths are inefficient). 
+// of its length & where changes occur (e.g. absolute filepaths are inefficient).
+//
+// The entries are spread over several shards (using the key hash), each one protected by its own
+// mutex, so that concurrent accesses to different entries rarely wait for each other. All the
+// methods are thread-safe.
+//
+// By default the cache is unbounded. It could be bounded by a maximum number of entries and/or by
+// an approximate memory budget (i.e. the sum of the memory sizes given to setEntryMemorySize());
+// the least recently used entries are then evicted to stay within the limits.
 template<typename KeyType, typename EntryType>
 class GenericCache
 {
 public:
 
-    using Entries = std::map<KeyType, EntryType>;
-    using Iterator = typename Entries::iterator;
+    // Called for each entry evicted because of the cache limits (i.e. not by clear()). Note that
+    // it's called while holding the lock of a shard so it must not access the cache.
+    using EvictionCallback = std::function<void(const KeyType & key, const EntryType & entry)>;
 
-    // Forbid copy & move semantics. 
+    static constexpr size_t NumShards = 16;
+
+    // Forbid copy & move semantics.
     GenericCache(const GenericCache &)  = delete;
     GenericCache(GenericCache && other) = delete;
     GenericCache & operator=(const GenericCache &)  = delete;
@@ -37,6 +55,7 @@ public:
 
     GenericCache()
         :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+        ,   m_shards(NumShards)
     {
     }
 
@@ -44,53 +63,440 @@ public:
 
     void clear() noexcept
     {
-        AutoMutex lock(m_mutex);
+        for (auto & shard : m_shards)
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            for (const auto & item : shard.m_items)
+            {
+                if (!item.second.m_pending)
+                {
+                    --m_numEntries;
+                }
+            }
+            m_memorySize -= shard.m_memorySize;
 
-        m_entries.clear();
+            shard.m_items.clear();
+            shard.m_lru.clear();
+            shard.m_memorySize = 0;
+        }
     }
 
-    inline void enable(bool enable) noexcept
+    inline void enable(bool enable) noexcept { m_enabled = enable; }
+
+    inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
+
+    // Limit the number of entries and/or the approximate memory size (in bytes) of the cache,
+    // 0 meaning no limit. The least recently used entries are immediately evicted if needed.
+    void setLimits(size_t maxEntries, size_t maxMemorySize) noexcept
     {
-        AutoMutex lock(m_mutex);
+        AutoMutex guard(m_limitsMutex);
+
+        m_maxEntries    = maxEntries;
+        m_maxMemorySize = maxMemorySize;
+
+        const bool bounded = maxEntries != 0 || maxMemorySize != 0;
+
+        for (auto & shard : m_shards)
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            if (bounded && !shard.m_tracked)
+            {
+                // The usage order of the existing entries is unknown.
+                for (auto & item : shard.m_items)
+                {
+                    if (item.second.m_pending)
+                    {
+                        continue;
+                    }
+
+                    shard.m_lru.push_front(item.first);
+                    item.second.m_lruPos   = shard.m_lru.begin();
+                    item.second.m_lastUse  = ++m_clock;
+                }
+            }
+            else if (!bounded && shard.m_tracked)
+            {
+                for (auto & item : shard.m_items)
+                {
+                    item.second.m_memorySize = 0;
+                }
+
+                m_memorySize -= shard.m_memorySize;
+                shard.m_memorySize = 0;
+                shard.m_lru.clear();
+            }
+
+            shard.m_tracked = bounded;
+        }
 
-        m_enabled = enable;
+        trim(nullptr);
     }
 
-    inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
+    size_t getMaxEntries() const noexcept { return m_maxEntries; }
+    size_t getMaxMemorySize() const noexcept { return m_maxMemorySize; }
+
+    void setEvictionCallback(const EvictionCallback & callback) noexcept
+    {
+        // Lock all the shards (always in the same order) as any of them could evict.
+        std::vector<std::unique_lock<Mutex>> locks;
+        locks.reserve(m_shards.size());
+        for (auto & shard : m_shards)
+        {
+            locks.emplace_back(shard.m_mutex);
+        }
 
-    // Get and lock the mutex before accessing to a cache entry.
-    Mutex & lock() noexcept { return m_mutex; }
+        m_evictionCallback = callback;
+    }
 
-    // Check existence of an entry the cache.
-    // To only use when lock is on to protect the cache access.
+    // Check existence of an entry the cache. Note that an entry still being created by
+    // findOrInsert() does not exist yet.
     bool exists(const KeyType & key) const noexcept
     {
-        return isEnabled() && m_entries.end() != m_entries.find(key);
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        const Shard & shard = getShard(key);
+        AutoMutex lock(shard.m_mutex);
+
+        auto it = shard.m_items.find(key);
+        return it != shard.m_items.end() && !it->second.m_pending;
+    }
+
+    // Get a cache entry, returns false if it does not exist. When the cache is bounded, the entry
+    // becomes the most recently used one.
+    bool find(const KeyType & key, EntryType & entry) noexcept
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        Shard & shard = getShard(key);
+        AutoMutex lock(shard.m_mutex);
+
+        auto it = shard.m_items.find(key);
+        if (it == shard.m_items.end() || it->second.m_pending)
+        {
+            return false;
+        }
+
+        touch(shard, it->second);
+        entry = it->second.m_entry;
+
+        return true;
+    }
+
+    // Get a cache entry. If not existing, the entry is created by calling create() and it could
+    // evict other entries. A placeholder of the key is inserted while create() runs without
+    // holding any lock, so the concurrent requests of the same key wait for that creation (and
+    // get its exception if any) while the other keys of the shard stay available. Note that
+    // create() must then not request the same key.
+    template<typename Creator>
+    EntryType findOrInsert(const KeyType & key, Creator && create)
+    {
+        if (!isEnabled())
+        {
+            return create();
+        }
+
+        Shard & shard = getShard(key);
+        PendingRcPtr pending;
+        std::shared_future<EntryType> inProgress;
+
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            auto it = shard.m_items.find(key);
+            if (it == shard.m_items.end())
+            {
+                pending = std::make_shared<Pending>();
+                shard.m_items[key].m_pending = pending;
+            }
+            else if (it->second.m_pending)
+            {
+                inProgress = it->second.m_pending->m_future;
+            }
+            else
+            {
+                touch(shard, it->second);
+                return it->second.m_entry;
+            }
+        }
+
+        if (inProgress.valid())
+        {
+            // Wait for the creation in progress, outside of the lock.
+            return inProgress.get();
+        }
+
+        EntryType entry;
+        try
+        {
+            entry = create();
+        }
+        catch (...)
+        {
+            {
+                AutoMutex lock(shard.m_mutex);
+                removePending(shard, key, pending);
+            }
+
+            pending->m_promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            // The placeholder could have been removed by clear() in the meantime.
+            auto it = shard.m_items.find(key);
+            if (it != shard.m_items.end() && it->second.m_pending == pending)
+            {
+                Item & item = it->second;
+                item.m_entry = entry;
+                item.m_pending.reset();
+                if (shard.m_tracked)
+                {
+                    shard.m_lru.push_front(key);
+                    item.m_lruPos  = shard.m_lru.begin();
+                    item.m_lastUse = ++m_clock;
+                }
+
+                ++m_numEntries;
+            }
+        }
+
+        pending->m_promise.set_value(entry);
+
+        trim(&key);
+
+        return entry;
+    }
+
+    // Set the approximate memory size (in bytes) used by an existing entry. It could evict other
+    // entries if the memory budget is exceeded. Note that it does nothing if the cache is not
+    // bounded.
+    void setEntryMemorySize(const KeyType & key, size_t memorySize) noexcept
+    {
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        {
+            Shard & shard = getShard(key);
+            AutoMutex lock(shard.m_mutex);
+
+            auto it = shard.m_items.find(key);
+            if (it == shard.m_items.end() || it->second.m_pending || !shard.m_tracked)
+            {
+                return;
+            }
+
+            m_memorySize += memorySize;
+            m_memorySize -= it->second.m_memorySize;
+
+            shard.m_memorySize += memorySize;
+            shard.m_memorySize -= it->second.m_memorySize;
+
+            it->second.m_memorySize = memorySize;
+        }
+
+        trim(&key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
-    // To only use when lock is on to protect the cache access.
-    EntryType & operator[](const KeyType & key) noexcept
+    // Visit all the entries, except the ones being created. Note that fn() is called while
+    // holding the lock of a shard so it must not access the cache.
+    template<typename Visitor>
+    void forEach(Visitor && fn)
     {
-        static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        for (auto & shard : m_shards)
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            for (const auto & item : shard.m_items)
+            {
+                if (!item.second.m_pending)
+                {
+                    fn(item.first, item.second.m_entry);
+                }
+            }
+        }
     }
 
-    Iterator begin() noexcept { return m_entries.begin(); }
-    Iterator end()   noexcept { return m_entries.end();   }
+    size_t getNumEntries() const noexcept { return m_numEntries; }
+    size_t getMemorySize() const noexcept { return m_memorySize; }
 
 protected:
     explicit GenericCache(bool disableCaches)
         :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES) || disableCaches)
+        ,   m_shards(NumShards)
     {
     }
 
     const bool m_envDisableAllCaches = false;
-    bool m_enabled = true;
+    std::atomic<bool> m_enabled{ true };
 
 private:
-    Mutex m_mutex;
-    Entries m_entries;
+    // The placeholder of an entry being created by findOrInsert().
+    struct Pending
+    {
+        Pending() : m_future(m_promise.get_future().share()) {}
+
+        std::promise<EntryType> m_promise;
+        std::shared_future<EntryType> m_future;
+    };
+
+    typedef OCIO_SHARED_PTR<Pending> PendingRcPtr;
+
+    struct Item
+    {
+        EntryType m_entry;
+        PendingRcPtr m_pending; // Only set while the entry is being created.
+
+        // The least recently used tracking is only done when the cache is bounded.
+        typename std::list<KeyType>::iterator m_lruPos;
+        unsigned long long m_lastUse = 0;
+        size_t m_memorySize = 0;
+    };
+
+    struct Shard
+    {
+        mutable Mutex m_mutex;
+        std::unordered_map<KeyType, Item> m_items;
+
+        bool m_tracked = false;
+        std::list<KeyType> m_lru; // The most recently used key first.
+        size_t m_memorySize = 0;
+    };
+
+    Shard & getShard(const KeyType & key) noexcept
+    {
+        return m_shards[std::hash<KeyType>{}(key) % m_shards.size()];
+    }
+
+    const Shard & getShard(const KeyType & key) const noexcept
+    {
+        return m_shards[std::hash<KeyType>{}(key) % m_shards.size()];
+    }
+
+    // Remove the placeholder of a failed creation. To only use when the shard lock is on.
+    static void removePending(Shard & shard, const KeyType & key, const PendingRcPtr & pending)
+    {
+        auto it = shard.m_items.find(key);
+        if (it != shard.m_items.end() && it->second.m_pending == pending)
+        {
+            shard.m_items.erase(it);
+        }
+    }
+
+    // To only use when the shard lock is on.
+    void touch(Shard & shard, Item & item) noexcept
+    {
+        if (shard.m_tracked)
+        {
+            shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, item.m_lruPos);
+            item.m_lastUse = ++m_clock;
+        }
+    }
+
+    // Get the least recently used entry of the shard which is not the 'keep' one.
+    // To only use when the shard lock is on.
+    static typename std::unordered_map<KeyType, Item>::iterator
+        getEvictable(Shard & shard, const KeyType * keep) noexcept
+    {
+        for (auto it = shard.m_lru.rbegin(); it != shard.m_lru.rend(); ++it)
+        {
+            if (!keep || !(*it == *keep))
+            {
+                return shard.m_items.find(*it);
+            }
+        }
+        return shard.m_items.end();
+    }
+
+    bool isOverLimits() const noexcept
+    {
+        const size_t maxEntries    = m_maxEntries;
+        const size_t maxMemorySize = m_maxMemorySize;
+
+        return (maxEntries != 0 && m_numEntries > maxEntries)
+            || (maxMemorySize != 0 && m_memorySize > maxMemorySize);
+    }
+
+    // Evict the least recently used entries (but never the 'keep' one) until the cache is within
+    // its limits. Only one shard lock is held at a time.
+    void trim(const KeyType * keep) noexcept
+    {
+        if (!isOverLimits())
+        {
+            return;
+        }
+
+        // Serialize the evictions so that concurrent insertions do not evict too many entries.
+        AutoMutex guard(m_trimMutex);
+
+        while (isOverLimits())
+        {
+            // Find the shard holding the least recently used entry.
+            Shard * lruShard = nullptr;
+            unsigned long long lruStamp = std::numeric_limits<unsigned long long>::max();
+
+            for (auto & shard : m_shards)
+            {
+                AutoMutex lock(shard.m_mutex);
+
+                auto it = getEvictable(shard, keep);
+                if (it != shard.m_items.end() && it->second.m_lastUse < lruStamp)
+                {
+                    lruShard = &shard;
+                    lruStamp = it->second.m_lastUse;
+                }
+            }
+
+            if (!lruShard)
+            {
+                // Only the entry to keep remains.
+                return;
+            }
+
+            AutoMutex lock(lruShard->m_mutex);
+
+            // Note that the shard content could have changed in the meantime.
+            auto it = getEvictable(*lruShard, keep);
+            if (it != lruShard->m_items.end())
+            {
+                if (m_evictionCallback)
+                {
+                    m_evictionCallback(it->first, it->second.m_entry);
+                }
+
+                m_numEntries -= 1;
+                m_memorySize -= it->second.m_memorySize;
+                lruShard->m_memorySize -= it->second.m_memorySize;
+
+                lruShard->m_lru.erase(it->second.m_lruPos);
+                lruShard->m_items.erase(it);
+            }
+        }
+    }
+
+    std::vector<Shard> m_shards;
+
+    Mutex m_limitsMutex;
+    Mutex m_trimMutex;
+    std::atomic<size_t> m_maxEntries{ 0 };
+    std::atomic<size_t> m_maxMemorySize{ 0 };
+
+    std::atomic<size_t> m_numEntries{ 0 };
+    std::atomic<size_t> m_memorySize{ 0 };
+    std::atomic<unsigned long long> m_clock{ 0 };
+
+    EvictionCallback m_evictionCallback;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
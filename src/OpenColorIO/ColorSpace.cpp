@@ -7,6 +7,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "LazyTransform.h"
 #include "TokensManager.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
@@ -311,10 +312,11 @@ ConstTransformRcPtr ColorSpace::getTransform(ColorSpaceDirection dir) const noex
 {
     switch (dir)
     {
+    // Note that the transforms could be lazy loaded (refer to OCIO_LAZY_CONFIG_LOADING_ENVVAR).
     case COLORSPACE_DIR_TO_REFERENCE:
-        return getImpl()->m_toRefTransform;
+        return LazyTransform::Resolve(getImpl()->m_toRefTransform);
     case COLORSPACE_DIR_FROM_REFERENCE:
-        return getImpl()->m_fromRefTransform;
+        return LazyTransform::Resolve(getImpl()->m_fromRefTransform);
     }
     return ConstTransformRcPtr();
 }
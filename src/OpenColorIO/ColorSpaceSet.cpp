@@ -6,6 +6,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "NameIndex.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
 
@@ -30,6 +31,7 @@ public:
             for (auto & cs: rhs.m_colorSpaces)
             {
                 m_colorSpaces.push_back(cs->createEditableCopy());
+                indexColorSpace(m_colorSpaces.size() - 1);
             }
         }
         return *this;
@@ -89,27 +91,8 @@ public:
     int getIndex(const char * csName) const 
     {
         // Search for name and aliases.
-        if (csName && *csName)
-        {
-            const std::string str = StringUtils::Lower(csName);
-            for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
-            {
-                if (StringUtils::Compare(m_colorSpaces[idx]->getName(), str))
-                {
-                    return static_cast<int>(idx);
-                }
-                const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
-                for (size_t aidx = 0; aidx < numAliases; ++aidx)
-                {
-                    if (StringUtils::Compare(m_colorSpaces[idx]->getAlias(aidx), str))
-                    {
-                        return static_cast<int>(idx);
-                    }
-                }
-            }
-        }
-
-        return -1;
+        const size_t idx = m_index.find(csName);
+        return idx == NameIndex::npos ? -1 : static_cast<int>(idx);
     }
 
     bool isPresent(const char * csName) const
@@ -164,10 +147,13 @@ public:
         {
             // The color space replaces the existing one.
             m_colorSpaces[replaceIdx] = cs->createEditableCopy();
+            // The aliases could be different.
+            rebuildIndex();
             return;
         }
 
         m_colorSpaces.push_back(cs->createEditableCopy());
+        indexColorSpace(m_colorSpaces.size() - 1);
     }
 
     void add(const Impl & rhs)
@@ -188,6 +174,7 @@ public:
             if (StringUtils::Lower((*itr)->getName())==name)
             {
                 m_colorSpaces.erase(itr);
+                rebuildIndex();
                 return;
             }
         }
@@ -204,11 +191,35 @@ public:
     void clear()
     {
         m_colorSpaces.clear();
+        m_index.clear();
     }
 
 private:
+    void indexColorSpace(size_t idx)
+    {
+        m_index.add(m_colorSpaces[idx]->getName(), idx);
+
+        const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            m_index.add(m_colorSpaces[idx]->getAlias(aidx), idx);
+        }
+    }
+
+    void rebuildIndex()
+    {
+        m_index.clear();
+        for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
+        {
+            indexColorSpace(idx);
+        }
+    }
+
     typedef std::vector<ColorSpaceRcPtr> ColorSpaceVec;
     ColorSpaceVec m_colorSpaces;
+
+    // The color space names and aliases, case-insensitive.
+    NameIndex m_index;
 };
 
 
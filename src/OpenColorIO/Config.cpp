@@ -2,11 +2,14 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <regex>
@@ -23,10 +26,12 @@
 #include "fileformats/FileFormatICC.h"
 #include "FileRules.h"
 #include "HashUtils.h"
+#include "LazyTransform.h"
 #include "Logging.h"
 #include "LookParse.h"
 #include "MathUtils.h"
 #include "Mutex.h"
+#include "NameIndex.h"
 #include "NamedTransform.h"
 #include "OCIOYaml.h"
 #include "OCIOZArchive.h"
@@ -40,6 +45,7 @@
 #include "utils/StringUtils.h"
 #include "ViewingRules.h"
 #include "SystemMonitor.h"
+#include "ThreadPool.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -50,6 +56,9 @@ const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
+const char * OCIO_CPU_STATISTICS_ENVVAR       = "OCIO_CPU_STATISTICS";
+const char * OCIO_PROCESSOR_CACHE_DIR_ENVVAR  = "OCIO_PROCESSOR_CACHE_DIR";
+const char * OCIO_LAZY_CONFIG_LOADING_ENVVAR  = "OCIO_LAZY_CONFIG_LOADING";
 
 // Default filename (with extension) of a config and archived config.
 const char * OCIO_CONFIG_DEFAULT_NAME         = "config";
@@ -142,6 +151,14 @@ const char* LookupEnvironment(const StringMap & env, const std::string & name)
     return iter->second.c_str();
 }
 
+// Refer to OCIO_LAZY_CONFIG_LOADING_ENVVAR.
+bool IsLazyLoadingEnabled()
+{
+    std::string lazyEnv;
+    Platform::Getenv(OCIO_LAZY_CONFIG_LOADING_ENVVAR, lazyEnv);
+    return !lazyEnv.empty() && lazyEnv != "0";
+}
+
 // Roles
 // (lower case role name: colorspace name)
 const char* LookupRole(const StringMap & roles, const std::string & rolename)
@@ -151,25 +168,6 @@ const char* LookupRole(const StringMap & roles, const std::string & rolename)
     return iter->second.c_str();
 }
 
-void GetFileReferences(std::set<std::string> & files, const ConstTransformRcPtr & transform)
-{
-    if(!transform) return;
-
-    if(ConstGroupTransformRcPtr groupTransform = \
-        DynamicPtrCast<const GroupTransform>(transform))
-    {
-        for(int i=0; i<groupTransform->getNumTransforms(); ++i)
-        {
-            GetFileReferences(files, groupTransform->getTransform(i));
-        }
-    }
-    else if(ConstFileTransformRcPtr fileTransform = \
-        DynamicPtrCast<const FileTransform>(transform))
-    {
-        files.insert(fileTransform->getSrc());
-    }
-}
-
 // Return the list of all color spaces referenced by the transform (including all sub-transforms in
 // a group). All legal context variables are expanded, so if any are remaining, the caller may want
 // to throw.
@@ -291,6 +289,7 @@ public:
 
     StringMap m_roles;
     LookVec m_looksList;
+    NameIndex m_looksIndex; // The look names, case-insensitive.
 
     DisplayMap m_displays;
     StringUtils::StringVec m_activeDisplays;
@@ -304,6 +303,7 @@ public:
     Display m_virtualDisplay;
 
     std::vector<ViewTransformRcPtr> m_viewTransforms;
+    NameIndex m_viewTransformsIndex; // The view transform names, case-insensitive.
     std::string m_defaultViewTransform;
 
     mutable std::string m_activeDisplaysStr;
@@ -312,6 +312,8 @@ public:
 
     // All the named transforms(i.e. no filtering).
     std::vector<ConstNamedTransformRcPtr> m_allNamedTransforms;
+    // The named transform names and aliases, case-insensitive.
+    NameIndex m_allNamedTransformsIndex;
     // Active named transform names.
     StringUtils::StringVec m_activeNamedTransformNames;
     // Inactive named transform names.
@@ -329,8 +331,66 @@ public:
     mutable std::string m_cacheidnocontext;
     FileRulesRcPtr m_fileRules;
 
+    // Index of the cached processors by processor cache ID. The index does not own the processors
+    // i.e. they are only kept alive by the processor cache or by the client application.
+    class ProcessorCacheIDIndex
+    {
+    public:
+        ProcessorCacheIDIndex() = default;
+        ProcessorCacheIDIndex(const ProcessorCacheIDIndex &) = delete;
+        ProcessorCacheIDIndex & operator=(const ProcessorCacheIDIndex &) = delete;
+
+        // Return the existing processor having the same cache ID, or add and return the processor.
+        ProcessorRcPtr findOrAdd(const ProcessorRcPtr & processor)
+        {
+            const std::string cacheID = processor->getCacheID();
+
+            AutoMutex guard(m_mutex);
+
+            std::weak_ptr<Processor> & entry = m_processors[cacheID];
+
+            ProcessorRcPtr existing = entry.lock();
+            if (existing)
+            {
+                return existing;
+            }
+
+            entry = processor;
+
+            // Remove the processors which do not exist anymore.
+            if (m_processors.size() >= m_pruneSize)
+            {
+                for (auto it = m_processors.begin(); it != m_processors.end(); )
+                {
+                    it = it->second.expired() ? m_processors.erase(it) : std::next(it);
+                }
+
+                m_pruneSize = std::max(size_t(64), 2 * m_processors.size());
+            }
+
+            return processor;
+        }
+
+        void clear() noexcept
+        {
+            AutoMutex guard(m_mutex);
+
+            m_processors.clear();
+            m_pruneSize = 64;
+        }
+
+    private:
+        Mutex m_mutex;
+        std::unordered_map<std::string, std::weak_ptr<Processor>> m_processors;
+        size_t m_pruneSize = 64;
+    };
+
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    mutable ProcessorCacheIDIndex m_processorCacheIDIndex;
+
+    // Directory of the persistent processor cache, empty if not used.
+    std::string m_processorDiskCacheDir;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -368,6 +428,13 @@ public:
 
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
 
+        Platform::Getenv(OCIO_PROCESSOR_CACHE_DIR_ENVVAR, m_processorDiskCacheDir);
+        m_processorDiskCacheDir = StringUtils::Trim(m_processorDiskCacheDir);
+        if (!m_processorDiskCacheDir.empty())
+        {
+            m_processorDiskCacheDir = AbsPath(m_processorDiskCacheDir);
+        }
+
         // This is used to allow the YAML writer to not save any virtual displays that were
         // instantiated.
         m_virtualDisplay.m_temporary = true;
@@ -404,6 +471,7 @@ public:
             {
                 m_looksList.push_back(look->createEditableCopy());
             }
+            m_looksIndex = rhs.m_looksIndex;
 
             // Assignment operator will suffice for these.
             m_roles = rhs.m_roles;
@@ -414,6 +482,7 @@ public:
             {
                 m_allNamedTransforms.push_back(nt->createEditableCopy());
             }
+            m_allNamedTransformsIndex = rhs.m_allNamedTransformsIndex;
             m_activeNamedTransformNames = rhs.m_activeNamedTransformNames;
             m_inactiveNamedTransformNames = rhs.m_inactiveNamedTransformNames;
 
@@ -436,6 +505,7 @@ public:
             {
                 m_viewTransforms.push_back(vt->createEditableCopy());
             }
+            m_viewTransformsIndex = rhs.m_viewTransformsIndex;
             m_defaultViewTransform = rhs.m_defaultViewTransform;
             m_defaultLumaCoefs = rhs.m_defaultLumaCoefs;
             m_strictParsing = rhs.m_strictParsing;
@@ -451,7 +521,12 @@ public:
             m_cacheFlags = rhs.m_cacheFlags;
 
             m_processorCache.clear();
+            m_processorCacheIDIndex.clear();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+            m_processorCache.setLimits(rhs.m_processorCache.getMaxEntries(),
+                                       rhs.m_processorCache.getMaxMemorySize());
+
+            m_processorDiskCacheDir = rhs.m_processorDiskCacheDir;
         }
         return *this;
     }
@@ -495,26 +570,18 @@ public:
 
     size_t getNamedTransformIndex(const char * name) const noexcept
     {
-        if (name && *name)
+        return m_allNamedTransformsIndex.find(name);
+    }
+
+    void indexNamedTransform(size_t idx)
+    {
+        m_allNamedTransformsIndex.add(m_allNamedTransforms[idx]->getName(), idx);
+
+        const auto numAliases = m_allNamedTransforms[idx]->getNumAliases();
+        for (size_t alias = 0; alias < numAliases; ++alias)
         {
-            const std::string str = StringUtils::Lower(name);
-            for (size_t idx = 0; idx < m_allNamedTransforms.size(); ++idx)
-            {
-                if (StringUtils::Lower(m_allNamedTransforms[idx]->getName()) == str)
-                {
-                    return idx;
-                }
-                const auto numAliases = m_allNamedTransforms[idx]->getNumAliases();
-                for (size_t alias = 0; alias < numAliases; ++alias)
-                {
-                    if (StringUtils::Lower(m_allNamedTransforms[idx]->getAlias(alias)) == str)
-                    {
-                        return idx;
-                    }
-                }
-            }
+            m_allNamedTransformsIndex.add(m_allNamedTransforms[idx]->getAlias(alias), idx);
         }
-        return static_cast<size_t>(-1);
     }
 
     enum InactiveType
@@ -525,35 +592,29 @@ public:
     };
     StringUtils::StringVec buildInactiveNamesList(InactiveType type) const;
     void refreshActiveColorSpaces();
+    // Faster refresh when the color space is appended to the list of color spaces.
+    void refreshActiveColorSpaces(const std::string & appendedName);
 
     ConstViewTransformRcPtr getViewTransform(const char * name) const noexcept
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & vt : m_viewTransforms)
+        const size_t idx = m_viewTransformsIndex.find(name);
+        if (idx == NameIndex::npos)
         {
-            if (StringUtils::Lower(vt->getName()) == namelower)
-            {
-                return vt;
-            }
+            return ConstViewTransformRcPtr();
         }
 
-        return ConstViewTransformRcPtr();
+        return m_viewTransforms[idx];
     }
 
     ConstLookRcPtr getLook(const char * name) const
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & look : m_looksList)
+        const size_t idx = m_looksIndex.find(name);
+        if (idx == NameIndex::npos)
         {
-            if (StringUtils::Lower(look->getName()) == namelower)
-            {
-                return look;
-            }
+            return ConstLookRcPtr();
         }
 
-        return ConstLookRcPtr();
+        return m_looksList[idx];
     }
 
     ViewPtrVec getViews(const Display & display) const
@@ -583,11 +644,18 @@ public:
 
     // Get all internal transforms (to generate cacheIDs, validation, etc).
     // This currently crawls colorspaces + looks + view transforms.
-    void getAllInternalTransforms(ConstTransformVec & transformVec) const;
+    void getAllInternalTransforms(ConstTransformVec & transformVec,
+                                  bool withColorSpaces = true) const;
 
     static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
     static ConstConfigRcPtr Read(std::istream & istream, ConfigIOProxyRcPtr ciop);
 
+    // Read the YAML config and, when lazy, return the cache ID of its content.
+    static std::string ReadYaml(std::istream & istream,
+                                ConfigRcPtr & config,
+                                const char * filename,
+                                bool lazy);
+
     // Validate view object that can be a config defined shared view or a display-defined view.
     void validateView(const std::string & display, const View & view, bool checkUseDisplayName) const
     {
@@ -779,7 +847,9 @@ public:
     }
 
     void checkVersionConsistency(ConstTransformRcPtr & transform) const;
-    void checkVersionConsistency() const;
+    // Note that the lazy loaded transforms of the color spaces are only checked by
+    // Config::validate().
+    void checkVersionConsistency(bool lazyLoaded = false) const;
 
     const View * getView(const char * display, const char * view) const
     {
@@ -1107,10 +1177,6 @@ public:
 
 
 
-// Instantiate the cache with the right types.
-extern template class ProcessorCache<std::size_t, ProcessorRcPtr>;
-
-
 ///////////////////////////////////////////////////////////////////////////
 
 ConfigRcPtr Config::Create()
@@ -1962,7 +2028,7 @@ void Config::validate() const
         std::set<std::string> files;
         for (const auto & transform : allTransforms)
         {
-            GetFileReferences(files, transform);
+            ConfigUtils::GetFileReferences(files, transform);
         }
 
         // Check that at least one of the search paths can be resolved into a valid path.
@@ -2621,12 +2687,23 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
         }
     }
 
+    const int numColorSpaces = getImpl()->m_allColorSpaces->getNumColorSpaces();
+
     // This is verifying that name and aliases are fine with other color spaces.
     getImpl()->m_allColorSpaces->addColorSpace(original);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
-    getImpl()->refreshActiveColorSpaces();
+
+    // Only a replaced color space could change the other entries of the active & inactive lists.
+    if (getImpl()->m_allColorSpaces->getNumColorSpaces() == numColorSpaces + 1)
+    {
+        getImpl()->refreshActiveColorSpaces(name);
+    }
+    else
+    {
+        getImpl()->refreshActiveColorSpaces();
+    }
 }
 
 void Config::removeColorSpace(const char * name)
@@ -3267,12 +3344,20 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         // Safe to swap, copy is not used after.
         getImpl()->m_allNamedTransforms[replaceIdx].swap(namedTransformCopy);
+
+        // The aliases could be different.
+        getImpl()->m_allNamedTransformsIndex.clear();
+        for (size_t idx = 0; idx < getImpl()->m_allNamedTransforms.size(); ++idx)
+        {
+            getImpl()->indexNamedTransform(idx);
+        }
     }
     else
     {
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         getImpl()->m_allNamedTransforms.push_back(namedTransformCopy);
+        getImpl()->indexNamedTransform(getImpl()->m_allNamedTransforms.size() - 1);
     }
 
     getImpl()->resetCacheIDs();
@@ -3282,6 +3367,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
 void Config::clearNamedTransforms()
 {
     getImpl()->m_allNamedTransforms.clear();
+    getImpl()->m_allNamedTransformsIndex.clear();
 
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
@@ -4110,24 +4196,21 @@ void Config::addLook(const ConstLookRcPtr & look)
     if(name.empty())
         throw Exception("Cannot addLook with an empty name.");
 
-    const std::string namelower = StringUtils::Lower(name);
-
     // If the look exists, replace it
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const size_t idx = getImpl()->m_looksIndex.find(name.c_str());
+    if (idx != NameIndex::npos)
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            getImpl()->m_looksList[i] = look->createEditableCopy();
+        getImpl()->m_looksList[idx] = look->createEditableCopy();
 
-            AutoMutex lock(getImpl()->m_cacheidMutex);
-            getImpl()->resetCacheIDs();
+        AutoMutex lock(getImpl()->m_cacheidMutex);
+        getImpl()->resetCacheIDs();
 
-            return;
-        }
+        return;
     }
 
     // Otherwise, add it
     getImpl()->m_looksList.push_back(look->createEditableCopy());
+    getImpl()->m_looksIndex.add(name.c_str(), getImpl()->m_looksList.size() - 1);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4136,6 +4219,7 @@ void Config::addLook(const ConstLookRcPtr & look)
 void Config::clearLooks()
 {
     getImpl()->m_looksList.clear();
+    getImpl()->m_looksIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4219,25 +4303,17 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
         throw Exception(os.str().c_str());
     }
 
-    const std::string namelower = StringUtils::Lower(name);
-
-    bool addIt = true;
-
     // If the view transform exists, replace it.
-    for (auto && vt : getImpl()->m_viewTransforms)
+    const size_t idx = getImpl()->m_viewTransformsIndex.find(name.c_str());
+    if (idx != NameIndex::npos)
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            vt = viewTransform->createEditableCopy();
-            addIt = false;
-            break;
-        }
+        getImpl()->m_viewTransforms[idx] = viewTransform->createEditableCopy();
     }
-
     // Otherwise, add it.
-    if (addIt)
+    else
     {
         getImpl()->m_viewTransforms.push_back(viewTransform->createEditableCopy());
+        getImpl()->m_viewTransformsIndex.add(name.c_str(), getImpl()->m_viewTransforms.size() - 1);
     }
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -4247,6 +4323,7 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 void Config::clearViewTransforms()
 {
     getImpl()->m_viewTransforms.clear();
+    getImpl()->m_viewTransformsIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4280,6 +4357,16 @@ const char * Config::getColorSpaceFromFilepath(const char * filePath, size_t & r
                                                                         ruleIndex);
 }
 
+void Config::getColorSpacesFromFilepaths(const std::vector<std::string> & filePaths,
+                                         std::vector<std::string> & colorSpaces,
+                                         std::vector<size_t> & ruleIndices) const
+{
+    getImpl()->m_fileRules->getImpl()->getColorSpacesFromFilepaths(*this,
+                                                                   filePaths,
+                                                                   colorSpaces,
+                                                                   ruleIndices);
+}
+
 bool Config::filepathOnlyMatchesDefaultRule(const char * filePath) const
 {
     return getImpl()->m_fileRules->getImpl()->filepathOnlyMatchesDefaultRule(*this,
@@ -4436,15 +4523,24 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
     {
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->setProcessorCacheFlags(config.getImpl()->m_cacheFlags);
-        processor->getImpl()->setTransform(config, context, transform, direction);
-        processor->getImpl()->computeMetadata();
+
+        // The persistent processor cache only works with files from the file system.
+        const std::string & diskCacheDir = config.getImpl()->m_processorDiskCacheDir;
+        if (!diskCacheDir.empty() && !context->getConfigIOProxy())
+        {
+            processor->getImpl()->setTransformUsingDiskCache(diskCacheDir, config, context,
+                                                             transform, direction);
+        }
+        else
+        {
+            processor->getImpl()->setTransform(config, context, transform, direction);
+            processor->getImpl()->computeMetadata();
+        }
         return processor;
     };
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -4454,12 +4550,12 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // Note that the processor is created outside of the cache locks (i.e. only the concurrent
+        // requests of the same processor wait for it).
+        bool created = false;
+        ProcessorRcPtr proc = getImpl()->m_processorCache.findOrInsert(key, [&]()
         {
-            ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
+            ProcessorRcPtr newProc = CreateProcessor(*this, context, transform, direction);
 
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
@@ -4472,32 +4568,137 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                 // The benefit to using the existing one is that it may already have an optimized
                 // Processor, CPUProcessor, or GPUProcessor inside it.
 
-                // TODO: With the original context part of the cache data, the code could first
-                // compare the two contexts before doing the lengthy Processor::getCacheID()
-                // computation.
+                newProc = getImpl()->m_processorCacheIDIndex.findOrAdd(newProc);
+            }
+
+            created = true;
+            return newProc;
+        });
 
-                for (auto & entry : getImpl()->m_processorCache)
+        if (created)
+        {
+            getImpl()->m_processorCache.setEntryMemorySize(key,
+                                                           proc->getImpl()->getLutMemorySize());
+        }
+
+        return proc;
+    }
+    else
+    {
+        return CreateProcessor(*this, context, transform, direction);
+    }
+}
+
+size_t Config::warmUpProcessors(const ConstContextRcPtr & context,
+                                const DisplayViewProcessorDescVec & processors,
+                                const ProcessorWarmUpCallback & callback) const
+{
+    if (!context)
+    {
+        throw Exception("Config::warmUpProcessors failed. Context is null.");
+    }
+
+    // The legacy viewing pipeline needs a config shared pointer. As the call is synchronous, a
+    // non-owning one is enough.
+    ConstConfigRcPtr config(this, [](const Config *) {});
+
+    const size_t numTotal = processors.size();
+
+    std::atomic<size_t> numBuilt{ 0 };
+    std::atomic<bool> cancelled{ false };
+
+    Mutex callbackMutex;
+    size_t numDone = 0;
+
+    GetThreadPool().parallelFor(long(numTotal), 1, 0, [&](long begin, long end, unsigned)
+    {
+        for (long idx = begin; idx < end && !cancelled; ++idx)
+        {
+            const DisplayViewProcessorDesc & desc = processors[idx];
+
+            try
+            {
+                ConstProcessorRcPtr processor;
+
+                if (desc.m_looks.empty())
                 {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
-                    {
-                        processor = entry.second;
-                        break;
-                    }
+                    processor = getProcessor(context,
+                                             desc.m_srcColorSpace.c_str(),
+                                             desc.m_display.c_str(),
+                                             desc.m_view.c_str(),
+                                             TRANSFORM_DIR_FORWARD);
+                }
+                else
+                {
+                    DisplayViewTransformRcPtr dt = DisplayViewTransform::Create();
+                    dt->setSrc(desc.m_srcColorSpace.c_str());
+                    dt->setDisplay(desc.m_display.c_str());
+                    dt->setView(desc.m_view.c_str());
+
+                    LegacyViewingPipelineRcPtr pipeline = LegacyViewingPipeline::Create();
+                    pipeline->setDisplayViewTransform(dt);
+                    pipeline->setLooksOverrideEnabled(true);
+                    pipeline->setLooksOverride(desc.m_looks.c_str());
+
+                    processor = pipeline->getProcessor(config, context);
                 }
+
+                // Also build the default CPU & GPU processors.
+                processor->getDefaultCPUProcessor();
+                processor->getDefaultGPUProcessor();
+
+                ++numBuilt;
+            }
+            catch (const Exception & e)
+            {
+                std::ostringstream oss;
+                oss << "Could not warm up the processor of the color space '"
+                    << desc.m_srcColorSpace << "' with the display '" << desc.m_display
+                    << "' and the view '" << desc.m_view << "': " << e.what();
+                LogWarning(oss.str());
             }
 
-            if (!processor)
+            if (callback)
             {
-                processor = proc;
+                AutoMutex guard(callbackMutex);
+                if (!cancelled && !callback(++numDone, numTotal))
+                {
+                    cancelled = true;
+                }
             }
         }
+    });
 
-        return processor;
+    return numBuilt;
+}
+
+size_t Config::warmUpProcessors(const ConstContextRcPtr & context,
+                                const char * srcColorSpaceName,
+                                const ProcessorWarmUpCallback & callback) const
+{
+    if (!srcColorSpaceName || !*srcColorSpaceName)
+    {
+        throw Exception("Config::warmUpProcessors failed. Source color space name is empty.");
     }
-    else
+
+    DisplayViewProcessorDescVec processors;
+
+    for (int displayIdx = 0; displayIdx < getNumDisplays(); ++displayIdx)
     {
-        return CreateProcessor(*this, context, transform, direction);
+        const char * display = getDisplay(displayIdx);
+
+        for (int viewIdx = 0; viewIdx < getNumViews(display, srcColorSpaceName); ++viewIdx)
+        {
+            DisplayViewProcessorDesc desc;
+            desc.m_srcColorSpace = srcColorSpaceName;
+            desc.m_display       = display;
+            desc.m_view          = getView(display, srcColorSpaceName, viewIdx);
+
+            processors.push_back(desc);
+        }
     }
+
+    return warmUpProcessors(context, processors, callback);
 }
 
 ConstProcessorRcPtr Config::GetProcessorFromConfigs(const ConstConfigRcPtr & srcConfig,
@@ -4890,14 +5091,9 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
     {
         std::ostringstream filehash;
 
-        ConstTransformVec allTransforms;
-        getImpl()->getAllInternalTransforms(allTransforms);
-
+        // Note that the lazy color space transforms are not loaded.
         std::set<std::string> files;
-        for(const auto & transform : allTransforms)
-        {
-            GetFileReferences(files, transform);
-        }
+        ConfigUtils::GetFileReferences(files, *this);
 
         for(const auto & iter : files)
         {
@@ -4954,9 +5150,15 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) const noexcept
     getImpl()->setProcessorCacheFlags(flags);
 }
 
+void Config::setProcessorCacheLimits(size_t maxEntries, size_t maxMemorySize) const noexcept
+{
+    getImpl()->m_processorCache.setLimits(maxEntries, maxMemorySize);
+}
+
 void Config::clearProcessorCache() noexcept
 {
     getImpl()->m_processorCache.clear();
+    getImpl()->m_processorCacheIDIndex.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -5022,6 +5224,22 @@ StringUtils::StringVec Config::Impl::buildInactiveNamesList(InactiveType type) c
     return res;
 }
 
+void Config::Impl::refreshActiveColorSpaces(const std::string & appendedName)
+{
+    // Only the new color space could change the inactive list (e.g. when one of the inactive
+    // names is one of its aliases). Note that a full refresh for each color space makes the
+    // loading of large configs quadratic.
+    StringUtils::StringVec inactiveNames = buildInactiveNamesList(Impl::INACTIVE_COLORSPACE);
+    if (std::find(inactiveNames.begin(), inactiveNames.end(), appendedName) != inactiveNames.end())
+    {
+        refreshActiveColorSpaces();
+    }
+    else
+    {
+        m_activeColorSpaceNames.push_back(appendedName);
+    }
+}
+
 void Config::Impl::refreshActiveColorSpaces()
 {
     m_activeColorSpaceNames.clear();
@@ -5085,13 +5303,15 @@ void Config::Impl::resetCacheIDs()
     // As any changes could impact the cache keys, it's better to always flush the cache
     // of processors to not keep in memory useless instances.
     m_processorCache.clear();
+    m_processorCacheIDIndex.clear();
 }
 
-void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
+void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec,
+                                            bool withColorSpaces) const
 {
     // Grab all transforms from the ColorSpaces.
 
-    for (int i = 0; i < m_allColorSpaces->getNumColorSpaces(); ++i)
+    for (int i = 0; withColorSpaces && i < m_allColorSpaces->getNumColorSpaces(); ++i)
     {
         ConstTransformRcPtr tr
             = m_allColorSpaces->getColorSpaceByIndex(i)->getTransform(COLORSPACE_DIR_TO_REFERENCE);
@@ -5159,12 +5379,37 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
     }
 }
 
+std::string Config::Impl::ReadYaml(std::istream & istream,
+                                   ConfigRcPtr & config,
+                                   const char * filename,
+                                   bool lazy)
+{
+    if (!lazy)
+    {
+        OCIOYaml::Read(istream, config, filename, lazy);
+        return "";
+    }
+
+    // The serialization used by the cache ID would load all the lazy transforms so the ID of the
+    // unmodified config is the hash of its YAML content.
+    std::ostringstream oss;
+    oss << istream.rdbuf();
+    const std::string content = oss.str();
+
+    std::istringstream iss(content);
+    OCIOYaml::Read(iss, config, filename, lazy);
+
+    return CacheIDHash(content.c_str(), content.size());
+}
+
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
 {
+    const bool lazy = IsLazyLoadingEnabled();
+
     ConfigRcPtr config = Config::Create();
-    OCIOYaml::Read(istream, config, filename);
+    const std::string contentCacheID = ReadYaml(istream, config, filename, lazy);
 
-    config->getImpl()->checkVersionConsistency();
+    config->getImpl()->checkVersionConsistency(lazy);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5172,6 +5417,9 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filenam
     config->getImpl()->m_inactiveColorSpaceNamesAPI.clear();
     config->getImpl()->refreshActiveColorSpaces();
 
+    // Note that any config change resets it.
+    config->getImpl()->m_cacheidnocontext = contentCacheID;
+
     return config;
 }
 
@@ -5181,9 +5429,11 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr c
     // Passing special string for the file path to enable the parser to provide a more
     // meaningful error message if a problem is encountered.  (The working directory is not
     // set to this string.)
-    OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy");
+    const bool lazy = IsLazyLoadingEnabled();
+    const std::string contentCacheID
+        = ReadYaml(istream, config, "from Archive/ConfigIOProxy", lazy);
 
-    config->getImpl()->checkVersionConsistency();
+    config->getImpl()->checkVersionConsistency(lazy);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5194,6 +5444,9 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr c
     // Set the ConfigIOProxy object.
     config->setConfigIOProxy(ciop);
 
+    // Note that any config change resets it.
+    config->getImpl()->m_cacheidnocontext = contentCacheID;
+
     return config;
 }
 
@@ -5201,6 +5454,8 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
 {
     if (transform)
     {
+        ThrowIfLazyLoadingFailed(transform);
+
         if (ConstBuiltinTransformRcPtr blt = DynamicPtrCast<const BuiltinTransform>(transform))
         {
             if (m_majorVersion < 2)
@@ -5369,12 +5624,12 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
     }
 }
 
-void Config::Impl::checkVersionConsistency() const
+void Config::Impl::checkVersionConsistency(bool lazyLoaded) const
 {
     // Check for the Transforms.
 
     ConstTransformVec transforms;
-    getAllInternalTransforms(transforms);
+    getAllInternalTransforms(transforms, !lazyLoaded);
 
     for (auto & transform : transforms)
     {
@@ -5541,7 +5796,7 @@ bool Config::isArchivable() const
     std::set<std::string> files;
     for(const auto & transform : allTransforms)
     {
-        GetFileReferences(files, transform);
+        ConfigUtils::GetFileReferences(files, transform);
     }
 
     // Check that FileTransform sources are not absolute nor have context variables outside of 
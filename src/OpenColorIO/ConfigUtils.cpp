@@ -4,6 +4,7 @@
 #include <pystring.h>
 
 #include "ConfigUtils.h"
+#include "LazyTransform.h"
 #include "MathUtils.h"
 #include "utils/StringUtils.h"
 
@@ -836,6 +837,67 @@ const char * IdentifyBuiltinColorSpace(const ConstConfigRcPtr & srcConfig,
     throw Exception(os.str().c_str());
 }
 
+void GetFileReferences(std::set<std::string> & files, const ConstTransformRcPtr & transform)
+{
+    if(!transform) return;
+
+    if(ConstGroupTransformRcPtr groupTransform = \
+        DynamicPtrCast<const GroupTransform>(transform))
+    {
+        for(int i=0; i<groupTransform->getNumTransforms(); ++i)
+        {
+            GetFileReferences(files, groupTransform->getTransform(i));
+        }
+    }
+    else if(ConstFileTransformRcPtr fileTransform = \
+        DynamicPtrCast<const FileTransform>(transform))
+    {
+        files.insert(fileTransform->getSrc());
+    }
+}
+
+void GetFileReferences(std::set<std::string> & files, const Config & config)
+{
+    for (int i = 0; i < config.getNumColorSpaces(SEARCH_REFERENCE_SPACE_ALL, COLORSPACE_ALL); ++i)
+    {
+        ConstColorSpaceRcPtr cs = config.getColorSpace(
+            config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL, COLORSPACE_ALL, i));
+
+        for (const auto dir : { COLORSPACE_DIR_TO_REFERENCE, COLORSPACE_DIR_FROM_REFERENCE })
+        {
+            ConstTransformRcPtr transform = GetUnloadedColorSpaceTransform(*cs, dir);
+
+            auto lazy = DynamicPtrCast<const LazyTransform>(transform);
+            if (!lazy || !lazy->getUnloadedFileReferences(files))
+            {
+                GetFileReferences(files, cs->getTransform(dir));
+            }
+        }
+    }
+
+    for (int i = 0; i < config.getNumLooks(); ++i)
+    {
+        ConstLookRcPtr look = config.getLook(config.getLookNameByIndex(i));
+        GetFileReferences(files, look->getTransform());
+        GetFileReferences(files, look->getInverseTransform());
+    }
+
+    for (int i = 0; i < config.getNumViewTransforms(); ++i)
+    {
+        ConstViewTransformRcPtr vt = config.getViewTransform(config.getViewTransformNameByIndex(i));
+        GetFileReferences(files, vt->getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE));
+        GetFileReferences(files, vt->getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE));
+    }
+
+    for (int i = 0; i < config.getNumNamedTransforms(NAMEDTRANSFORM_ALL); ++i)
+    {
+        ConstNamedTransformRcPtr nt
+            = config.getNamedTransform(config.getNamedTransformNameByIndex(NAMEDTRANSFORM_ALL, i));
+        GetFileReferences(files, nt->getTransform(TRANSFORM_DIR_FORWARD));
+        GetFileReferences(files, nt->getTransform(TRANSFORM_DIR_INVERSE));
+    }
+}
+
 }  // namespace ConfigUtils
 
 }  // namespace OCIO_NAMESPACE
@@ -4,6 +4,9 @@
 #ifndef INCLUDED_OCIO_CONFIG_UTILS_H
 #define INCLUDED_OCIO_CONFIG_UTILS_H
 
+#include <set>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 namespace OCIO_NAMESPACE
@@ -31,6 +34,13 @@ const char * IdentifyBuiltinColorSpace(const ConstConfigRcPtr & srcConfig,
                                        const ConstConfigRcPtr & builtinConfig, 
                                        const char * builtinColorSpaceName);
 
+// Collect the sources of the FileTransforms of a transform (including the ones of its groups).
+void GetFileReferences(std::set<std::string> & files, const ConstTransformRcPtr & transform);
+
+// Collect the sources of the FileTransforms of all the config transforms. Note that it does not
+// load the lazy color space transforms (refer to LazyTransform).
+void GetFileReferences(std::set<std::string> & files, const Config & config);
+
 // Temporarily deactivate the Processor cache on a Config object.
 // Currently, this also clears the cache.
 //
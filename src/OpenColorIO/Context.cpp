@@ -28,7 +28,8 @@ void GetAbsoluteSearchPaths(StringUtils::StringVec & searchpaths,
                             const StringUtils::StringVec & pathStrings,
                             const std::string & configRootDir,
                             const EnvMap & map,
-                            UsedEnvs & envs);
+                            UsedEnvs & envs,
+                            std::string & steps);
 }
 
 class Context::Impl
@@ -45,8 +46,24 @@ public:
 
     mutable std::string m_cacheID;
 
-    // Cache for resolved strings containing context variables.
-    using ResolvedStringCache = std::map<std::string, std::pair<std::string, UsedEnvs>>;
+    // The context variables contribute to the cache identifier through the sum of their hashes
+    // so that a context variable change does not need to visit all the other ones.
+    uint64_t m_envHashLow  = 0;
+    uint64_t m_envHashHigh = 0;
+
+    struct ResolvedString
+    {
+        std::string m_value;
+        // The context variables used to resolve the string.
+        UsedEnvs m_usedEnvs;
+        // The successive expansions of the string (refer to ResolveContextVariables()) to find
+        // the entries a new context variable could change.
+        std::string m_steps;
+    };
+
+    // Cache for resolved strings containing context variables. The context variable changes
+    // only remove the entries they could change.
+    using ResolvedStringCache = std::map<std::string, ResolvedString>;
     mutable ResolvedStringCache m_resultsStringCache;
     // Cache for resolved & expanded file paths containing context variables.
     mutable ResolvedStringCache m_resultsFilepathCache;
@@ -72,7 +89,9 @@ public:
             m_resultsStringCache   = rhs.m_resultsStringCache;
             m_resultsFilepathCache = rhs.m_resultsFilepathCache;
 
-            m_cacheID = rhs.m_cacheID;
+            m_cacheID     = rhs.m_cacheID;
+            m_envHashLow  = rhs.m_envHashLow;
+            m_envHashHigh = rhs.m_envHashHigh;
 
             m_configIOProxy = rhs.m_configIOProxy;
         }
@@ -88,36 +107,29 @@ public:
         }
 
         ResolvedStringCache::const_iterator iter = m_resultsStringCache.find(string);
-        if (iter != m_resultsStringCache.end())
+        if (iter == m_resultsStringCache.end())
         {
-            if (usedContextVars)
-            {
-                // Collect the used context variables.
-                for (const auto & var : iter->second.second)
-                {
-                    usedContextVars->setStringVar(var.first.c_str(), var.second.c_str());
-                }
-            }
-
-            return iter->second.first.c_str();
+            // Search some context variables to replace.
+            ResolvedString resolved;
+            resolved.m_value = ResolveContextVariables(string,
+                                                       m_envMap,
+                                                       resolved.m_usedEnvs,
+                                                       resolved.m_steps);
+
+            iter = m_resultsStringCache.emplace(string, std::move(resolved)).first;
         }
 
-        // Search some context variables to replace.
-        UsedEnvs envs;
-        const std::string resolvedString = ResolveContextVariables(string, m_envMap, envs);
-        m_resultsStringCache[string] = std::make_pair(resolvedString, envs);
-
         if (usedContextVars)
         {
-            // Record all the used context variables.
-            for (const auto & var : envs)
+            // Collect the used context variables.
+            for (const auto & var : iter->second.m_usedEnvs)
             {
                 usedContextVars->setStringVar(var.first.c_str(), var.second.c_str());
             }
         }
 
         // Return the resolved string.
-        return m_resultsStringCache[string].first.c_str();
+        return iter->second.m_value.c_str();
     }
 
     void clearCaches()
@@ -126,6 +138,58 @@ public:
         m_resultsFilepathCache.clear();
         m_cacheID.clear();     
     }
+
+    // Remove the cache entries a context variable change could modify i.e. the ones using the
+    // variable or, for a new variable, the ones where its name appears.
+    void clearCaches(const std::string & name, bool newVariable)
+    {
+        for (auto cache : { &m_resultsStringCache, &m_resultsFilepathCache })
+        {
+            for (auto it = cache->begin(); it != cache->end();)
+            {
+                const bool stale = newVariable
+                    ? it->second.m_steps.find(name) != std::string::npos
+                    : it->second.m_usedEnvs.find(name) != it->second.m_usedEnvs.end();
+
+                it = stale ? cache->erase(it) : std::next(it);
+            }
+        }
+
+        m_cacheID.clear();
+    }
+
+    void updateEnvHash(const std::string & name, const std::string & value, bool add)
+    {
+        std::string var = name;
+        var.push_back('\0');
+        var += value;
+
+        uint64_t low64 = 0, high64 = 0;
+        CacheIDHash(var.c_str(), var.size(), low64, high64);
+
+        // Note that the unsigned integer overflows are well defined.
+        if (add)
+        {
+            m_envHashLow  += low64;
+            m_envHashHigh += high64;
+        }
+        else
+        {
+            m_envHashLow  -= low64;
+            m_envHashHigh -= high64;
+        }
+    }
+
+    void computeEnvHash()
+    {
+        m_envHashLow  = 0;
+        m_envHashHigh = 0;
+
+        for (const auto & var : m_envMap)
+        {
+            updateEnvHash(var.first, var.second, true);
+        }
+    }
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -178,12 +242,9 @@ const char * Context::getCacheID() const
         cacheid << "Working Dir " << getImpl()->m_workingDir << " ";
         cacheid << "Environment Mode " << getImpl()->m_envmode << " ";
 
-        for (EnvMap::const_iterator iter = getImpl()->m_envMap.begin(),
-                end = getImpl()->m_envMap.end();
-                iter != end; ++iter)
-        {
-            cacheid << iter->first << "=" << iter->second << " ";
-        }
+        // The context variables are summarized by the sum of their hashes.
+        cacheid << "Environment " << std::hex << getImpl()->m_envHashLow << " "
+                << getImpl()->m_envHashHigh;
 
         std::string fullstr = cacheid.str();
         getImpl()->m_cacheID = CacheIDHash(fullstr.c_str(), fullstr.size());
@@ -282,6 +343,7 @@ void Context::loadEnvironment() noexcept
     LoadEnvironment(getImpl()->m_envMap, update);
 
     AutoMutex lock(getImpl()->m_resultsCacheMutex);
+    getImpl()->computeEnvHash();
     getImpl()->clearCaches();
 }
 
@@ -294,38 +356,39 @@ void Context::setStringVar(const char * name, const char * value) noexcept
 
     AutoMutex lock(getImpl()->m_resultsCacheMutex);
 
+    EnvMap::iterator iter = getImpl()->m_envMap.find(name);
+
     // Set the value if specified.
     if (value)
     {
-        EnvMap::iterator iter = getImpl()->m_envMap.find(name);
         if (iter != getImpl()->m_envMap.end())
         {
             if (0 != strcmp(iter->second.c_str(), value))
             {
+                getImpl()->updateEnvHash(iter->first, iter->second, false);
                 iter->second = value;
+                getImpl()->updateEnvHash(iter->first, iter->second, true);
+
+                getImpl()->clearCaches(name, false);
             }
-            else
-            {
-                // Do not flush the cache because nothing changed.
-                return;
-            }
+            // Otherwise, do not flush the cache because nothing changed.
         }
         else
         {
             getImpl()->m_envMap[name] = value;
+            getImpl()->updateEnvHash(name, value, true);
+
+            getImpl()->clearCaches(name, true);
         }
     }
     // If a null value is specified, erase it.
-    else
+    else if (iter != getImpl()->m_envMap.end())
     {
-        EnvMap::const_iterator iter = getImpl()->m_envMap.find(name);
-        if (iter != getImpl()->m_envMap.end())
-        {
-            getImpl()->m_envMap.erase(iter);
-        }
-    }
+        getImpl()->updateEnvHash(iter->first, iter->second, false);
+        getImpl()->m_envMap.erase(iter);
 
-    getImpl()->clearCaches();
+        getImpl()->clearCaches(name, false);
+    }
 }
 
 const char * Context::getStringVar(const char * name) const noexcept
@@ -381,7 +444,11 @@ void Context::addStringVars(const ConstContextRcPtr & ctx) noexcept
 
 void Context::clearStringVars()
 {
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
     getImpl()->m_envMap.clear();
+    getImpl()->computeEnvHash();
+    getImpl()->clearCaches();
 }
 
 const char * Context::resolveStringVar(const char * string) const  noexcept
@@ -428,14 +495,14 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
         if (usedContextVars)
         {
             // Collect all the used context variables from the search_paths if any.
-            const UsedEnvs envs = iter->second.second;
+            const UsedEnvs envs = iter->second.m_usedEnvs;
             for (const auto & var : envs)
             {
                 usedContextVars->setStringVar(var.first.c_str(), var.second.c_str());
             }
         }
 
-        return iter->second.first.c_str();
+        return iter->second.m_value.c_str();
     }
 
     // If the file reference is absolute, check if the file exists (independent of the search paths).
@@ -444,14 +511,14 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
         if(FileExists(resolvedFilename, *this))
         {
             // That's already an absolute path so no extra context variables are present.
-            UsedEnvs envs;
+            Impl::ResolvedString resolved;
+            resolved.m_value = pystring::os::path::normpath(resolvedFilename);
 
             // Note that the filepath cache key is the 'resolvedFilename'.
 
-            getImpl()->m_resultsFilepathCache[resolvedFilename] 
-                = std::make_pair(pystring::os::path::normpath(resolvedFilename), envs);
+            getImpl()->m_resultsFilepathCache[resolvedFilename] = resolved;
 
-            return getImpl()->m_resultsFilepathCache[resolvedFilename].first.c_str();
+            return getImpl()->m_resultsFilepathCache[resolvedFilename].m_value.c_str();
         }
 
         std::ostringstream errortext;
@@ -464,6 +531,7 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
 
     // The search_paths could contain some context variables.
     UsedEnvs envs;
+    std::string steps;
 
     // TODO: Used context variables from GetAbsoluteSearchPaths() are from all the search_paths 
     // of the config i.e. it does not mean that all of them are used to resolve a FileTransform
@@ -477,7 +545,8 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
                            getImpl()->m_searchPaths,
                            getImpl()->m_workingDir,
                            getImpl()->m_envMap,
-                           envs);
+                           envs,
+                           steps);
 
     // Loop over each path, and try to find the file
     std::ostringstream errortext;
@@ -501,10 +570,14 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
             }
 
             // Add to the cache.
-            getImpl()->m_resultsFilepathCache[resolvedFilename]
-                = std::make_pair(pystring::os::path::normpath(resolvedfullpath), envs);
+            Impl::ResolvedString resolved;
+            resolved.m_value    = pystring::os::path::normpath(resolvedfullpath);
+            resolved.m_usedEnvs = envs;
+            resolved.m_steps    = steps;
+
+            getImpl()->m_resultsFilepathCache[resolvedFilename] = resolved;
 
-            return getImpl()->m_resultsFilepathCache[resolvedFilename].first.c_str();
+            return getImpl()->m_resultsFilepathCache[resolvedFilename].m_value.c_str();
         }
 
         if(i!=0) errortext << " : ";
@@ -556,7 +629,8 @@ void GetAbsoluteSearchPaths(StringUtils::StringVec & searchpaths,
                             const StringUtils::StringVec & pathStrings,
                             const std::string & workingDir,
                             const EnvMap & map,
-                            UsedEnvs & envs)
+                            UsedEnvs & envs,
+                            std::string & steps)
 {
     if(pathStrings.empty())
     {
@@ -569,7 +643,7 @@ void GetAbsoluteSearchPaths(StringUtils::StringVec & searchpaths,
     for (unsigned int i = 0; i < pathStrings.size(); ++i)
     {
         // Resolve variables in case the expansion adds slashes
-        const std::string resolved = ResolveContextVariables(pathStrings[i], map, envs);
+        const std::string resolved = ResolveContextVariables(pathStrings[i], map, envs, steps);
 
         // Remove trailing "/", and spaces
         std::string dirname = StringUtils::RightTrim(StringUtils::Trim(resolved), '/');
@@ -122,7 +122,13 @@ void LoadEnvironment(EnvMap & map, bool update)
     }
 }
 
-std::string ResolveContextVariables(const std::string & str, const EnvMap & map, UsedEnvs & used)
+namespace
+{
+
+std::string ResolveContextVariablesImpl(const std::string & str,
+                                        const EnvMap & map,
+                                        UsedEnvs & used,
+                                        std::string * steps)
 {
     // Early exit if no reserved tokens are found.
     if (!ContainsContextVariables(str))
@@ -133,6 +139,20 @@ std::string ResolveContextVariables(const std::string & str, const EnvMap & map,
     std::string orig = str;
     std::string newstr = str;
 
+    // Record a step, if needed, each time the string changes.
+    auto replace = [&newstr, &used, steps](const std::string & token, const EnvMap::value_type & entry)
+    {
+        if (StringUtils::ReplaceInPlace(newstr, token, entry.second))
+        {
+            used[entry.first] = entry.second;
+            if (steps)
+            {
+                steps->append(newstr);
+                steps->push_back('\0');
+            }
+        }
+    };
+
     // This walks through the envmap in key order,
     // from longest to shortest to handle envvars which are
     // substrings.
@@ -140,31 +160,41 @@ std::string ResolveContextVariables(const std::string & str, const EnvMap & map,
 
     for (const auto & entry : map)
     {
-        if (StringUtils::ReplaceInPlace(newstr, ("${"+ entry.first + "}"), entry.second))
-        {
-            used[entry.first] = entry.second;
-        }
-
-        if (StringUtils::ReplaceInPlace(newstr, ("$" + entry.first),       entry.second))
-        {
-            used[entry.first] = entry.second;
-        }
-
-        if (StringUtils::ReplaceInPlace(newstr, ("%" + entry.first + "%"), entry.second))
-        {
-            used[entry.first] = entry.second;
-        }
+        replace("${"+ entry.first + "}", entry);
+        replace("$" + entry.first,       entry);
+        replace("%" + entry.first + "%", entry);
     }
 
     // recursively call till string doesn't expand anymore
     if(newstr != orig)
     {
-        return ResolveContextVariables(newstr, map, used);
+        return ResolveContextVariablesImpl(newstr, map, used, steps);
     }
 
     return orig;
 }
 
+} // anon.
+
+std::string ResolveContextVariables(const std::string & str, const EnvMap & map, UsedEnvs & used)
+{
+    return ResolveContextVariablesImpl(str, map, used, nullptr);
+}
+
+std::string ResolveContextVariables(const std::string & str,
+                                    const EnvMap & map,
+                                    UsedEnvs & used,
+                                    std::string & steps)
+{
+    if (ContainsContextVariables(str))
+    {
+        steps.append(str);
+        steps.push_back('\0');
+    }
+
+    return ResolveContextVariablesImpl(str, map, used, &steps);
+}
+
 bool CollectContextVariables(const Config & config, 
                              const Context & context,
                              ConstTransformRcPtr transform,
@@ -53,6 +53,14 @@ typedef std::map<std::string, std::string> UsedEnvs;
 // TODO: Keep the resolution order?
 std::string ResolveContextVariables(const std::string & str, const EnvMap & map, UsedEnvs & envs);
 
+// Same as above but it also appends to steps the string and all its successive expansions (each
+// one followed by a null character) when the string contains context variables. Adding a new
+// context variable can only change the resolved string if its name appears in the steps.
+std::string ResolveContextVariables(const std::string & str,
+                                    const EnvMap & map,
+                                    UsedEnvs & envs,
+                                    std::string & steps);
+
 
 // Return true if an instance of a transform uses a context variable, either directly or indirectly. 
 // Add any context variables that are used to usedContextVars.
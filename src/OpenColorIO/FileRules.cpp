@@ -15,6 +15,7 @@
 #include "Logging.h"
 #include "PathUtils.h"
 #include "Platform.h"
+#include "ThreadPool.h"
 #include "utils/StringUtils.h"
 
 
@@ -260,7 +261,11 @@ std::string BuildRegularExpression(const char * filePathPattern, const char * fi
     return res;
 }
 
-void ValidateRegularExpression(const char * regex)
+using RegexRcPtr = OCIO_SHARED_PTR<const std::regex>;
+
+// Compile the regular expression once for all the matches. Note that a compiled regular
+// expression could be used by several threads at the same time.
+RegexRcPtr CompileRegularExpression(const char * regex)
 {
     if (!regex || !*regex)
     {
@@ -270,7 +275,7 @@ void ValidateRegularExpression(const char * regex)
     try
     {
         // Throws an exception if the expression is ill-formed.
-        const std::regex reg(regex);
+        return std::make_shared<const std::regex>(regex);
     }
     catch (std::regex_error & ex)
     {
@@ -284,14 +289,95 @@ void ValidateRegularExpression(const char * regex)
     }
 }
 
-void ValidateRegularExpression(const char * filePathPattern, const char * fileNameExtension)
+RegexRcPtr CompileRegularExpression(const char * filePathPattern, const char * fileNameExtension)
 {
     const std::string exp = BuildRegularExpression(filePathPattern, fileNameExtension);
-    ValidateRegularExpression(exp.c_str());
+    return CompileRegularExpression(exp.c_str());
+}
+
+// The '.' of the regular expressions does not match the line terminators.
+bool HasLineTerminator(const char * path)
+{
+    return strpbrk(path, "\n\r") != nullptr;
 }
 
 }
 
+// Matcher of the most common glob rules without using any regular expression (i.e. without
+// backtracking). The file path pattern must be a literal prefix optionally followed by a '*'
+// (e.g. "*" or "/mnt/plates/*") and the extension must be literal or '*' (e.g. "exr" or "*").
+// The extension comparison ignores the case as done by the regular expression.
+class SimpleGlobMatcher
+{
+public:
+    // Return false if the pattern or the extension is not simple enough.
+    bool build(const std::string & filePathPattern, const std::string & fileNameExtension)
+    {
+        static constexpr char GlobChars[] = "*?[]\\";
+
+        std::string prefix = filePathPattern;
+        bool anyMiddle = prefix.empty();
+        if (!prefix.empty() && prefix.back() == '*')
+        {
+            prefix.pop_back();
+            anyMiddle = true;
+        }
+
+        const bool anyExtension = fileNameExtension.empty() || fileNameExtension == "*";
+
+        if (prefix.find_first_of(GlobChars) != std::string::npos
+            || (!anyExtension && fileNameExtension.find_first_of(GlobChars) != std::string::npos))
+        {
+            return false;
+        }
+
+        m_prefix       = prefix;
+        m_anyMiddle    = anyMiddle;
+        m_anyExtension = anyExtension;
+        m_extension    = anyExtension ? "" : "." + StringUtils::Lower(fileNameExtension);
+
+        return true;
+    }
+
+    bool matches(const char * path) const
+    {
+        const size_t length = strlen(path);
+        if (length < m_prefix.size() || 0 != strncmp(path, m_prefix.c_str(), m_prefix.size()))
+        {
+            return false;
+        }
+
+        const char * rest = path + m_prefix.size();
+        const size_t restLength = length - m_prefix.size();
+
+        if (m_anyExtension)
+        {
+            return m_anyMiddle ? strchr(rest, '.') != nullptr : rest[0] == '.';
+        }
+
+        if (restLength < m_extension.size() || (!m_anyMiddle && restLength != m_extension.size()))
+        {
+            return false;
+        }
+
+        const char * ext = rest + restLength - m_extension.size();
+        for (size_t idx = 0; idx < m_extension.size(); ++idx)
+        {
+            if (tolower((unsigned char)ext[idx]) != m_extension[idx])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::string m_prefix;
+    std::string m_extension; // Lower case extension including the dot.
+    bool m_anyMiddle    = false;
+    bool m_anyExtension = false;
+};
+
 class FileRule
 {
 public:
@@ -329,6 +415,7 @@ public:
             m_pattern   = "*";
             m_extension = "*";
             m_type      = FILE_RULE_GLOB;
+            compileGlob(CompileRegularExpression(m_pattern.c_str(), m_extension.c_str()));
         }
     }
 
@@ -343,6 +430,11 @@ public:
         rule->m_regex      = m_regex;
         rule->m_type       = m_type;
 
+        // The compiled matchers are immutable so they could be shared.
+        rule->m_compiledRegex = m_compiledRegex;
+        rule->m_simpleGlob    = m_simpleGlob;
+        rule->m_isSimpleGlob  = m_isSimpleGlob;
+
         return rule;
     }
 
@@ -376,10 +468,11 @@ public:
             {
                 throw Exception("File rules: The file name pattern is empty.");
             }
-            ValidateRegularExpression(pattern, m_extension.c_str());
+            RegexRcPtr regex = CompileRegularExpression(pattern, m_extension.c_str());
             m_pattern = pattern;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            compileGlob(regex);
         }
     }
 
@@ -408,10 +501,11 @@ public:
             {
                 throw Exception("File rules: The file extension pattern is empty.");
             }
-            ValidateRegularExpression(m_pattern.c_str(), extension);
+            RegexRcPtr regex = CompileRegularExpression(m_pattern.c_str(), extension);
             m_extension = extension;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            compileGlob(regex);
         }
     }
 
@@ -436,7 +530,8 @@ public:
         }
         else
         {
-            ValidateRegularExpression(regex);
+            m_compiledRegex = CompileRegularExpression(regex);
+            m_isSimpleGlob = false;
             m_regex = regex;
             m_pattern = "";
             m_extension = "";
@@ -471,38 +566,61 @@ public:
 
     bool matches(const Config & config, const char * path) const
     {
-        switch (m_type)
-        {
-        case FILE_RULE_DEFAULT:
-            return true;
-        case FILE_RULE_PARSE_FILEPATH:
+        if (m_type == FILE_RULE_PARSE_FILEPATH)
         {
-            const int rightMostColorSpaceIndex = ParseColorSpaceFromString(config, path);
-            if (rightMostColorSpaceIndex >= 0)
+            const char * colorSpace = parseColorSpace(config, path);
+            if (colorSpace)
             {
-                m_colorSpace = config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL,
-                                                               COLORSPACE_ALL,
-                                                               rightMostColorSpaceIndex);
+                m_colorSpace = colorSpace;
                 return true;
             }
             return false;
         }
-        case FILE_RULE_REGEX:
+
+        return matchesPattern(path);
+    }
+
+    bool isPathSearchRule() const noexcept
+    {
+        return m_type == FILE_RULE_PARSE_FILEPATH;
+    }
+
+    // Match the path with the default, regex or glob rule. Note that it's thread-safe.
+    bool matchesPattern(const char * path) const
+    {
+        switch (m_type)
         {
-            const std::regex reg(m_regex.c_str());
-            return regex_match(path, reg);
-        }
+        case FILE_RULE_DEFAULT:
+            return true;
+        case FILE_RULE_PARSE_FILEPATH:
+            return false;
+        case FILE_RULE_REGEX:
         case FILE_RULE_GLOB:
         {
-            const std::string exp = BuildRegularExpression(m_pattern.c_str(),
-                                                           m_extension.c_str());
-            const std::regex reg(exp.c_str());
-            return regex_match(path, reg);
+            if (m_isSimpleGlob && !HasLineTerminator(path))
+            {
+                return m_simpleGlob.matches(path);
+            }
+            return std::regex_match(path, *m_compiledRegex);
         }
         }
         return false;
     }
 
+    // Get the color space found in the path by the ColorSpaceNamePathSearch rule, or null.
+    // Note that it's thread-safe.
+    static const char * parseColorSpace(const Config & config, const char * path)
+    {
+        const int rightMostColorSpaceIndex = ParseColorSpaceFromString(config, path);
+        if (rightMostColorSpaceIndex >= 0)
+        {
+            return config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL,
+                                                   COLORSPACE_ALL,
+                                                   rightMostColorSpaceIndex);
+        }
+        return nullptr;
+    }
+
     void validate(const Config & cfg) const
     {
         if (m_type != FILE_RULE_PARSE_FILEPATH)
@@ -532,6 +650,17 @@ private:
     std::string m_extension;
     std::string m_regex;
     RuleType m_type{ FILE_RULE_GLOB };
+
+    // The matchers are built when the pattern, the extension or the regex changes.
+    void compileGlob(const RegexRcPtr & regex)
+    {
+        m_compiledRegex = regex;
+        m_isSimpleGlob  = m_simpleGlob.build(m_pattern, m_extension);
+    }
+
+    RegexRcPtr m_compiledRegex;
+    SimpleGlobMatcher m_simpleGlob;
+    bool m_isSimpleGlob{ false };
 };
 
 FileRules::FileRules()
@@ -907,6 +1036,51 @@ bool FileRules::Impl::filepathOnlyMatchesDefaultRule(const Config & config, cons
     return (rulePos + 1) == m_rules.size();
 }
 
+void FileRules::Impl::getColorSpacesFromFilepaths(const Config & config,
+                                                  const std::vector<std::string> & filePaths,
+                                                  std::vector<std::string> & colorSpaces,
+                                                  std::vector<size_t> & ruleIndices) const
+{
+    const size_t numPaths = filePaths.size();
+
+    colorSpaces.assign(numPaths, std::string());
+    ruleIndices.assign(numPaths, m_rules.size() - 1);
+
+    // Processing a path is fast so each thread processes a batch of paths.
+    static constexpr long ChunkSize = 256;
+
+    GetThreadPool().parallelFor(long(numPaths), ChunkSize, 0, [&](long begin, long end, unsigned)
+    {
+        for (long idx = begin; idx < end; ++idx)
+        {
+            const char * path = filePaths[idx].c_str();
+
+            for (size_t r = 0; r < m_rules.size(); ++r)
+            {
+                // Unlike matches(), the ColorSpaceNamePathSearch rule does not keep the color
+                // space so that several threads could use it.
+                const char * colorSpace = m_rules[r]->isPathSearchRule()
+                                              ? FileRule::parseColorSpace(config, path)
+                                              : (m_rules[r]->matchesPattern(path)
+                                                     ? m_rules[r]->getColorSpace()
+                                                     : nullptr);
+                if (colorSpace)
+                {
+                    colorSpaces[idx] = colorSpace;
+                    ruleIndices[idx] = r;
+                    break;
+                }
+            }
+
+            if (colorSpaces[idx].empty())
+            {
+                // Should not be reached since the default rule always matches.
+                colorSpaces[idx] = m_rules.back()->getColorSpace();
+            }
+        }
+    });
+}
+
 std::ostream & operator<< (std::ostream & os, const FileRules & fr)
 {
     const size_t numRules = fr.getNumEntries();
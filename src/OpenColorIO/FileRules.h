@@ -59,6 +59,11 @@ public:
 
     bool filepathOnlyMatchesDefaultRule(const Config & config, const char * filePath) const;
 
+    void getColorSpacesFromFilepaths(const Config & config,
+                                     const std::vector<std::string> & filePaths,
+                                     std::vector<std::string> & colorSpaces,
+                                     std::vector<size_t> & ruleIndices) const;
+
     void validate(const Config & cfg) const;
 
 private:
@@ -25,4 +25,12 @@ std::string CacheIDHash(const char * array, std::size_t size)
     return oss.str();
 }
 
+void CacheIDHash(const char * array, std::size_t size, uint64_t & low64, uint64_t & high64)
+{
+    const XXH128_hash_t hash = XXH3_128bits(array, size);
+
+    low64  = hash.low64;
+    high64 = hash.high64;
+}
+
 } // namespace OCIO_NAMESPACE
@@ -7,6 +7,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include <cstdint>
 #include <string>
 
 namespace OCIO_NAMESPACE
@@ -14,6 +15,9 @@ namespace OCIO_NAMESPACE
 
 std::string CacheIDHash(const char * array, std::size_t size);
 
+// Get the 128-bit hash used by the method above.
+void CacheIDHash(const char * array, std::size_t size, uint64_t & low64, uint64_t & high64);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
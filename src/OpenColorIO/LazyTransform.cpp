@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "fileformats/FormatMetadata.h"
+#include "LazyTransform.h"
+#include "Logging.h"
+#include "transforms/GroupTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Empty group transform standing for a transform which could not be loaded.
+class FailedLazyTransform : public GroupTransformImpl
+{
+public:
+    explicit FailedLazyTransform(const std::string & error)
+        : GroupTransformImpl()
+        , m_error(error)
+    {
+    }
+
+    TransformRcPtr createEditableCopy() const override
+    {
+        return std::make_shared<FailedLazyTransform>(m_error);
+    }
+
+    void validate() const override
+    {
+        throw Exception(m_error.c_str());
+    }
+
+private:
+    const std::string m_error;
+};
+
+// When set, Resolve() returns the placeholders as is (refer to GetUnloadedColorSpaceTransform()).
+thread_local bool g_keepPlaceholders = false;
+
+} // anon.
+
+TransformRcPtr LazyTransform::Create(const Loader & loader,
+                                     const FileReferencesGetter & fileReferencesGetter)
+{
+    StateRcPtr state = std::make_shared<State>();
+    state->m_loader = loader;
+    state->m_fileReferencesGetter = fileReferencesGetter;
+
+    return TransformRcPtr(new LazyTransform(state));
+}
+
+ConstTransformRcPtr LazyTransform::Resolve(const ConstTransformRcPtr & transform) noexcept
+{
+    if (auto lazy = DynamicPtrCast<const LazyTransform>(transform))
+    {
+        if (!g_keepPlaceholders)
+        {
+            return lazy->getLoadedTransform();
+        }
+    }
+    return transform;
+}
+
+LazyTransform::LazyTransform(const StateRcPtr & state)
+    : Transform()
+    , m_state(state)
+{
+}
+
+ConstTransformRcPtr LazyTransform::getLoadedTransform() const noexcept
+{
+    AutoMutex lock(m_state->m_mutex);
+
+    if (m_state->m_loader)
+    {
+        try
+        {
+            m_state->m_transform = m_state->m_loader();
+        }
+        catch (const std::exception & e)
+        {
+            LogError(e.what());
+            m_state->m_transform = std::make_shared<FailedLazyTransform>(e.what());
+        }
+
+        // Release the loader resources (e.g. the YAML nodes).
+        m_state->m_loader = Loader();
+        m_state->m_fileReferencesGetter = FileReferencesGetter();
+    }
+
+    return m_state->m_transform;
+}
+
+bool LazyTransform::getUnloadedFileReferences(std::set<std::string> & files) const
+{
+    AutoMutex lock(m_state->m_mutex);
+
+    if (!m_state->m_loader)
+    {
+        return false;
+    }
+
+    if (m_state->m_fileReferencesGetter)
+    {
+        m_state->m_fileReferencesGetter(files);
+    }
+    return true;
+}
+
+TransformRcPtr LazyTransform::createEditableCopy() const
+{
+    {
+        AutoMutex lock(m_state->m_mutex);
+        if (m_state->m_loader)
+        {
+            return TransformRcPtr(new LazyTransform(m_state));
+        }
+    }
+
+    ConstTransformRcPtr transform = getLoadedTransform();
+    return transform ? transform->createEditableCopy() : TransformRcPtr();
+}
+
+TransformDirection LazyTransform::getDirection() const noexcept
+{
+    ConstTransformRcPtr transform = getLoadedTransform();
+    return transform ? transform->getDirection() : TRANSFORM_DIR_FORWARD;
+}
+
+void LazyTransform::setDirection(TransformDirection dir) noexcept
+{
+    getLoadedTransform();
+
+    AutoMutex lock(m_state->m_mutex);
+    if (m_state->m_transform)
+    {
+        m_state->m_transform->setDirection(dir);
+    }
+}
+
+TransformType LazyTransform::getTransformType() const noexcept
+{
+    ConstTransformRcPtr transform = getLoadedTransform();
+    return transform ? transform->getTransformType() : TRANSFORM_TYPE_GROUP;
+}
+
+void LazyTransform::validate() const
+{
+    ConstTransformRcPtr transform = getLoadedTransform();
+    if (transform)
+    {
+        transform->validate();
+    }
+}
+
+void ThrowIfLazyLoadingFailed(const ConstTransformRcPtr & transform)
+{
+    if (DynamicPtrCast<const FailedLazyTransform>(transform))
+    {
+        transform->validate();
+    }
+}
+
+ConstTransformRcPtr GetUnloadedColorSpaceTransform(const ColorSpace & cs, ColorSpaceDirection dir)
+{
+    // The color space only gives access to its transforms through ColorSpace::getTransform()
+    // which resolves the placeholders.
+    g_keepPlaceholders = true;
+    ConstTransformRcPtr transform = cs.getTransform(dir);
+    g_keepPlaceholders = false;
+
+    return transform;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LAZYTRANSFORM_H
+#define INCLUDED_OCIO_LAZYTRANSFORM_H
+
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Placeholder of a transform which is only loaded on first use (i.e. the transforms of the
+// color spaces when the OCIO_LAZY_CONFIG_LOADING env. variable is set). The placeholder is
+// never returned by the public API, the color space returns the loaded transform instead.
+//
+// The copies of a not yet loaded placeholder share the loaded transform so that a config copy
+// does not load the transform again. Note that the placeholder keeps the source (i.e. the YAML
+// nodes) until the transform is loaded, so only the loading time is reduced, not the memory.
+class LazyTransform : public Transform
+{
+public:
+    typedef std::function<TransformRcPtr()> Loader;
+    // Collect the files referenced by the transform from its source.
+    typedef std::function<void(std::set<std::string> & files)> FileReferencesGetter;
+
+    static TransformRcPtr Create(const Loader & loader,
+                                 const FileReferencesGetter & fileReferencesGetter);
+
+    // Return the transform itself, or the loaded transform if it is a placeholder.
+    static ConstTransformRcPtr Resolve(const ConstTransformRcPtr & transform) noexcept;
+
+    LazyTransform() = delete;
+    LazyTransform(const LazyTransform &) = delete;
+    LazyTransform & operator=(const LazyTransform &) = delete;
+    ~LazyTransform() override = default;
+
+    // Load the transform on first call. A loading error is logged, and the returned transform is
+    // then an empty group transform throwing the error when validated or used.
+    ConstTransformRcPtr getLoadedTransform() const noexcept;
+
+    // Collect the files referenced by the transform without loading it (e.g. to compute the
+    // config cache ID). It returns false if the transform is already loaded, the caller must
+    // then use the loaded transform.
+    bool getUnloadedFileReferences(std::set<std::string> & files) const;
+
+    TransformRcPtr createEditableCopy() const override;
+
+    TransformDirection getDirection() const noexcept override;
+    void setDirection(TransformDirection dir) noexcept override;
+
+    TransformType getTransformType() const noexcept override;
+
+    void validate() const override;
+
+private:
+    struct State
+    {
+        Mutex m_mutex;
+        Loader m_loader;
+        FileReferencesGetter m_fileReferencesGetter;
+        TransformRcPtr m_transform;
+    };
+    typedef std::shared_ptr<State> StateRcPtr;
+
+    explicit LazyTransform(const StateRcPtr & state);
+
+    StateRcPtr m_state;
+};
+
+// Throw the loading error if the transform is the result of a failed lazy loading.
+void ThrowIfLazyLoadingFailed(const ConstTransformRcPtr & transform);
+
+// Return the color space transform without loading it i.e. it could be a placeholder (refer to
+// ColorSpace::getTransform() for the loaded one).
+ConstTransformRcPtr GetUnloadedColorSpaceTransform(const ColorSpace & cs, ColorSpaceDirection dir);
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_LAZYTRANSFORM_H
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_NAMEINDEX_H
+#define INCLUDED_OCIO_NAMEINDEX_H
+
+
+#include <string>
+#include <unordered_map>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Case-insensitive index of the names (and aliases) of a list of elements (e.g. the color spaces
+// of a config) i.e. it maps each lower case name to the position of its element in the list.
+//
+// The owner of the list must keep the index up to date. When several elements use the same name,
+// the first indexed one wins so indexing the elements in the list order gives the same result
+// than a linear search.
+class NameIndex
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // Return the position of the element using the name, or npos if not found.
+    size_t find(const char * name) const
+    {
+        if (!name || !*name)
+        {
+            return npos;
+        }
+
+        const auto it = m_index.find(StringUtils::Lower(name));
+        return it == m_index.end() ? npos : it->second;
+    }
+
+    void add(const char * name, size_t pos)
+    {
+        if (name && *name)
+        {
+            m_index.emplace(StringUtils::Lower(name), pos);
+        }
+    }
+
+    void clear() noexcept
+    {
+        m_index.clear();
+    }
+
+private:
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_NAMEINDEX_H
@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <cstring>
+#include <set>
 #include <unordered_set>
 
 #include <pystring.h>
@@ -10,8 +11,10 @@
 
 #include "Display.h"
 #include "FileRules.h"
+#include "LazyTransform.h"
 #include "Logging.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 #include "OCIOYaml.h"
 #include "ops/exposurecontrast/ExposureContrastOpData.h"
 #include "ops/gradingprimary/GradingPrimaryOpData.h"
@@ -3138,9 +3141,88 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t, unsigned int majorVersion)
         throw Exception("Unsupported Transform() type for serialization.");
 }
 
+// The YAML nodes of a config are shared by all its lazy transforms so the loading of the
+// transforms of a config is serialized (a null mutex means the transforms are not lazy).
+typedef std::shared_ptr<Mutex> LazyLoadingMutexRcPtr;
+
+std::string BuildLoadingErrorMessage(const std::string & filename, const char * what)
+{
+    std::ostringstream os;
+    os << "Error: Loading the OCIO profile ";
+    if (!filename.empty() &&
+        Platform::Strcasecmp(filename.c_str(), "from Archive/ConfigIOProxy") != 0)
+    {
+        os << "'" << filename << "' ";
+    }
+    os << "failed. " << what;
+    return os.str();
+}
+
+// Collect the src of the FileTransforms of a YAML node (including the nested ones).
+void GetFileReferences(const YAML::Node & node, std::set<std::string> & files)
+{
+    if (node.Tag() == "FileTransform" && node.IsMap())
+    {
+        const YAML::Node & src = node["src"];
+        if (src.IsScalar())
+        {
+            files.insert(src.Scalar());
+        }
+    }
+    else if (node.IsMap())
+    {
+        for (const auto & iter : node)
+        {
+            GetFileReferences(iter.second, files);
+        }
+    }
+    else if (node.IsSequence())
+    {
+        for (const auto & child : node)
+        {
+            GetFileReferences(child, files);
+        }
+    }
+}
+
+// Load a transform, or only create a placeholder loading it on first use when lazy (refer to
+// the OCIO_LAZY_CONFIG_LOADING env. variable).
+inline void load(const YAML::Node& node, TransformRcPtr& t, const char * filename,
+                 const LazyLoadingMutexRcPtr & lazyMutex)
+{
+    if (!lazyMutex)
+    {
+        load(node, t);
+        return;
+    }
+
+    const std::string name(filename ? filename : "");
+    t = LazyTransform::Create([node, name, lazyMutex]()
+    {
+        AutoMutex lock(*lazyMutex);
+
+        TransformRcPtr transform;
+        try
+        {
+            load(node, transform);
+        }
+        catch (const std::exception & e)
+        {
+            throw Exception(BuildLoadingErrorMessage(name, e.what()).c_str());
+        }
+        return transform;
+    },
+    [node, lazyMutex](std::set<std::string> & files)
+    {
+        AutoMutex lock(*lazyMutex);
+        GetFileReferences(node, files);
+    });
+}
+
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion)
+inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion,
+                 const char * filename, const LazyLoadingMutexRcPtr & lazyMutex)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -3238,7 +3320,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                                  "display color space.");
             }
             TransformRcPtr val;
-            load(iter->second, val);
+            load(iter->second, val, filename, lazyMutex);
             cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
@@ -3249,7 +3331,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                                  "non-display color space.");
             }
             TransformRcPtr val;
-            load(iter->second, val);
+            load(iter->second, val, filename, lazyMutex);
             cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if(key == "from_reference" || (majorVersion >= 2 && key == "from_scene_reference"))
@@ -3260,7 +3342,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                                  "a display color space.");
             }
             TransformRcPtr val;
-            load(iter->second, val);
+            load(iter->second, val, filename, lazyMutex);
             cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
@@ -3271,7 +3353,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                                  "non-display color space.");
             }
             TransformRcPtr val;
-            load(iter->second, val);
+            load(iter->second, val, filename, lazyMutex);
             cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else
@@ -4097,8 +4179,9 @@ inline void save(YAML::Emitter & out, ConstViewingRulesRcPtr & vr, size_t positi
 
 // Config
 
-inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename)
+inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename, bool lazy)
 {
+    const LazyLoadingMutexRcPtr lazyMutex = lazy ? std::make_shared<Mutex>() : nullptr;
 
     // check profile version
     int profile_major_version = 0;
@@ -4484,15 +4567,13 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs, config->getMajorVersion());
-                    for(int ii = 0; ii < config->getNumColorSpaces(); ++ii)
+                    load(val, cs, config->getMajorVersion(), filename, lazyMutex);
+                    ConstColorSpaceRcPtr existing = config->getColorSpace(cs->getName());
+                    if (existing && strcmp(existing->getName(), cs->getName()) == 0)
                     {
-                        if(strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
-                        {
-                            std::ostringstream os;
-                            os << "Colorspace with name '" << cs->getName() << "' already defined.";
-                            throwError(iter->second, os.str());
-                        }
+                        std::ostringstream os;
+                        os << "Colorspace with name '" << cs->getName() << "' already defined.";
+                        throwError(iter->second, os.str());
                     }
                     config->addColorSpace(cs);
                 }
@@ -4520,15 +4601,13 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs, config->getMajorVersion());
-                    for (int ii = 0; ii < config->getNumColorSpaces(); ++ii)
+                    load(val, cs, config->getMajorVersion(), filename, lazyMutex);
+                    ConstColorSpaceRcPtr existing = config->getColorSpace(cs->getName());
+                    if (existing && strcmp(existing->getName(), cs->getName()) == 0)
                     {
-                        if (strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
-                        {
-                            std::ostringstream os;
-                            os << "Colorspace with name '" << cs->getName() << "' already defined.";
-                            throwError(iter->second, os.str());
-                        }
+                        std::ostringstream os;
+                        os << "Colorspace with name '" << cs->getName() << "' already defined.";
+                        throwError(iter->second, os.str());
                     }
                     config->addColorSpace(cs);
                 }
@@ -5101,24 +5180,17 @@ inline void save(YAML::Emitter & out, const Config & config)
 
 ///////////////////////////////////////////////////////////////////////////
 
-void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename)
+void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename, bool lazy)
 {
     try
     {
         YAML::Node node = YAML::Load(istream);
-        load(node, config, filename);
+        load(node, config, filename, lazy);
     }
     catch(const std::exception & e)
     {
-        std::ostringstream os;
-        os << "Error: Loading the OCIO profile ";
-        if (filename && filename[0] && 
-            Platform::Strcasecmp(filename, "from Archive/ConfigIOProxy") != 0)
-        {
-            os << "'" << filename << "' ";
-        }
-        os << "failed. " << e.what();
-        throw Exception(os.str().c_str());
+        const std::string msg = BuildLoadingErrorMessage(filename ? filename : "", e.what());
+        throw Exception(msg.c_str());
     }
 }
 
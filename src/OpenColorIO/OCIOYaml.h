@@ -12,7 +12,8 @@ namespace OCIO_NAMESPACE
 namespace OCIOYaml
 {
 
-void Read(std::istream & istream, ConfigRcPtr & c, const char * filename);
+// When lazy, the color space transforms are only loaded on first use.
+void Read(std::istream & istream, ConfigRcPtr & c, const char * filename, bool lazy = false);
 void Write(std::ostream & ostream, const Config & c);
 
 } // namespace OCIOYaml
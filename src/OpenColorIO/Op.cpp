@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -25,6 +26,26 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasPlanarApply() const
+{
+    return false;
+}
+
+void OpCPU::applyPlanar(const float * const * /* inPlanes */,
+                        float * const * /* outPlanes */,
+                        long /* numPixels */) const
+{
+    throw Exception("Op does not implement the planar processing.");
+}
+
+void CopyAlphaPlane(const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    if (inPlanes[3] != outPlanes[3])
+    {
+        std::copy(inPlanes[3], inPlanes[3] + numPixels, outPlanes[3]);
+    }
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -45,11 +45,24 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Planar variant of apply() where the R, G, B & A 32-bit float values are stored in four
+    // separate buffers, so there is no need to interleave the channels. The input and output
+    // planes could be the same (i.e. in place processing). Only the renderers returning true
+    // from hasPlanarApply() implement it.
+    virtual bool hasPlanarApply() const;
+    virtual void applyPlanar(const float * const * inPlanes,
+                             float * const * outPlanes,
+                             long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 };
 
+// Copy the alpha plane of a planar apply (refer to OpCPU::applyPlanar()) for the renderers which
+// never modify the alpha channel.
+void CopyAlphaPlane(const float * const * inPlanes, float * const * outPlanes, long numPixels);
+
 class OpData;
 typedef OCIO_SHARED_PTR<OpData> OpDataRcPtr;
 typedef OCIO_SHARED_PTR<const OpData> ConstOpDataRcPtr;
@@ -10,8 +10,10 @@
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
+#include "ops/gamma/GammaOpData.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOpData.h"
 #include "ops/range/RangeOp.h"
 
 namespace OCIO_NAMESPACE
@@ -346,6 +348,117 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
     return count;
 }
 
+// Can the op be folded into a 3D LUT i.e. it is static and only processes the RGB channels?
+bool IsFoldableInLut3D(const ConstOpRcPtr & op)
+{
+    if (op->isDynamic())
+    {
+        return false;
+    }
+
+    auto opData = op->data();
+    switch (opData->getType())
+    {
+    case OpData::CDLType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::LogType:
+    case OpData::Lut1DType:
+    case OpData::Lut3DType:
+    case OpData::RangeType:
+        return true;
+    case OpData::GammaType:
+        return static_cast<const GammaOpData &>(*opData).isAlphaComponentIdentity();
+    case OpData::MatrixType:
+        return !static_cast<const MatrixOpData &>(*opData).hasAlpha();
+    default:
+        return false;
+    }
+}
+
+// Fold the ops from a forward 3D LUT up to the last 3D LUT of the following ops (e.g. 'Lut3D,
+// Matrix, Lut1D, Lut3D') into a single 3D LUT. The chain is evaluated once on the grid, with the
+// size of the largest LUT, so the intermediate results are not resampled. As the first LUT clamps
+// its input to its domain, only the interpolation of the result differs. A sequence starting with
+// an inverse 3D LUT is only composed with the following 3D LUTs (refer to Lut3DOpData::Compose()).
+// The pairs of 3D LUTs are left to CombineOps().
+int CombineLut3DSequences(OpRcPtrVec & opVec, OptimizationFlags oFlags)
+{
+    if (!IsCombineEnabled(OpData::Lut3DType, oFlags))
+    {
+        return 0;
+    }
+
+    int count = 0;
+
+    for (size_t first = 0; first < opVec.size(); ++first)
+    {
+        ConstOpRcPtr firstOp = opVec[first];
+        if (firstOp->data()->getType() != OpData::Lut3DType)
+        {
+            continue;
+        }
+
+        auto firstLut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(firstOp->data());
+        const bool forward = firstLut->getDirection() == TRANSFORM_DIR_FORWARD;
+
+        // Find the last 3D LUT of the sequence.
+        size_t last = first;
+        unsigned long gridSize = firstLut->getArray().getLength();
+        for (size_t idx = first + 1; idx < opVec.size(); ++idx)
+        {
+            ConstOpRcPtr op = opVec[idx];
+            const bool isLut3D = op->data()->getType() == OpData::Lut3DType;
+            if (forward ? !IsFoldableInLut3D(op) : !isLut3D)
+            {
+                break;
+            }
+
+            if (isLut3D)
+            {
+                last = idx;
+                auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(op->data());
+                gridSize = std::max(gridSize, lut->getArray().getLength());
+            }
+        }
+
+        if (last - first < 2)
+        {
+            continue;
+        }
+
+        Lut3DOpDataRcPtr composed;
+        if (forward)
+        {
+            OpRcPtrVec ops;
+            ops.insert(ops.end(), opVec.begin() + first + 1, opVec.begin() + last + 1);
+            composed = Lut3DOpData::Compose(firstLut, ops, gridSize);
+        }
+        else
+        {
+            ConstLut3DOpDataVec luts;
+            for (size_t idx = first; idx <= last; ++idx)
+            {
+                ConstOpRcPtr op = opVec[idx];
+                luts.push_back(OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(op->data()));
+            }
+            composed = Lut3DOpData::Compose(luts);
+        }
+
+        OpRcPtrVec tmpops;
+        CreateLut3DOp(tmpops, composed, TRANSFORM_DIR_FORWARD);
+        FinalizeOps(tmpops);
+
+        // Swap the composed op in for the original ones.
+        opVec.erase(opVec.begin() + first, opVec.begin() + last + 1);
+        opVec.insert(opVec.begin() + first, tmpops.begin(), tmpops.end());
+
+        count += static_cast<int>(last - first);
+    }
+
+    return count;
+}
+
 // Replace any Lut1D or Lut3D that specify inverse evaluation with a faster forward approximation.
 // There are two inversion modes: EXACT and FAST. The EXACT method is slower, and only available
 // on the CPU, but it calculates an exact inverse. The exact inverse is based on the use of LINEAR
@@ -669,7 +782,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         int replacedOps = replaceOps ? ReplaceOps(*this) : 0;
         int identityops = ReplaceIdentityOps(*this, oFlags);
         int inverseops  = RemoveInverseOps(*this, oFlags);
-        int combines    = CombineOps(*this, oFlags);
+        int combines    = CombineLut3DSequences(*this, oFlags);
+        combines       += CombineOps(*this, oFlags);
 
         if (noops + identityops + inverseops + combines == 0)
         {
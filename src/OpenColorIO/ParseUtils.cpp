@@ -4,6 +4,7 @@
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <sstream>
 
@@ -644,8 +645,188 @@ bool StringVecToIntVec(std::vector<int> &intArray, const StringUtils::StringVec
     return true;
 }
 
+namespace
+{
+inline bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+inline const char * SkipSpaces(const char * pos, const char * last)
+{
+    while (pos != last && IsSpace(*pos)) ++pos;
+    return pos;
+}
+
+// The number is followed by the next whitespace. Like the former sscanf() based parsing, the
+// remaining characters of a token (e.g. '1.0f') are ignored.
+inline const char * SkipToken(const char * pos, const char * last)
+{
+    while (pos != last && !IsSpace(*pos)) ++pos;
+    return pos;
+}
+} // anon.
+
+bool StringToFloats(const char * first, const char * last, float * values, size_t numValues)
+{
+    const char * pos = first;
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        pos = SkipSpaces(pos, last);
+        if (pos == last)
+        {
+            return false;
+        }
+
+        const auto result = NumberUtils::from_chars(pos, last, values[idx]);
+        if (result.ec != std::errc())
+        {
+            return false;
+        }
+
+        pos = SkipToken(result.ptr, last);
+    }
+
+    return SkipSpaces(pos, last) == last;
+}
+
+namespace
+{
+// Parse the int starting at 'pos' which must be followed by a whitespace or 'last'.
+inline bool ParseInt(const char *& pos, const char * last, int & value)
+{
+    const bool negative = (pos != last && *pos == '-');
+    if (pos != last && (*pos == '-' || *pos == '+'))
+    {
+        ++pos;
+    }
+
+    if (pos == last || *pos < '0' || *pos > '9')
+    {
+        return false;
+    }
+
+    long long val = 0;
+    for (; pos != last && *pos >= '0' && *pos <= '9'; ++pos)
+    {
+        val = val * 10 + (*pos - '0');
+        if (val > std::numeric_limits<int>::max())
+        {
+            return false;
+        }
+    }
+
+    value = static_cast<int>(negative ? -val : val);
+
+    return pos == last || IsSpace(*pos);
+}
+} // anon.
+
+bool StringToInts(const char * first, const char * last, int * values, size_t numValues)
+{
+    const char * pos = first;
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        pos = SkipSpaces(pos, last);
+        if (!ParseInt(pos, last, values[idx]))
+        {
+            return false;
+        }
+    }
+
+    return SkipSpaces(pos, last) == last;
+}
+
+bool StringToIntVec(const char * first, const char * last, std::vector<int> & values)
+{
+    values.clear();
+
+    const char * pos = SkipSpaces(first, last);
+    while (pos != last)
+    {
+        int value = 0;
+        if (!ParseInt(pos, last, value))
+        {
+            return false;
+        }
+        values.push_back(value);
+
+        pos = SkipSpaces(pos, last);
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
+void ReadRemainingContent(std::istream & istream, std::string & content)
+{
+    content.clear();
+
+    if (!istream.good())
+    {
+        return;
+    }
+
+    // Read all the characters at once when the stream size is known (e.g. a file stream).
+    const std::streampos start = istream.tellg();
+    if (start != std::streampos(-1) && istream.seekg(0, std::ios_base::end))
+    {
+        const std::streampos end = istream.tellg();
+        istream.seekg(start);
+
+        if (end != std::streampos(-1) && end > start)
+        {
+            content.resize(static_cast<size_t>(end - start));
+            istream.read(&content[0], static_cast<std::streamsize>(content.size()));
+            // Note that the text mode could convert some characters (e.g. CR LF on Windows).
+            content.resize(static_cast<size_t>(istream.gcount()));
+            return;
+        }
+    }
+
+    istream.clear();
+    std::ostringstream oss;
+    oss << istream.rdbuf();
+    content = oss.str();
+}
+
+bool nextline(const char *& pos, const char * end, const char *& first, const char *& last,
+              int & lineNumber)
+{
+    while (pos != end)
+    {
+        const char * lineEnd
+            = static_cast<const char *>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+        if (!lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        ++lineNumber;
+
+        first = SkipSpaces(pos, lineEnd);
+        last  = lineEnd;
+        while (last != first && IsSpace(*(last - 1))) --last;
+
+        pos = (lineEnd == end) ? end : lineEnd + 1;
+
+        if (first != last)
+        {
+            return true;
+        }
+    }
+
+    first = last = end;
+    return false;
+}
+
+bool nextline(const char *& pos, const char * end, const char *& first, const char *& last)
+{
+    int lineNumber = 0;
+    return nextline(pos, end, first, last, lineNumber);
+}
+
 // read the next non-empty line, and store it in 'line'
 // return 'true' on success
 
@@ -39,6 +39,13 @@ bool StringVecToFloatVec(std::vector<float> & floatArray,
 bool StringVecToIntVec(std::vector<int> & intArray,
                        const StringUtils::StringVec & lineParts);
 
+// Parse the whitespace separated numbers of the [first, last) characters (e.g. a LUT entry)
+// without any intermediate string. Return false if there are not exactly numValues numbers.
+bool StringToFloats(const char * first, const char * last, float * values, size_t numValues);
+bool StringToInts(const char * first, const char * last, int * values, size_t numValues);
+// Same as above for any number of ints. Return false if one of the tokens is not an int.
+bool StringToIntVec(const char * first, const char * last, std::vector<int> & values);
+
 //////////////////////////////////////////////////////////////////////////
 
 // read the next non-empty line, and store it in 'line'
@@ -46,6 +53,17 @@ bool StringVecToIntVec(std::vector<int> & intArray,
 
 bool nextline(std::istream &istream, std::string &line);
 
+// Read all the remaining characters of the stream in one go.
+void ReadRemainingContent(std::istream & istream, std::string & content);
+
+// Same as above for an in-memory content (refer to ReadRemainingContent()) where [first, last)
+// is the next non-empty line without its leading and trailing whitespaces. The 'pos' is moved
+// to the following line.
+bool nextline(const char *& pos, const char * end, const char *& first, const char *& last);
+// Same as above where lineNumber is incremented for each line read, including the empty ones.
+bool nextline(const char *& pos, const char * end, const char *& first, const char *& last,
+              int & lineNumber);
+
 bool StrEqualsCaseIgnore(const std::string & a, const std::string & b);
 
 // If a ',' is in the string, split on it
@@ -13,9 +13,13 @@
 #include "HashUtils.h"
 #include "Logging.h"
 #include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
+#include "ProcessorDiskCache.h"
 #include "TransformBuilder.h"
+#include "transforms/FileTransform.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -245,6 +249,9 @@ Processor::Impl & Processor::Impl::operator=(const Impl & rhs)
 
         m_cacheID.clear();
 
+        m_diskCacheDir = rhs.m_diskCacheDir;
+        m_diskCacheKey = rhs.m_diskCacheKey;
+
         m_cacheFlags = rhs.m_cacheFlags;
 
         const bool enableCaches
@@ -377,6 +384,9 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         ProcessorRcPtr proc = Create();
         *proc->getImpl() = procImpl;
 
+        // The persistent cache entry only applies to the original ops.
+        proc->getImpl()->m_diskCacheKey.clear();
+
         proc->getImpl()->m_ops.finalize();
         proc->getImpl()->m_ops.optimize(oFlags);
         proc->getImpl()->m_ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags);
@@ -390,26 +400,19 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
 
     if (m_optProcessorCache.isEnabled())
     {
-        AutoMutex guard(m_optProcessorCache.lock());
-
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = m_optProcessorCache[key];
-        if (!processor)
-        {
-            // Note: Some combinations of bit-depth and opt flags will produce identical Processors.
-            // Duplicates could be identified by computing the Processor cacheID, but that is too
-            // slow to attempt here.
-
-            processor = CreateProcessor(*this, inBitDepth, outBitDepth, oFlags);
-        }
+        // Note: Some combinations of bit-depth and opt flags will produce identical Processors.
+        // Duplicates could be identified by computing the Processor cacheID, but that is too
+        // slow to attempt here.
 
-        return processor;
+        return m_optProcessorCache.findOrInsert(key, [&]()
+        {
+            return CreateProcessor(*this, inBitDepth, outBitDepth, oFlags);
+        });
     }
     else
     {
@@ -489,17 +492,10 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
 
     if (m_gpuProcessorCache.isEnabled())
     {
-        AutoMutex guard(m_gpuProcessorCache.lock());
-
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        GPUProcessorRcPtr & processor = m_gpuProcessorCache[oFlags];
-        if (!processor)
+        return m_gpuProcessorCache.findOrInsert(oFlags, [&]()
         {
-            processor = CreateProcessor(gpuOps, oFlags);
-        }
-        
-        return processor;
+            return CreateProcessor(gpuOps, oFlags);
+        });
     }
     else
     {
@@ -524,13 +520,34 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
                                                                  OptimizationFlags oFlags) const
 {
     // Helper method.
-    auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              BitDepth inBitDepth,
-                              BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+    auto CreateProcessor = [this](const OpRcPtrVec & ops,
+                                  BitDepth inBitDepth,
+                                  BitDepth outBitDepth,
+                                  OptimizationFlags oFlags) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
-        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+
+        if (m_diskCacheKey.empty())
+        {
+            cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        }
+        else
+        {
+            // Skip the op optimizations if the persistent processor cache already has the result.
+            std::ostringstream oss;
+            oss << m_diskCacheKey << "_" << BitDepthToString(inBitDepth)
+                << "_" << BitDepthToString(outBitDepth) << "_" << oFlags;
+
+            OpRcPtrVec optimizedOps;
+            if (!LoadOpsFromDiskCache(m_diskCacheDir, oss.str(), optimizedOps))
+            {
+                FinalizeOpsForCPU(optimizedOps, ops, inBitDepth, outBitDepth, oFlags);
+                SaveOpsToDiskCache(m_diskCacheDir, oss.str(), optimizedOps);
+            }
+
+            cpu->getImpl()->finalizeOptimizedOps(optimizedOps, inBitDepth, outBitDepth, oFlags);
+        }
+
         return cpu;
     };
 
@@ -543,22 +560,15 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 
     if (m_cpuProcessorCache.isEnabled() && useCache)
     {
-        AutoMutex guard(m_cpuProcessorCache.lock());
-
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        CPUProcessorRcPtr & processor = m_cpuProcessorCache[key];
-        if (!processor)
+        return m_cpuProcessorCache.findOrInsert(key, [&]()
         {
-            processor = CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
-        }
-        
-        return processor;
+            return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
+        });
     }
     else
     {
@@ -577,6 +587,29 @@ void Processor::Impl::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     m_cpuProcessorCache.enable(cacheEnabled);
 }
 
+size_t Processor::Impl::getLutMemorySize() const noexcept
+{
+    size_t memorySize = 0;
+
+    for (ConstOpRcPtr op : m_ops)
+    {
+        ConstOpDataRcPtr data = op->data();
+
+        if (data->getType() == OpData::Lut1DType)
+        {
+            const auto & lut = static_cast<const Lut1DOpData &>(*data);
+            memorySize += lut.getArray().getValues().size() * sizeof(float);
+        }
+        else if (data->getType() == OpData::Lut3DType)
+        {
+            const auto & lut = static_cast<const Lut3DOpData &>(*data);
+            memorySize += lut.getArray().getValues().size() * sizeof(float);
+        }
+    }
+
+    return memorySize;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -617,6 +650,8 @@ void Processor::Impl::setTransform(const Config & config,
 
     transform->validate();
 
+    PrefetchFileTransforms(config, context, transform, direction);
+
     BuildOps(m_ops, config, context, transform, direction);
 
     // NB: No-ops are not removed yet since they are still needed to build the legacy GPU processor.
@@ -625,6 +660,40 @@ void Processor::Impl::setTransform(const Config & config,
     m_ops.validateDynamicProperties();
 }
 
+void Processor::Impl::setTransformUsingDiskCache(const std::string & diskCacheDir,
+                                                 const Config & config,
+                                                 const ConstContextRcPtr & context,
+                                                 const ConstTransformRcPtr & transform,
+                                                 TransformDirection direction)
+{
+    // The key identifies the library version, the config (including the files it references),
+    // the context and the transform. The files used by the processor are then checked when
+    // loading the entry.
+    std::ostringstream oss;
+    oss << GetVersion() << config.getCacheID(context) << *transform << direction;
+
+    const std::string fullstr = oss.str();
+    const std::string key = CacheIDHash(fullstr.c_str(), fullstr.size());
+
+    std::string stamp;
+    if (!LoadProcessorFromDiskCache(diskCacheDir, key, m_ops, m_metadata, stamp))
+    {
+        setTransform(config, context, transform, direction);
+        computeMetadata();
+
+        // Only save the processors using files as they are the slow ones to create. Note that the
+        // dynamic properties would be lost by the serialization.
+        if (m_metadata->getNumFiles() == 0 || m_ops.isDynamic()
+            || !SaveProcessorToDiskCache(diskCacheDir, key, m_ops, m_metadata, stamp))
+        {
+            return;
+        }
+    }
+
+    m_diskCacheDir = diskCacheDir;
+    m_diskCacheKey = key + "_" + stamp;
+}
+
 void Processor::Impl::concatenate(ConstProcessorRcPtr & p1, ConstProcessorRcPtr & p2)
 {
     m_ops = p1->getImpl()->m_ops;
@@ -29,6 +29,10 @@ private:
 
     ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
 
+    // The entry of the persistent processor cache, if any (see ProcessorDiskCache.h).
+    std::string m_diskCacheDir;
+    std::string m_diskCacheKey;
+
     // Speedup GPU & CPU Processor accesses by using a cache.
     mutable ProcessorCache<std::size_t, ProcessorRcPtr>    m_optProcessorCache;
     mutable ProcessorCache<std::size_t, GPUProcessorRcPtr> m_gpuProcessorCache;
@@ -87,6 +91,9 @@ public:
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    // Approximate memory size (in bytes) of the LUTs used by the processor.
+    size_t getLutMemorySize() const noexcept;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -101,6 +108,14 @@ public:
                       const ConstTransformRcPtr& transform,
                       TransformDirection direction);
 
+    // Same as setTransform() followed by computeMetadata() but the ops could come from the
+    // persistent processor cache, and they are then saved in it if needed.
+    void setTransformUsingDiskCache(const std::string & diskCacheDir,
+                                    const Config & config,
+                                    const ConstContextRcPtr & context,
+                                    const ConstTransformRcPtr& transform,
+                                    TransformDirection direction);
+
     void concatenate(ConstProcessorRcPtr & p1, ConstProcessorRcPtr & p2);
 
     void computeMetadata();
@@ -0,0 +1,481 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#include <pystring.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Logging.h"
+#include "OpBuilders.h"
+#include "ops/noop/NoOps.h"
+#include "ParseUtils.h"
+#include "Platform.h"
+#include "ProcessorDiskCache.h"
+#include "TransformBuilder.h"
+#include "transforms/FileTransform.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Identifies the format of the text files holding the processor metadata & used files.
+static constexpr char HEADER[] = "ocio-processor-cache 2";
+
+std::string GetFilePath(const std::string & cacheDir, const std::string & filename)
+{
+    return pystring::os::path::join(cacheDir, filename);
+}
+
+bool ReadFile(const std::string & filename, std::string & content)
+{
+    std::ifstream ifs = Platform::CreateInputFileStream(filename.c_str(), std::ios_base::in);
+    if (!ifs.good())
+    {
+        return false;
+    }
+
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    content = oss.str();
+
+    return true;
+}
+
+// Get the size and the modification time of a file, or an empty string if it does not exist. The
+// time is a single token i.e. "<seconds>.<nanoseconds>" or, as the Windows stat() only has a one
+// second resolution, "<seconds>:<content hash>".
+std::string GetFileStamp(const std::string & filename)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    struct _stat fileInfo;
+    if (_wstat(Platform::Utf8ToUtf16(filename).c_str(), &fileInfo) == 0)
+#else
+    struct stat fileInfo;
+    if (stat(filename.c_str(), &fileInfo) == 0)
+#endif
+    {
+        std::ostringstream oss;
+        oss << fileInfo.st_size << " " << fileInfo.st_mtime;
+#if defined(_WIN32)
+        std::string content;
+        if (!ReadFile(filename, content))
+        {
+            return "";
+        }
+        oss << ":" << CacheIDHash(content.c_str(), content.size());
+#elif defined(__APPLE__)
+        oss << "." << std::setfill('0') << std::setw(9) << fileInfo.st_mtimespec.tv_nsec;
+#else
+        oss << "." << std::setfill('0') << std::setw(9) << fileInfo.st_mtim.tv_nsec;
+#endif
+        return oss.str();
+    }
+
+    return "";
+}
+
+// Write a temporary file and then rename it so that the concurrent processes never read a
+// partially written file.
+bool WriteFile(const std::string & filename, const std::string & content)
+{
+    std::ostringstream oss;
+    oss << filename << "." << std::random_device{}() << ".tmp";
+    const std::string tmpFilename = oss.str();
+
+    {
+        std::ofstream ofs(Platform::filenameToUTF(tmpFilename).c_str(),
+                          std::ios_base::out | std::ios_base::binary);
+        if (!ofs.good())
+        {
+            return false;
+        }
+
+        ofs << content;
+        if (!ofs.good())
+        {
+            ofs.close();
+            std::remove(tmpFilename.c_str());
+            return false;
+        }
+    }
+
+#if defined(_WIN32) && defined(UNICODE)
+    const bool renamed = _wrename(Platform::Utf8ToUtf16(tmpFilename).c_str(),
+                                  Platform::Utf8ToUtf16(filename).c_str()) == 0;
+#else
+    const bool renamed = std::rename(tmpFilename.c_str(), filename.c_str()) == 0;
+#endif
+
+    if (!renamed)
+    {
+        // Note that it could fail on some platforms if another process already created the file.
+        std::remove(tmpFilename.c_str());
+    }
+
+    return renamed;
+}
+
+void RemoveFile(const std::string & filename)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    _wremove(Platform::Utf8ToUtf16(filename).c_str());
+#else
+    std::remove(filename.c_str());
+#endif
+}
+
+// Remove the files of an entry i.e. the ones named "<prefix>*".
+void RemoveFiles(const std::string & cacheDir, const std::string & prefix)
+{
+    std::vector<std::string> filenames;
+
+#ifdef _WIN32
+    WIN32_FIND_DATAW fd;
+    const std::wstring pattern = Platform::Utf8ToUtf16(GetFilePath(cacheDir, prefix + "*"));
+    HANDLE hFind = ::FindFirstFileW(pattern.c_str(), &fd);
+    if (hFind != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            filenames.push_back(Platform::Utf16ToUtf8(fd.cFileName));
+        } while (::FindNextFileW(hFind, &fd));
+
+        ::FindClose(hFind);
+    }
+#else
+    if (DIR * dir = opendir(cacheDir.c_str()))
+    {
+        while (struct dirent * entry = readdir(dir))
+        {
+            if (StringUtils::StartsWith(entry->d_name, prefix))
+            {
+                filenames.push_back(entry->d_name);
+            }
+        }
+
+        closedir(dir);
+    }
+#endif
+
+    for (const auto & filename : filenames)
+    {
+        RemoveFile(GetFilePath(cacheDir, filename));
+    }
+}
+
+bool ReadOps(const std::string & filename, OpRcPtrVec & ops)
+{
+    std::ifstream ifs = Platform::CreateInputFileStream(filename.c_str(), std::ios_base::in);
+    if (!ifs.good())
+    {
+        return false;
+    }
+
+    try
+    {
+        // Directly use the CTF reader as the file cache must not keep a copy of the entries.
+        const FileFormat * format
+            = FormatRegistry::GetInstance().getFileFormatByName(FILEFORMAT_CTF);
+        CachedFileRcPtr cachedFile = format->read(ifs, filename, INTERP_DEFAULT);
+
+        ConstConfigRcPtr config = Config::CreateRaw();
+        ConstFileTransformRcPtr file = FileTransform::Create();
+
+        ops.clear();
+        format->buildFileOps(ops, *config, config->getCurrentContext(), cachedFile, *file,
+                             TRANSFORM_DIR_FORWARD);
+
+        ops.finalize();
+    }
+    catch (const Exception & e)
+    {
+        std::ostringstream oss;
+        oss << "Could not read the processor cache file '" << filename << "': " << e.what();
+        LogDebug(oss.str());
+        return false;
+    }
+
+    return true;
+}
+
+bool WriteOps(const std::string & filename, const OpRcPtrVec & ops)
+{
+    std::ostringstream oss;
+
+    try
+    {
+        GroupTransformRcPtr group = GroupTransform::Create();
+        group->getFormatMetadata() = ops.getFormatMetadata();
+
+        for (ConstOpRcPtr op : ops)
+        {
+            CreateTransform(group, op);
+        }
+
+        // The values are scaled and rounded when written using an integer or half file bit-depth
+        // so always use 32-bit float to read back the same values.
+        for (int idx = 0; idx < group->getNumTransforms(); ++idx)
+        {
+            TransformRcPtr transform = group->getTransform(idx);
+            if (auto lut1d = DynamicPtrCast<Lut1DTransform>(transform))
+            {
+                lut1d->setFileOutputBitDepth(BIT_DEPTH_F32);
+            }
+            else if (auto lut3d = DynamicPtrCast<Lut3DTransform>(transform))
+            {
+                lut3d->setFileOutputBitDepth(BIT_DEPTH_F32);
+            }
+            else if (auto matrix = DynamicPtrCast<MatrixTransform>(transform))
+            {
+                matrix->setFileInputBitDepth(BIT_DEPTH_F32);
+                matrix->setFileOutputBitDepth(BIT_DEPTH_F32);
+            }
+            else if (auto range = DynamicPtrCast<RangeTransform>(transform))
+            {
+                range->setFileInputBitDepth(BIT_DEPTH_F32);
+                range->setFileOutputBitDepth(BIT_DEPTH_F32);
+            }
+        }
+
+        group->write(Config::CreateRaw(), FILEFORMAT_CTF, oss);
+    }
+    catch (const Exception & e)
+    {
+        std::ostringstream err;
+        err << "Could not write the processor cache file '" << filename << "': " << e.what();
+        LogDebug(err.str());
+        return false;
+    }
+
+    return WriteFile(filename, oss.str());
+}
+
+// Load an entry from the content of its text file.
+bool LoadEntry(const std::string & cacheDir,
+               const std::string & content,
+               const std::string & entryPrefix,
+               OpRcPtrVec & ops,
+               const ProcessorMetadataRcPtr & metadata)
+{
+    std::vector<std::string> files;
+    std::vector<std::string> looks;
+    std::vector<std::pair<size_t, AllocationData>> allocations;
+
+    std::istringstream iss(content);
+    std::string line;
+    if (!std::getline(iss, line) || line != HEADER)
+    {
+        return false;
+    }
+
+    while (std::getline(iss, line))
+    {
+        // The lines are "file <size> <time> <path>", "look <name>" or
+        // "allocation <position> <allocation> <vars>".
+        std::vector<std::string> tokens;
+        pystring::split(line, tokens, " ", 1);
+
+        if (tokens.size() == 2 && tokens[0] == "look")
+        {
+            looks.push_back(tokens[1]);
+        }
+        else if (tokens.size() == 2 && tokens[0] == "allocation")
+        {
+            pystring::split(line, tokens, " ");
+
+            int position = 0;
+            int allocation = 0;
+            AllocationData data;
+            if (tokens.size() < 3
+                || !StringToInt(&position, tokens[1].c_str(), true) || position < 0
+                || !StringToInt(&allocation, tokens[2].c_str(), true)
+                || !StringVecToFloatVec(data.vars, StringUtils::StringVec(tokens.begin() + 3,
+                                                                          tokens.end())))
+            {
+                return false;
+            }
+            data.allocation = static_cast<Allocation>(allocation);
+
+            allocations.emplace_back(size_t(position), data);
+        }
+        else if (tokens.size() == 2 && tokens[0] == "file")
+        {
+            pystring::split(line, tokens, " ", 3);
+            if (tokens.size() != 4 || GetFileStamp(tokens[3]) != tokens[1] + " " + tokens[2])
+            {
+                // The file was modified or removed.
+                return false;
+            }
+            files.push_back(tokens[3]);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    OpRcPtrVec entryOps;
+    if (!ReadOps(GetFilePath(cacheDir, entryPrefix + ".ctf"), entryOps))
+    {
+        return false;
+    }
+
+    // Insert back the GPU allocations (i.e. no-ops) between the ops.
+    ops.clear();
+    auto allocationIt = allocations.begin();
+    for (size_t idx = 0; idx <= entryOps.size(); ++idx)
+    {
+        for (; allocationIt != allocations.end() && allocationIt->first == idx; ++allocationIt)
+        {
+            CreateGpuAllocationNoOp(ops, allocationIt->second);
+        }
+
+        if (idx < entryOps.size())
+        {
+            ops.push_back(entryOps[idx]);
+        }
+    }
+
+    if (allocationIt != allocations.end())
+    {
+        return false;
+    }
+
+    for (const auto & file : files)
+    {
+        metadata->addFile(file.c_str());
+    }
+    for (const auto & look : looks)
+    {
+        metadata->addLook(look.c_str());
+    }
+
+    return true;
+}
+
+} // anon.
+
+bool LoadProcessorFromDiskCache(const std::string & cacheDir,
+                                const std::string & key,
+                                OpRcPtrVec & ops,
+                                const ProcessorMetadataRcPtr & metadata,
+                                std::string & stamp)
+{
+    std::string content;
+    if (!ReadFile(GetFilePath(cacheDir, key + ".txt"), content))
+    {
+        return false;
+    }
+
+    const std::string entryStamp = CacheIDHash(content.c_str(), content.size());
+    const std::string entryPrefix = key + "_" + entryStamp;
+
+    if (!LoadEntry(cacheDir, content, entryPrefix, ops, metadata))
+    {
+        // The entry is stale (i.e. one of the used files changed) or invalid so remove its files
+        // including the optimized ops saved for its CPU processors.
+        RemoveFiles(cacheDir, entryPrefix);
+        RemoveFile(GetFilePath(cacheDir, key + ".txt"));
+        return false;
+    }
+
+    stamp = entryStamp;
+
+    return true;
+}
+
+bool SaveProcessorToDiskCache(const std::string & cacheDir,
+                              const std::string & key,
+                              const OpRcPtrVec & ops,
+                              const ConstProcessorMetadataRcPtr & metadata,
+                              std::string & stamp)
+{
+    std::ostringstream oss;
+    oss << HEADER << "\n";
+
+    for (int idx = 0; idx < metadata->getNumFiles(); ++idx)
+    {
+        const std::string filename = metadata->getFile(idx);
+        const std::string fileStamp = GetFileStamp(filename);
+        if (fileStamp.empty())
+        {
+            return false;
+        }
+        oss << "file " << fileStamp << " " << filename << "\n";
+    }
+
+    for (int idx = 0; idx < metadata->getNumLooks(); ++idx)
+    {
+        oss << "look " << metadata->getLook(idx) << "\n";
+    }
+
+    // The GPU allocations are no-ops so they are not part of the CTF file, their positions are
+    // the number of ops before them once the no-ops are removed.
+    oss.imbue(std::locale::classic());
+    oss.precision(std::numeric_limits<float>::max_digits10);
+
+    size_t position = 0;
+    for (const auto & op : ops)
+    {
+        AllocationData allocation;
+        if (GetGpuAllocation(allocation, op))
+        {
+            oss << "allocation " << position << " " << allocation.allocation;
+            for (const float var : allocation.vars)
+            {
+                oss << " " << var;
+            }
+            oss << "\n";
+        }
+        else if (!op->isNoOpType())
+        {
+            ++position;
+        }
+    }
+
+    const std::string content = oss.str();
+    const std::string entryStamp = CacheIDHash(content.c_str(), content.size());
+
+    // Write the ops first as the entry is only valid once the text file exists.
+    if (!WriteOps(GetFilePath(cacheDir, key + "_" + entryStamp + ".ctf"), ops)
+        || !WriteFile(GetFilePath(cacheDir, key + ".txt"), content))
+    {
+        return false;
+    }
+
+    stamp = entryStamp;
+
+    return true;
+}
+
+bool LoadOpsFromDiskCache(const std::string & cacheDir, const std::string & key, OpRcPtrVec & ops)
+{
+    return ReadOps(GetFilePath(cacheDir, key + ".ctf"), ops);
+}
+
+void SaveOpsToDiskCache(const std::string & cacheDir, const std::string & key, const OpRcPtrVec & ops)
+{
+    WriteOps(GetFilePath(cacheDir, key + ".ctf"), ops);
+}
+
+} // namespace OCIO_NAMESPACE
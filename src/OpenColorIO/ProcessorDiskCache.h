@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PROCESSORDISKCACHE_H
+#define INCLUDED_OCIO_PROCESSORDISKCACHE_H
+
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The persistent processor cache (enabled by the OCIO_PROCESSOR_CACHE_DIR env. variable) keeps
+// the ops of the processors in a directory so that other processes could skip the LUT file
+// loading and the op optimizations.
+//
+// Each entry is a CTF file holding the ops (including the LUT values) and, for the processors
+// built from a transform, a text file holding the processor metadata, the GPU allocations (i.e.
+// the only no-ops kept) and the size & modification time (or content hash on Windows) of all the
+// files used by the processor to detect the stale entries. The values are written as 32-bit float
+// with 9 significant digits so the loaded processors are bit-exact.
+
+// Load the ops of a processor and its metadata. It returns false if the entry does not exist or
+// if one of the used files changed, in which case the stale files of the entry are removed. The
+// stamp identifies the content of the used files.
+bool LoadProcessorFromDiskCache(const std::string & cacheDir,
+                                const std::string & key,
+                                OpRcPtrVec & ops,
+                                const ProcessorMetadataRcPtr & metadata,
+                                std::string & stamp);
+
+// Save the ops of a processor and its metadata. It returns false if the processor could not be
+// saved (e.g. the ops are not serializable in a CTF file).
+bool SaveProcessorToDiskCache(const std::string & cacheDir,
+                              const std::string & key,
+                              const OpRcPtrVec & ops,
+                              const ConstProcessorMetadataRcPtr & metadata,
+                              std::string & stamp);
+
+// Load or save a list of ops (e.g. the optimized ops of a processor) which does not need any
+// validation i.e. the key already identifies its content.
+bool LoadOpsFromDiskCache(const std::string & cacheDir, const std::string & key, OpRcPtrVec & ops);
+void SaveOpsToDiskCache(const std::string & cacheDir, const std::string & key, const OpRcPtrVec & ops);
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_PROCESSORDISKCACHE_H
@@ -60,6 +60,7 @@ namespace OCIO_NAMESPACE
 #define OCIO_ALIGN(decl) alignas(OCIO_SIMD_BYTES) decl
 
 
+#include <algorithm>
 #include <limits>
 
 static constexpr int EXP_MASK   = 0x7F800000;
@@ -642,6 +643,37 @@ inline void sseSinCos(const float x, float& sin_x, float& cos_x)
     sin_x = buf[1];
 }
 
+// Apply func to the first numPlanes planes of a planar apply (refer to OpCPU::applyPlanar()).
+// The function gets the plane index and four values of the plane, and returns the four results
+// i.e. the values of a plane are processed with the same instructions as the matching channel
+// of the packed pixels. The leftover values are processed through a zero-padded register.
+template<typename Func>
+inline void ssePlanarApply(const float * const * inPlanes, float * const * outPlanes,
+                           long numPixels, int numPlanes, const Func & func)
+{
+    for (int c = 0; c < numPlanes; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            _mm_storeu_ps(out + idx, func(c, _mm_loadu_ps(in + idx)));
+        }
+
+        if (idx < numPixels)
+        {
+            OCIO_ALIGN(float buf[4]) = { 0.0f, 0.0f, 0.0f, 0.0f };
+            const long numLeftovers = numPixels - idx;
+
+            std::copy(in + idx, in + numPixels, buf);
+            _mm_store_ps(buf, func(c, _mm_load_ps(buf)));
+            std::copy(buf, buf + numLeftovers, out + idx);
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
 
 
@@ -2,10 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <atomic>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ScanlineHelper.h"
 
 
@@ -29,6 +31,48 @@ Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
     return optim;
 }
 
+namespace
+{
+
+// The user defined chunk size, or 0 to use the default one.
+std::atomic<long> g_chunkSize{ 0 };
+
+// Minimum number of pixels of a chunk to amortize the per chunk processing cost.
+constexpr long MIN_CHUNK_SIZE = 256;
+
+long GetDefaultChunkSize()
+{
+    // Only use a quarter of the L2 cache for the packed RGBA F32 buffer so it stays in the cache
+    // along with the input & output buffers and the op data (e.g. LUT values).
+    const long numPixels = long(CPUInfo::instance().getL2CacheSize() / (4 * 4 * sizeof(float)));
+
+    return std::max(MIN_CHUNK_SIZE, numPixels);
+}
+
+} // anon.
+
+long GetCPUProcessorChunkSize()
+{
+    return g_chunkSize.load();
+}
+
+void SetCPUProcessorChunkSize(long numPixels)
+{
+    if (numPixels < 0)
+    {
+        throw Exception("Invalid CPU processor chunk size.");
+    }
+
+    g_chunkSize.store(numPixels);
+}
+
+long GetChunkSize(long width)
+{
+    const long chunkSize = GetCPUProcessorChunkSize();
+
+    return std::max(1L, std::min(width, chunkSize > 0 ? chunkSize : GetDefaultChunkSize()));
+}
+
 
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitDepth,
@@ -42,7 +86,11 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
+    ,   m_xIndex(0)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
+    ,   m_chunkSize(0)
+    ,   m_numChunkPixels(0)
     ,   m_useDstBuffer(false)
 {
 }
@@ -55,11 +103,16 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = m_dstImg.m_height;
+
     if(m_srcImg.m_width!=m_dstImg.m_width || m_srcImg.m_height!=m_dstImg.m_height)
     {
         throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
 
+    m_xIndex    = 0;
+    m_chunkSize = GetChunkSize(m_dstImg.m_width);
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = GetOptimizationMode(m_dstImg);
 
@@ -69,13 +122,13 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
 
     if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_chunkSize;
         m_inBitDepthBuffer.resize(bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_chunkSize;
         m_rgbaFloatBuffer.resize(bufferSize);
         m_outBitDepthBuffer.resize(bufferSize);
     }
@@ -89,6 +142,11 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = m_dstImg.m_height;
+
+    m_xIndex    = 0;
+    m_chunkSize = GetChunkSize(m_dstImg.m_width);
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
 
@@ -101,7 +159,7 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
         // TODO: Re-use memory from thread-safe memory pool, rather
         // than doing a new allocation each time.
 
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_chunkSize;
 
         m_rgbaFloatBuffer.resize(bufferSize);
         m_inBitDepthBuffer.resize(bufferSize);
@@ -114,26 +172,44 @@ GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 {
 }
 
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setLineRange(long yBegin, long yEnd)
+{
+    if (yBegin < 0 || yBegin > yEnd || yEnd > m_dstImg.m_height)
+    {
+        throw Exception("Invalid line range for the image buffers.");
+    }
+
+    m_xIndex = 0;
+    m_yIndex = int(yBegin);
+    m_yEnd   = yEnd;
+}
+
 // Copy from the src image to our scanline, in our preferred pixel layout.
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, long & numPixels)
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, and by chunks of pixels for
+    // the lines longer than the chunk size.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
     }
 
-    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
+    m_numChunkPixels = std::min(m_chunkSize, m_dstImg.m_width - m_xIndex);
+
+    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                                         + m_dstImg.m_xStrideBytes * m_xIndex)
                              : &m_rgbaFloatBuffer[0];
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex);
+        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex
+                                                         + m_srcImg.m_xStrideBytes * m_xIndex);
 
-        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_numChunkPixels);
     }
     else
     {
@@ -142,26 +218,28 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
                                                &m_inBitDepthBuffer[0],
                                                *buffer,
-                                               m_dstImg.m_width,
-                                               m_yIndex * m_dstImg.m_width);
+                                               int(m_numChunkPixels),
+                                               m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    numPixels = m_dstImg.m_width;
+    numPixels = m_numChunkPixels;
 }
 
 // Write back the result of our work, from the scanline to our destination image.
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, and by chunks of pixels for
+    // the lines longer than the chunk size.
 
     if((m_outOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
+        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                              + m_dstImg.m_xStrideBytes * m_xIndex);
 
         const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
 
-        m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
+        m_dstImg.m_bitDepthOp->apply(in, out, m_numChunkPixels);
     }
     else
     {
@@ -169,11 +247,16 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
                                                 &m_rgbaFloatBuffer[0],
                                                 &m_outBitDepthBuffer[0],
-                                                m_dstImg.m_width,
-                                                m_yIndex * m_dstImg.m_width);
+                                                int(m_numChunkPixels),
+                                                m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    ++m_yIndex;
+    m_xIndex += m_numChunkPixels;
+    if(m_xIndex >= m_dstImg.m_width)
+    {
+        m_xIndex = 0;
+        ++m_yIndex;
+    }
 }
 
 
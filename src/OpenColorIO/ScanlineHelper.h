@@ -24,6 +24,10 @@ enum Optimizations
 
 Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc);
 
+// Get the number of pixels of a line to process at once i.e. the user defined chunk size
+// if any, otherwise a size derived from the L2 cache size.
+long GetChunkSize(long width);
+
 
 class ScanlineHelper
 {
@@ -37,6 +41,10 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Restrict the processing to the lines [yBegin, yEnd) of the image. It must be called
+    // after init() which resets the processing to the complete image.
+    virtual void setLineRange(long yBegin, long yEnd) = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
@@ -58,7 +66,9 @@ public:
 
     ~GenericScanlineHelper() override;
 
-    // Copy from the src image to our scanline, in our preferred
+    void setLineRange(long yBegin, long yEnd) override;
+
+    // Copy from the src image to our scanline (or to a chunk of it), in our preferred
     // pixel layout. Return the number of pixels to process.
 
     void prepRGBAScanline(float** buffer, long & numPixels) override;
@@ -81,6 +91,7 @@ private:
     Optimizations m_outOptimizedMode; // Optimization applicable to the output buffer.
 
     // Processing needs an intermediate buffer as CPU Ops only process packed RGBA F32.
+    // Note that all the intermediate buffers are sized to hold one chunk of pixels.
     std::vector<float> m_rgbaFloatBuffer;
 
     // Processing needs additional buffers of the same pixel type as the input/output
@@ -88,9 +99,19 @@ private:
     std::vector<InType> m_inBitDepthBuffer;
     std::vector<OutType> m_outBitDepthBuffer;
 
+    // The index of the first pixel of the current chunk in the line to process.
+    long m_xIndex;
+
     // The index of the current line to process.
     int m_yIndex;
 
+    // The index of the line ending the processing (i.e. excluded).
+    long m_yEnd;
+
+    // The maximum number of pixels processed at once, and the size of the current chunk.
+    long m_chunkSize;
+    long m_numChunkPixels;
+
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
     // and m_outBitDepthBuffer).
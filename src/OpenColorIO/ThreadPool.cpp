@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ThreadPool.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// State shared by all the threads participating to a parallelFor() call.
+struct ParallelJob
+{
+    ParallelJob(long numItems, long chunkSize, const ParallelForFunc & func)
+        :   m_numItems(numItems)
+        ,   m_chunkSize(chunkSize)
+        ,   m_numChunks((numItems + chunkSize - 1) / chunkSize)
+        ,   m_func(func)
+        ,   m_pendingChunks(m_numChunks)
+    {
+    }
+
+    // Claim and process chunks until none is left.
+    void run()
+    {
+        const unsigned slot = m_nextSlot.fetch_add(1);
+
+        while (true)
+        {
+            const long chunk = m_nextChunk.fetch_add(1);
+            if (chunk >= m_numChunks)
+            {
+                return;
+            }
+
+            if (!m_failed.load())
+            {
+                const long begin = chunk * m_chunkSize;
+                const long end   = std::min(begin + m_chunkSize, m_numItems);
+
+                try
+                {
+                    m_func(begin, end, slot);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_failed.exchange(true))
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+            }
+
+            if (m_pendingChunks.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.notify_all();
+            }
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pendingChunks.load() == 0; });
+
+        if (m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    const long m_numItems;
+    const long m_chunkSize;
+    const long m_numChunks;
+    // Note that the function is only referenced as the job never outlives the parallelFor() call.
+    const ParallelForFunc & m_func;
+
+    std::atomic<long> m_nextChunk{ 0 };
+    std::atomic<long> m_pendingChunks;
+    std::atomic<unsigned> m_nextSlot{ 0 };
+    std::atomic<bool> m_failed{ false };
+
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    std::exception_ptr m_error;
+};
+
+} // anon.
+
+
+ThreadPool::ThreadPool(unsigned numThreads)
+{
+    const unsigned numWorkers = numThreads > 1 ? numThreads - 1 : 0;
+
+    m_workers.reserve(numWorkers);
+    for (unsigned idx = 0; idx < numWorkers; ++idx)
+    {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stop = true;
+    }
+
+    m_queueCondition.notify_all();
+
+    for (auto & worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+            if (m_stop && m_queue.empty())
+            {
+                return;
+            }
+
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        task();
+    }
+}
+
+void ThreadPool::parallelFor(long numItems, long chunkSize, unsigned maxThreads,
+                             const ParallelForFunc & func)
+{
+    if (numItems <= 0)
+    {
+        return;
+    }
+
+    chunkSize = std::max(chunkSize, 1L);
+
+    const long numChunks = (numItems + chunkSize - 1) / chunkSize;
+
+    unsigned numThreads = maxThreads == 0 ? getNumThreads() : std::min(maxThreads, getNumThreads());
+    numThreads = (unsigned)std::min<long>(numThreads, numChunks);
+
+    if (numThreads <= 1)
+    {
+        // Avoid any synchronization when there is nothing to share.
+        for (long begin = 0; begin < numItems; begin += chunkSize)
+        {
+            func(begin, std::min(begin + chunkSize, numItems), 0);
+        }
+        return;
+    }
+
+    // The job is shared with the workers as some of them could only start after the last chunk
+    // is processed (i.e. after the method returns).
+    auto job = std::make_shared<ParallelJob>(numItems, chunkSize, func);
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        for (unsigned idx = 1; idx < numThreads; ++idx)
+        {
+            m_queue.emplace_back([job]() { job->run(); });
+        }
+    }
+
+    m_queueCondition.notify_all();
+
+    job->run();
+    job->wait();
+}
+
+ThreadPool & GetThreadPool()
+{
+    // The pool is intentionally never destroyed as joining threads while unloading the library
+    // could deadlock on some platforms.
+    static ThreadPool * pool = new ThreadPool(std::max(1U, std::thread::hardware_concurrency()));
+    return *pool;
+}
+
+} // namespace OCIO_NAMESPACE
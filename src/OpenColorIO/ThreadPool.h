@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADPOOL_H
+#define INCLUDED_OCIO_THREADPOOL_H
+
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Function called by ThreadPool::parallelFor() to process the items [begin, end). The slot
+// identifies the participating thread i.e. it is in [0, maxThreads) and no two threads ever
+// run concurrently with the same slot, so it can be used to index per-thread scratch data.
+typedef std::function<void(long begin, long end, unsigned slot)> ParallelForFunc;
+
+// Pool of worker threads used internally for any parallel processing. Work is split in chunks
+// that the participating threads (i.e. some workers and the calling thread) claim one after the
+// other, so a thread that finishes early keeps on taking the remaining chunks.
+//
+// Note that the calling thread always participates to the processing. That makes nested calls
+// (i.e. a task of the pool calling parallelFor()) safe as the processing still progresses when
+// all the workers are busy.
+class ThreadPool
+{
+public:
+    ThreadPool() = delete;
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    // The number of threads includes the calling thread i.e. 1 means no worker thread.
+    explicit ThreadPool(unsigned numThreads);
+    ~ThreadPool();
+
+    // Maximum number of threads processing a parallelFor() call, including the calling thread.
+    unsigned getNumThreads() const noexcept { return unsigned(m_workers.size()) + 1; }
+
+    // Process [0, numItems) by chunks of chunkSize items using up to maxThreads threads
+    // (0 means all the threads of the pool). The call returns once all the items are processed.
+    // If a chunk throws, the remaining chunks are skipped and the first exception is rethrown.
+    void parallelFor(long numItems, long chunkSize, unsigned maxThreads,
+                     const ParallelForFunc & func);
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::deque<std::function<void()>> m_queue;
+    bool m_stop = false;
+};
+
+// Get the thread pool shared by the library. It is lazily created with one thread per hardware
+// thread.
+ThreadPool & GetThreadPool();
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_THREADPOOL_H
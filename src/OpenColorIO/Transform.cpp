@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "fileformats/FormatMetadata.h"
+#include "LazyTransform.h"
 #include "OpBuilders.h"
 #include "ops/cdl/CDLOp.h"
 #include "ops/exponent/ExponentOp.h"
@@ -116,6 +117,8 @@ void BuildOps(OpRcPtrVec & ops,
     else if(ConstGroupTransformRcPtr groupTransform = \
         DynamicPtrCast<const GroupTransform>(transform))
     {
+        // A color space transform which failed to be lazy loaded is an empty group.
+        ThrowIfLazyLoadingFailed(transform);
         BuildGroupOps(ops, config, context, *groupTransform, dir);
     }
     else if(ConstLogAffineTransformRcPtr logAffineTransform = \
@@ -244,44 +244,40 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
 
     // Parse the file 3D LUT data to an int array.
     {
-        const int MAX_LINE_SIZE = 4096;
-        char lineBuffer[MAX_LINE_SIZE];
+        // The file is parsed from an in-memory copy of its lines to avoid any intermediate
+        // string.
+        std::string content;
+        ReadRemainingContent(istream, content);
+
+        const char * pos = content.c_str();
+        const char * end = pos + content.size();
+        const char * first = nullptr;
+        const char * last  = nullptr;
 
-        StringUtils::StringVec lineParts;
         std::vector<int> tmpData;
 
         int lineNumber = 0;
 
-        while(istream.good())
+        while (nextline(pos, end, first, last, lineNumber))
         {
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
-            ++lineNumber;
-
-            // Strip and split the line.
-            lineParts = StringUtils::SplitByWhiteSpaces(StringUtils::Trim(lineBuffer));
-
-            if(lineParts.empty()) continue;
-            if (lineParts.size() > 0)
+            if (*first == '#')
             {
-                if (StringUtils::StartsWith(lineParts[0], "#"))
-                {
-                    continue;
-                }
-                if (StringUtils::StartsWith(lineParts[0], "<"))
-                {
-                    // Format error: reject files that could be
-                    // formatted as xml.
-                    std::ostringstream os;
-                    os << "Error parsing .3dl file. ";
-                    os << "Not expecting a line starting with \"<\".";
-                    os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
-                    throw Exception(os.str().c_str());
-                }
+                continue;
+            }
+            if (*first == '<')
+            {
+                // Format error: reject files that could be
+                // formatted as xml.
+                std::ostringstream os;
+                os << "Error parsing .3dl file. ";
+                os << "Not expecting a line starting with \"<\".";
+                os << "Line (" << lineNumber << "): '";
+                os << std::string(first, last) << "'.";
+                throw Exception(os.str().c_str());
             }
 
             // If we haven't found a list of ints, continue.
-            if (!StringVecToIntVec(tmpData, lineParts))
+            if (!StringToIntVec(first, last, tmpData))
             {
                 // Some keywords are valid (3DMESH, mesh, gamma, LUT*)
                 // but others could be format error.
@@ -295,10 +291,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             {
                 if (rawshaper.empty())
                 {
-                    for (unsigned int i = 0; i < tmpData.size(); ++i)
-                    {
-                        rawshaper.push_back(tmpData[i]);
-                    }
+                    rawshaper = tmpData;
                 }
                 else
                 {
@@ -307,7 +300,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                     os << "Error parsing .3dl file. ";
                     os << "Appears to contain more than 1 shaper LUT.";
                     os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
+                    os << std::string(first, last) << "'.";
                     throw Exception(os.str().c_str());
                 }
             }
@@ -329,7 +322,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 os << "Error parsing .3dl file. ";
                 os << "Invalid line with less than 3 values.";
                 os << "Line (" << lineNumber << "): '";
-                os << lineBuffer << "'.";
+                os << std::string(first, last) << "'.";
                 throw Exception(os.str().c_str());
             }
         }
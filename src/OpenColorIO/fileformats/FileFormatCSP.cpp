@@ -506,30 +506,30 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         lut1d_ptr->setFileOutputBitDepth(BIT_DEPTH_F32);
         Array & lutArray = lut1d_ptr->getArray();
 
+        // The table is parsed from an in-memory copy of the remaining lines to avoid any
+        // intermediate string.
+        std::string content;
+        ReadRemainingContent(istream, content);
+
+        const char * pos = content.c_str();
+        const char * end = pos + content.size();
+        const char * first = nullptr;
+        const char * last  = nullptr;
+
         for(int i = 0; i < points1D; ++i)
         {
             // Scan for the three floats.
-            nextline (istream, line);
+            nextline(pos, end, first, last);
 
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
-
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            if (!StringToFloats(first, last, &lutArray[i*3], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 1D csp LUT. Each line of LUT values ";
                 os << "must contain three numbers. Line: '";
-                os << line << "'. File: ";
+                os << std::string(first, last) << "'. File: ";
                 os << fileName << ".";
                 throw Exception(os.str().c_str());
             }
-
-            // Store each channel.
-            lutArray[i*3 + 0] = floatArray[0];
-            lutArray[i*3 + 1] = floatArray[1];
-            lutArray[i*3 + 2] = floatArray[2];
-
         }
 
     }
@@ -585,32 +585,34 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         int g = 0;
         int b = 0;
 
+        // The cube is parsed from an in-memory copy of the remaining lines to avoid any
+        // intermediate string.
+        std::string content;
+        ReadRemainingContent(istream, content);
+
+        const char * pos = content.c_str();
+        const char * end = pos + content.size();
+        const char * first = nullptr;
+        const char * last  = nullptr;
+
         for(int i=0; i<num3dentries; ++i)
         {
             // Load the cube.
-            nextline (istream, line);
+            nextline(pos, end, first, last);
 
             // OpData::Lut3D Array index, b changes fastest.
             const unsigned long arrayIdx =
                 GetLut3DIndex_BlueFast(r, g, b,
                                         lutSize, lutSize, lutSize);
 
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
-
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            if (!StringToFloats(first, last, &lutArray[arrayIdx], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 3D csp LUT, couldn't read cube row (";
-                os << i << "): " << line << "' in " << fileName << ".";
+                os << i << "): " << std::string(first, last) << "' in " << fileName << ".";
                 throw Exception(os.str().c_str());
             }
 
-            lutArray[arrayIdx + 0] = floatArray[0];
-            lutArray[arrayIdx + 1] = floatArray[1];
-            lutArray[arrayIdx + 2] = floatArray[2];
-
             // CSP stores the LUT in red-fastest order.
             r += 1;
             if (r == lutSize)
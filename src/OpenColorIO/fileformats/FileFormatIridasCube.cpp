@@ -308,59 +308,58 @@ LocalFileFormat::read(std::istream & istream,
             }
         }
 
-        do
-        {
-            line = StringUtils::Trim(line);
+        // The table is parsed from an in-memory copy of the remaining lines to avoid any
+        // intermediate string.
+        std::string content;
+        ReadRemainingContent(istream, content);
 
-            // All lines starting with '#' are comments
-            if (StringUtils::StartsWith(line,"#")) continue;
+        const char * pos = content.c_str();
+        const char * end = pos + content.size();
 
-            if (line.empty()) continue;
+        // The first table line (if any) is already read.
+        line = StringUtils::Trim(line);
+        const char * first = line.c_str();
+        const char * last  = first + line.size();
+        bool hasLine = !line.empty();
 
-            char valR[64] = "";
-            char valG[64] = "";
-            char valB[64] = "";
-
-#ifdef _WIN32
-            if (sscanf_s(line.c_str(), "%s %s %s %c", valR, 64, valG, 64, valB, 64, &endTok, 1) != 3)
-#else
-            if (sscanf(line.c_str(), "%s %s %s %c", valR, valG, valB, &endTok) != 3)
-#endif
-            {
-                // It must be a float triple!
-                ThrowErrorMessage(
-                    "Malformed color triples specified.",
-                    fileName,
-                    lineNumber,
-                    line);
-            }
-            else
+        while (hasLine)
+        {
+            // All lines starting with '#' are comments
+            if (*first != '#')
             {
-                float r = NAN;
-                float g = NAN;
-                float b = NAN;
+                float rgb[3] = { NAN, NAN, NAN };
+                if (!StringToFloats(first, last, rgb, 3))
+                {
+                    const std::string entry(first, last);
 
-                const auto rAnswer = NumberUtils::from_chars(valR, valR + 64, r);
-                const auto gAnswer = NumberUtils::from_chars(valG, valG + 64, g);
-                const auto bAnswer = NumberUtils::from_chars(valB, valB + 64, b);
+                    // The previous sscanf() based parsing distinguishes a wrong number of
+                    // tokens from an invalid number.
+                    if (StringUtils::SplitByWhiteSpaces(entry).size() != 3)
+                    {
+                        // It must be a float triple!
+                        ThrowErrorMessage(
+                            "Malformed color triples specified.",
+                            fileName,
+                            lineNumber,
+                            entry);
+                    }
 
-                if (rAnswer.ec != std::errc() || gAnswer.ec != std::errc() || bAnswer.ec != std::errc())
-                {
                     ThrowErrorMessage(
                         "Invalid color triples",
                         fileName,
                         lineNumber,
-                        line);
+                        entry);
                 }
 
-                raw.push_back(r);
-                raw.push_back(g);
-                raw.push_back(b);
+                raw.push_back(rgb[0]);
+                raw.push_back(rgb[1]);
+                raw.push_back(rgb[2]);
+
+                ++lineNumber;
             }
 
-            ++lineNumber;
+            hasLine = nextline(pos, end, first, last);
         }
-        while (nextline(istream, line));
     }
 
     // Interpret the parsed data, validate LUT sizes.
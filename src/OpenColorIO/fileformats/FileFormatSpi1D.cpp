@@ -198,100 +198,64 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     Array & lutArray = lut1d->getArray();
     unsigned long i = 0;
     {
-        istream.getline(lineBuffer, MAX_LINE_SIZE);
-        ++currentLine;
+        // The table is parsed from an in-memory copy of the remaining lines to avoid any
+        // intermediate string.
+        std::string content;
+        ReadRemainingContent(istream, content);
+
+        const char * pos = content.c_str();
+        const char * end = pos + content.size();
+        const char * first = nullptr;
+        const char * last  = nullptr;
 
         int lineCount=0;
 
-        std::vector<float> values;
+        float values[3] = { 0.0f, 0.0f, 0.0f };
 
-        while (istream.good())
+        while (nextline(pos, end, first, last, currentLine))
         {
-            const std::string line = StringUtils::Trim(std::string(lineBuffer));
-            if (Platform::Strcasecmp(line.c_str(), "}") == 0)
+            if (last - first == 1 && *first == '}')
             {
                 break;
             }
 
-            if (line.length() != 0)
+            // A line must contain exactly 'components' floats.
+            if (!StringToFloats(first, last, values, components))
             {
-                values.clear();
-
-                char inputLUT[4][64] = {"", "", "", ""};
-#ifdef _WIN32
-                if (sscanf_s(lineBuffer, "%s %s %s %63s", inputLUT[0], 64,
-                           inputLUT[1], 64, inputLUT[2], 64, inputLUT[3],
-                           64) != components)
-#else
-                if (sscanf(lineBuffer, "%s %s %s %63s", inputLUT[0],
-                           inputLUT[1], inputLUT[2], inputLUT[3]) != components)
-#endif
-                {
-                    std::ostringstream os;
-                    os << "Malformed LUT line. Expecting a ";
-                    os << components << " components entry.";
-
-                    ThrowErrorMessage("Malformed LUT line", currentLine, line);
-                }
-
-                if (lineCount >= lut_size)
-                {
-                    ThrowErrorMessage("Too many entries found", currentLine, "");
-                }
-
-                values.resize(components);
-
-                for (int i = 0; i < components; i++)
-                {
-                    float v = NAN;
-                    const auto result = NumberUtils::from_chars(inputLUT[i], inputLUT[i] + 64, v);
-
-                    if (result.ec != std::errc())
-                    {
-                        std::ostringstream os;
-                        os << "Malformed LUT line. Could not convert component";
-                        os << i << " to a floating point number.";
-
-                        ThrowErrorMessage("Malformed LUT line", currentLine,
-                                            line);
-                    }
-
-                    values[i] = v;
-                }
+                ThrowErrorMessage("Malformed LUT line", currentLine, std::string(first, last));
+            }
 
-                // If 1 component is specified, use x1 x1 x1.
-                if (components == 1)
-                {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[0];
-                    lutArray[i + 2] = values[0];
-                    i += 3;
-                    ++lineCount;
-                }
-                // If 2 components are specified, use x1 x2 0.0.
-                else if (components == 2)
-                {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[1];
-                    lutArray[i + 2] = 0.0f;
-                    i += 3;
-                    ++lineCount;
-                }
-                // If 3 component is specified, use x1 x2 x3.
-                else if (components == 3)
-                {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[1];
-                    lutArray[i + 2] = values[2];
-                    i += 3;
-                    ++lineCount;
-                }
+            if (lineCount >= lut_size)
+            {
+                ThrowErrorMessage("Too many entries found", currentLine, "");
+            }
 
-                // No other case, components is in [1..3].
+            // If 1 component is specified, use x1 x1 x1.
+            if (components == 1)
+            {
+                lutArray[i]     = values[0];
+                lutArray[i + 1] = values[0];
+                lutArray[i + 2] = values[0];
+            }
+            // If 2 components are specified, use x1 x2 0.0.
+            else if (components == 2)
+            {
+                lutArray[i]     = values[0];
+                lutArray[i + 1] = values[1];
+                lutArray[i + 2] = 0.0f;
+            }
+            // If 3 component is specified, use x1 x2 x3.
+            else if (components == 3)
+            {
+                lutArray[i]     = values[0];
+                lutArray[i + 1] = values[1];
+                lutArray[i + 2] = values[2];
             }
 
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
-            ++currentLine;
+            // No other case, components is in [1..3].
+
+            i += 3;
+            ++lineCount;
         }
 
         if (lineCount != lut_size)
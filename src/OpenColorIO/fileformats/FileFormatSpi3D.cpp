@@ -9,6 +9,7 @@
 
 #include "fileformats/FileFormatUtils.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "BakingUtils.h"
 #include "transforms/FileTransform.h"
@@ -144,97 +145,124 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     Array & lutArray = lut3d->getArray();
     unsigned long numVal = lutArray.getNumValues();
     std::vector<bool> indexDefined(numVal, false);
-    while (istream.good() && entriesRemaining > 0)
+
+    // The table is parsed from an in-memory copy of the remaining lines to avoid any
+    // intermediate string.
+    std::string content;
+    ReadRemainingContent(istream, content);
+
+    const char * pos = content.c_str();
+    const char * end = pos + content.size();
+    const char * first = nullptr;
+    const char * last  = nullptr;
+
+    while (entriesRemaining > 0 && nextline(pos, end, first, last))
     {
-        istream.getline(lineBuffer, MAX_LINE_SIZE);
-
-        char redValueS[64] = "";
-        char greenValueS[64] = "";
-        char blueValueS[64] = "";
-
-#ifdef _WIN32
-        if (sscanf(lineBuffer,
-            "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, 64,
-            greenValueS, 64,
-            blueValueS, 64) == 6)
-#else
-        if (sscanf(lineBuffer, "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, greenValueS, blueValueS) == 6)
-#endif
+        // An entry is 'rIndex gIndex bIndex redValue greenValue blueValue', the other lines
+        // are ignored. Like the former sscanf() based parsing, any token after the blue value
+        // is ignored.
+        auto skipTokens = [last](const char *& pos, int numTokens)
         {
-            const auto redValueAnswer = NumberUtils::from_chars(redValueS, redValueS + 64, redValue);
-            const auto greenValueAnswer = NumberUtils::from_chars(greenValueS, greenValueS + 64, greenValue);
-            const auto blueValueAnswer = NumberUtils::from_chars(blueValueS, blueValueS + 64, blueValue);
-
-            if (redValueAnswer.ec != std::errc()
-                || greenValueAnswer.ec != std::errc()
-                || blueValueAnswer.ec != std::errc())
+            int token = 0;
+            for (; token < numTokens; ++token)
             {
-                std::ostringstream os;
-                os << "Error parsing .spi3d file (";
-                os << fileName;
-                os << "). ";
-                os << "Data is invalid. ";
-                os << "A color value is specified (";
-                os << redValueS << " " << greenValueS << " " << blueValueS;
-                os << ") that cannot be parsed as a floating-point triplet.";
-                throw Exception(os.str().c_str());
+                while (pos != last && (*pos == ' ' || *pos == '\t')) ++pos;
+                if (pos == last)
+                {
+                    break;
+                }
+                while (pos != last && *pos != ' ' && *pos != '\t') ++pos;
             }
+            return token;
+        };
+
+        const char * valuesPos = first;
+        skipTokens(valuesPos, 3);
+
+        int indices[3] = { 0, 0, 0 };
+        if (!StringToInts(first, valuesPos, indices, 3))
+        {
+            continue;
+        }
 
-            bool invalidIndex = false;
-            if (rIndex < 0 || rIndex >= rSize
-                || gIndex < 0 || gIndex >= gSize
-                || bIndex < 0 || bIndex >= bSize)
+        rIndex = indices[0];
+        gIndex = indices[1];
+        bIndex = indices[2];
+
+        const char * valuesEnd = valuesPos;
+        if (skipTokens(valuesEnd, 3) != 3)
+        {
+            continue;
+        }
+
+        float values[3] = { NAN, NAN, NAN };
+        if (!StringToFloats(valuesPos, valuesEnd, values, 3))
+        {
+            std::ostringstream os;
+            os << "Error parsing .spi3d file (";
+            os << fileName;
+            os << "). ";
+            os << "Data is invalid. ";
+            os << "A color value is specified (";
+            os << StringUtils::Trim(std::string(valuesPos, valuesEnd));
+            os << ") that cannot be parsed as a floating-point triplet.";
+            throw Exception(os.str().c_str());
+        }
+
+        redValue   = values[0];
+        greenValue = values[1];
+        blueValue  = values[2];
+
+        bool invalidIndex = false;
+        if (rIndex < 0 || rIndex >= rSize
+            || gIndex < 0 || gIndex >= gSize
+            || bIndex < 0 || bIndex >= bSize)
+        {
+            invalidIndex = true;
+        }
+        else
+        {
+            index = GetLut3DIndex_BlueFast(rIndex, gIndex, bIndex,
+                                            rSize, gSize, bSize);
+            if (index < 0 || index >= (int)numVal)
             {
                 invalidIndex = true;
             }
-            else
-            {
-                index = GetLut3DIndex_BlueFast(rIndex, gIndex, bIndex,
-                                                rSize, gSize, bSize);
-                if (index < 0 || index >= (int)numVal)
-                {
-                    invalidIndex = true;
-                }
 
-            }
+        }
 
-            if (invalidIndex)
-            {
-                std::ostringstream os;
-                os << "Error parsing .spi3d file (";
-                os << fileName;
-                os << "). ";
-                os << "Data is invalid. ";
-                os << "A LUT entry is specified (";
-                os << rIndex << " " << gIndex << " " << bIndex;
-                os << ") that falls outside of the cube.";
-                throw Exception(os.str().c_str());
-            }
+        if (invalidIndex)
+        {
+            std::ostringstream os;
+            os << "Error parsing .spi3d file (";
+            os << fileName;
+            os << "). ";
+            os << "Data is invalid. ";
+            os << "A LUT entry is specified (";
+            os << rIndex << " " << gIndex << " " << bIndex;
+            os << ") that falls outside of the cube.";
+            throw Exception(os.str().c_str());
+        }
 
-            lutArray[index+0] = redValue;
-            lutArray[index+1] = greenValue;
-            lutArray[index+2] = blueValue;
-            if (! indexDefined[index])
-            {
-                entriesRemaining--;
-                indexDefined[index] = true;
-            }
-            else
-            {
-                std::ostringstream os;
-                os << "Error parsing .spi3d file (";
-                os << fileName;
-                os << "). ";
-                os << "Data is invalid. ";
-                os << "A LUT entry is specified multiple times (";
-                os << rIndex << " " << gIndex << " " << bIndex;
-                os <<  ").";  
-                throw Exception(os.str().c_str());
-            }
+        lutArray[index+0] = redValue;
+        lutArray[index+1] = greenValue;
+        lutArray[index+2] = blueValue;
+        if (! indexDefined[index])
+        {
+            entriesRemaining--;
+            indexDefined[index] = true;
+        }
+        else
+        {
+            std::ostringstream os;
+            os << "Error parsing .spi3d file (";
+            os << fileName;
+            os << "). ";
+            os << "Data is invalid. ";
+            os << "A LUT entry is specified multiple times (";
+            os << rIndex << " " << gIndex << " " << bIndex;
+            os <<  ").";  
+            throw Exception(os.str().c_str());
         }
     }
 
@@ -116,7 +116,6 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
 
     {
         StringUtils::StringVec parts;
-        std::vector<float> tmpfloats;
 
         bool in3d = false;
 
@@ -131,68 +130,85 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
 
             if(StringUtils::StartsWith(parts[0],"#")) continue;
 
-            if(!in3d)
+            if(parts[0] == "grid_size")
             {
-                if(parts[0] == "grid_size")
+                if(parts.size() != 4 || 
+                    !StringToInt( &size3d[0], parts[1].c_str()) ||
+                    !StringToInt( &size3d[1], parts[2].c_str()) ||
+                    !StringToInt( &size3d[2], parts[3].c_str()))
                 {
-                    if(parts.size() != 4 || 
-                        !StringToInt( &size3d[0], parts[1].c_str()) ||
-                        !StringToInt( &size3d[1], parts[2].c_str()) ||
-                        !StringToInt( &size3d[2], parts[3].c_str()))
-                    {
-                        ThrowErrorMessage(
-                            "Malformed grid_size tag.",
-                            fileName, lineNumber, line);
-                    }
-
-                    // TODO: Support nununiformly sized LUTs.
-                    if (size3d[0] != size3d[1] ||
-                        size3d[0] != size3d[2])
-                    {
-                        std::ostringstream os;
-                        os << "Only equal grid size LUTs are supported. Found ";
-                        os << "grid size: " << size3d[0] << " x ";
-                        os << size3d[1] << " x " << size3d[2] << ".";
-                        ThrowErrorMessage(
-                            os.str(),
-                            fileName, lineNumber, line);
-                    }
-
-                    raw3d.reserve(3*size3d[0]*size3d[1]*size3d[2]);
+                    ThrowErrorMessage(
+                        "Malformed grid_size tag.",
+                        fileName, lineNumber, line);
                 }
-                else if(parts[0] == "global_transform")
+
+                // TODO: Support nununiformly sized LUTs.
+                if (size3d[0] != size3d[1] ||
+                    size3d[0] != size3d[2])
+                {
+                    std::ostringstream os;
+                    os << "Only equal grid size LUTs are supported. Found ";
+                    os << "grid size: " << size3d[0] << " x ";
+                    os << size3d[1] << " x " << size3d[2] << ".";
+                    ThrowErrorMessage(
+                        os.str(),
+                        fileName, lineNumber, line);
+                }
+
+                raw3d.reserve(3*size3d[0]*size3d[1]*size3d[2]);
+            }
+            else if(parts[0] == "global_transform")
+            {
+                if(parts.size() != 17)
                 {
-                    if(parts.size() != 17)
-                    {
-                        ThrowErrorMessage(
-                            "Malformed global_transform tag. "
-                            "16 floats expected.",
-                            fileName, lineNumber, line);
-                    }
-
-                    parts.erase(parts.begin()); // Drop the 1st entry. (the tag)
-                    if(!StringVecToFloatVec(global_transform, parts) || global_transform.size() != 16)
-                    {
-                        ThrowErrorMessage(
-                            "Malformed global_transform tag. "
-                            "Could not convert to float array.",
-                            fileName, lineNumber, line);
-                    }
+                    ThrowErrorMessage(
+                        "Malformed global_transform tag. "
+                        "16 floats expected.",
+                        fileName, lineNumber, line);
                 }
-                // TODO: element_size (aka scale3)
-                // TODO: world_origin (aka translate3)
-                else if(parts[0] == "data")
+
+                parts.erase(parts.begin()); // Drop the 1st entry. (the tag)
+                if(!StringVecToFloatVec(global_transform, parts) || global_transform.size() != 16)
                 {
-                    in3d = true;
+                    ThrowErrorMessage(
+                        "Malformed global_transform tag. "
+                        "Could not convert to float array.",
+                        fileName, lineNumber, line);
                 }
             }
-            else // (in3d)
+            // TODO: element_size (aka scale3)
+            // TODO: world_origin (aka translate3)
+            else if(parts[0] == "data")
+            {
+                in3d = true;
+                break;
+            }
+        }
+
+        if(in3d)
+        {
+            // The data section is parsed from an in-memory copy of the remaining lines
+            // to avoid any intermediate string.
+            std::string content;
+            ReadRemainingContent(istream, content);
+
+            const char * pos = content.c_str();
+            const char * end = pos + content.size();
+            const char * first = nullptr;
+            const char * last  = nullptr;
+
+            float values[3] = { 0.0f, 0.0f, 0.0f };
+
+            while(nextline(pos, end, first, last))
             {
-                if(StringVecToFloatVec(tmpfloats, parts) && (tmpfloats.size() == 3))
+                if(*first == '#') continue;
+
+                // The lines which are not 3 floats are ignored.
+                if(StringToFloats(first, last, values, 3))
                 {
-                    raw3d.push_back(tmpfloats[0]);
-                    raw3d.push_back(tmpfloats[1]);
-                    raw3d.push_back(tmpfloats[2]);
+                    raw3d.push_back(values[0]);
+                    raw3d.push_back(values[1]);
+                    raw3d.push_back(values[2]);
                 }
             }
         }
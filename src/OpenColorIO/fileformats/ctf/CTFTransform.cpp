@@ -515,8 +515,9 @@ typename std::enable_if<!std::is_floating_point<T>::value, void>::type WriteValu
 template <typename T>
 void SetOStream(T, std::ostream & xml)
 {
+    // The max_digits10 (i.e. 9) significant digits are needed to read back the same float values.
     xml.width(11);
-    xml.precision(8);
+    xml.precision(std::numeric_limits<float>::max_digits10);
 }
 
 template <>
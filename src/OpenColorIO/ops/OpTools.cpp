@@ -5,6 +5,7 @@
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ThreadPool.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -13,36 +14,53 @@ void EvalTransform(const float * in,
                     long numPixels,
                     OpRcPtrVec & ops)
 {
-    std::vector<float> tmp(numPixels * 4);
-
-    // Render the LUT entries (domain) through the ops.
-    const float * values = in;
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        tmp[4 * idx + 0] = values[0];
-        tmp[4 * idx + 1] = values[1];
-        tmp[4 * idx + 2] = values[2];
-        tmp[4 * idx + 3] = 1.0f;
-
-        values += 3;
-    }
-
     ops.finalize();
     ops.optimize(OPTIMIZATION_NONE);
 
+    // The CPU ops are created once and shared by all the threads.
+    std::vector<ConstOpCPURcPtr> cpuOps;
+    cpuOps.reserve(ops.size());
     for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        ConstOpRcPtr op = ops[i];
+        cpuOps.push_back(op->getCPUOp(false));
     }
 
-    float * result = out;
-    for (long idx = 0; idx<numPixels; ++idx)
+    // Render the LUT entries (domain) through the ops by slabs of pixels. The slabs do not
+    // depend on the number of threads so the result is always the same. Note that the input
+    // and the output may be the same buffer as each slab only reads and writes its own pixels.
+    static constexpr long ChunkSize = 4096;
+
+    GetThreadPool().parallelFor(numPixels, ChunkSize, 0, [&](long begin, long end, unsigned)
     {
-        result[0] = tmp[4 * idx + 0];
-        result[1] = tmp[4 * idx + 1];
-        result[2] = tmp[4 * idx + 2];
+        const long numSlabPixels = end - begin;
+        std::vector<float> tmp(numSlabPixels * 4);
 
-        result += 3;
-    }
+        const float * values = in + 3 * begin;
+        for (long idx = 0; idx<numSlabPixels; ++idx)
+        {
+            tmp[4 * idx + 0] = values[0];
+            tmp[4 * idx + 1] = values[1];
+            tmp[4 * idx + 2] = values[2];
+            tmp[4 * idx + 3] = 1.0f;
+
+            values += 3;
+        }
+
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(&tmp[0], &tmp[0], numSlabPixels);
+        }
+
+        float * result = out + 3 * begin;
+        for (long idx = 0; idx<numSlabPixels; ++idx)
+        {
+            result[0] = tmp[4 * idx + 0];
+            result[1] = tmp[4 * idx + 1];
+            result[2] = tmp[4 * idx + 2];
+
+            result += 3;
+        }
+    });
 }
 } // namespace OCIO_NAMESPACE
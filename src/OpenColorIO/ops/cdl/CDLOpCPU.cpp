@@ -4,11 +4,15 @@
 #include <algorithm>
 #include <cmath>
 #include <string.h>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "CDLOpCPU.h"
+#include "CDLOpCPU_AVX2.h"
+#include "CDLOpCPU_AVX512.h"
+#include "CPUInfo.h"
 #include "SSE.h"
 
 
@@ -170,6 +174,51 @@ inline void ApplySaturation(__m128& pix, const __m128 saturation)
     pix = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(pix, luma)));
 }
 
+// Apply func, a function of a RGBA pixel, to the pixels of a planar apply. The saturation mixes
+// the channels so four pixels at a time are transposed into the packed layout, which keeps the
+// results identical to the packed processing. The alpha plane is not written.
+template<typename Func>
+inline void ApplyPlanarPixels(const float * const * inPlanes,
+                              float * const * outPlanes,
+                              long numPixels,
+                              const Func & func)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 pix0 = _mm_loadu_ps(inPlanes[0] + idx);
+        __m128 pix1 = _mm_loadu_ps(inPlanes[1] + idx);
+        __m128 pix2 = _mm_loadu_ps(inPlanes[2] + idx);
+        __m128 pix3 = _mm_loadu_ps(inPlanes[3] + idx);
+
+        _MM_TRANSPOSE4_PS(pix0, pix1, pix2, pix3);
+
+        pix0 = func(pix0);
+        pix1 = func(pix1);
+        pix2 = func(pix2);
+        pix3 = func(pix3);
+
+        _MM_TRANSPOSE4_PS(pix0, pix1, pix2, pix3);
+
+        _mm_storeu_ps(outPlanes[0] + idx, pix0);
+        _mm_storeu_ps(outPlanes[1] + idx, pix1);
+        _mm_storeu_ps(outPlanes[2] + idx, pix2);
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        const __m128 pix = func(_mm_setr_ps(inPlanes[0][idx], inPlanes[1][idx],
+                                            inPlanes[2][idx], inPlanes[3][idx]));
+
+        OCIO_ALIGN(float rgba[4]);
+        _mm_store_ps(rgba, pix);
+
+        outPlanes[0][idx] = rgba[0];
+        outPlanes[1][idx] = rgba[1];
+        outPlanes[2][idx] = rgba[2];
+    }
+}
+
 #endif // OCIO_USE_SSE2
 
 inline void ApplyScale(float * pix, const float scale)
@@ -281,9 +330,66 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
+// Get the fastest function supported by the CPU for the SSE renderers (i.e. using the fast power
+// approximation), if any.
+CDLOpCPUApplyFunc * GetCDLApplyFunc(bool isReverse, bool clamp)
+{
+    CDLOpCPUApplyFunc * applyFunc = nullptr;
+
+    std::ignore = isReverse;
+    std::ignore = clamp;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetCDLApplyFunc(isReverse, clamp);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetCDLApplyFunc(isReverse, clamp);
+    }
+#endif
+
+    return applyFunc;
+}
+
+// The planar function always comes from the same instruction set as the packed one so the
+// packed and planar processing match.
+CDLOpCPUApplyPlanarFunc * GetCDLApplyPlanarFunc(bool isReverse, bool clamp)
+{
+    CDLOpCPUApplyPlanarFunc * applyFunc = nullptr;
+
+    std::ignore = isReverse;
+    std::ignore = clamp;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetCDLApplyPlanarFunc(isReverse, clamp);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetCDLApplyPlanarFunc(isReverse, clamp);
+    }
+#endif
+
+    return applyFunc;
+}
+
 template<bool CLAMP>
 class CDLRendererFwdSSE : public CDLRendererFwd<CLAMP>
 {
@@ -291,9 +397,19 @@ public:
     CDLRendererFwdSSE(ConstCDLOpDataRcPtr & cdl)
         : CDLRendererFwd<CLAMP>(cdl)
     {
+        m_applyFunc = GetCDLApplyFunc(false, CLAMP);
+        m_applyPlanarFunc = GetCDLApplyPlanarFunc(false, CLAMP);
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    CDLOpCPUApplyFunc * m_applyFunc = nullptr;
+    CDLOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -307,6 +423,11 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
@@ -317,9 +438,19 @@ public:
     CDLRendererRevSSE(ConstCDLOpDataRcPtr & cdl)
         : CDLRendererRev<CLAMP>(cdl)
     {
+        m_applyFunc = GetCDLApplyFunc(true, CLAMP);
+        m_applyPlanarFunc = GetCDLApplyPlanarFunc(true, CLAMP);
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    CDLOpCPUApplyFunc * m_applyFunc = nullptr;
+    CDLOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -347,6 +478,16 @@ void LoadRenderParams(const RenderParams & renderParams,
 template<bool CLAMP>
 void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(this->m_renderParams.getSlope(),
+                    this->m_renderParams.getOffset(),
+                    this->m_renderParams.getPower(),
+                    this->m_renderParams.getSaturation(),
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     __m128 slope, offset, power, saturation, pix;
     LoadRenderParams(this->m_renderParams, slope, offset, power, saturation);
 
@@ -373,6 +514,42 @@ void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererFwdSSE<CLAMP>::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(this->m_renderParams.getSlope(),
+                          this->m_renderParams.getOffset(),
+                          this->m_renderParams.getPower(),
+                          this->m_renderParams.getSaturation(),
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    __m128 slope, offset, power, saturation;
+    LoadRenderParams(this->m_renderParams, slope, offset, power, saturation);
+
+    ApplyPlanarPixels(inPlanes, outPlanes, numPixels,
+                      [&](__m128 pix)
+                      {
+                          pix = _mm_mul_ps(pix, slope);
+                          pix = _mm_add_ps(pix, offset);
+
+                          ApplyPower<CLAMP>(pix, power);
+
+                          ApplySaturation(pix, saturation);
+                          ApplyClamp<CLAMP>(pix);
+
+                          return pix;
+                      });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 template<bool CLAMP>
@@ -406,10 +583,48 @@ void CDLRendererFwd<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererFwd<CLAMP>::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const float * slope = m_renderParams.getSlope();
+    float inSlope[3] = {slope[0], slope[1], slope[2]};
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pix[4] = { inPlanes[0][idx], inPlanes[1][idx], inPlanes[2][idx], inPlanes[3][idx] };
+
+        ApplySlope(pix, inSlope);
+        ApplyOffset(pix, m_renderParams.getOffset());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplySaturation(pix, m_renderParams.getSaturation());
+        ApplyClamp<CLAMP>(pix);
+
+        outPlanes[0][idx] = pix[0];
+        outPlanes[1][idx] = pix[1];
+        outPlanes[2][idx] = pix[2];
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 template<bool CLAMP>
 void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(this->m_renderParams.getSlope(),
+                    this->m_renderParams.getOffset(),
+                    this->m_renderParams.getPower(),
+                    this->m_renderParams.getSaturation(),
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     __m128 slopeRev, offsetRev, powerRev, saturationRev, pix;
     LoadRenderParams(this->m_renderParams, slopeRev, offsetRev, powerRev, saturationRev);
 
@@ -437,6 +652,43 @@ void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererRevSSE<CLAMP>::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(this->m_renderParams.getSlope(),
+                          this->m_renderParams.getOffset(),
+                          this->m_renderParams.getPower(),
+                          this->m_renderParams.getSaturation(),
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    __m128 slopeRev, offsetRev, powerRev, saturationRev;
+    LoadRenderParams(this->m_renderParams, slopeRev, offsetRev, powerRev, saturationRev);
+
+    ApplyPlanarPixels(inPlanes, outPlanes, numPixels,
+                      [&](__m128 pix)
+                      {
+                          ApplyClamp<CLAMP>(pix);
+                          ApplySaturation(pix, saturationRev);
+
+                          ApplyPower<CLAMP>(pix, powerRev);
+
+                          pix = _mm_add_ps(pix, offsetRev);
+                          pix = _mm_mul_ps(pix, slopeRev);
+                          ApplyClamp<CLAMP>(pix);
+
+                          return pix;
+                      });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 template<bool CLAMP>
@@ -468,6 +720,32 @@ void CDLRendererRev<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererRev<CLAMP>::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pix[4] = { inPlanes[0][idx], inPlanes[1][idx], inPlanes[2][idx], inPlanes[3][idx] };
+
+        ApplyClamp<CLAMP>(pix);
+        ApplySaturation(pix, m_renderParams.getSaturation());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplyOffset(pix, m_renderParams.getOffset());
+        ApplySlope(pix, m_renderParams.getSlope());
+        ApplyClamp<CLAMP>(pix);
+
+        outPlanes[0][idx] = pix[0];
+        outPlanes[1][idx] = pix[1];
+        outPlanes[2][idx] = pix[2];
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 // Note that if power is 1, the optimizer is able to convert the CDL op into a pair of matrices and
 // clamp (when needed).  So by default, the following will only get called when power is not 1.
 ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct CDLParams
+{
+    __m256 slope[3];
+    __m256 offset[3];
+    __m256 power[3];
+    __m256 saturation;
+};
+
+// Conditionally clamp the values to the range [0, 1] where NaNs become 0.
+template<bool CLAMP>
+inline void ApplyClamp(__m256 (&rgb)[3])
+{
+    if (CLAMP)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm256_min_ps(_mm256_max_ps(rgb[c], _mm256_setzero_ps()),
+                                   _mm256_set1_ps(1.0f));
+        }
+    }
+}
+
+// Apply the power component. In clamp mode the values are first clamped to the range [0, 1],
+// otherwise the negative values are passed through. In both cases NaNs become 0.
+template<bool CLAMP>
+inline void ApplyPower(__m256 (&rgb)[3], const CDLParams & params)
+{
+    ApplyClamp<CLAMP>(rgb);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m256 pix = avx2Power(rgb[c], params.power[c]);
+        rgb[c] = CLAMP ? pix
+                       : _mm256_blendv_ps(pix, rgb[c],
+                                          _mm256_cmp_ps(rgb[c], _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+}
+
+inline void ApplySaturation(__m256 (&rgb)[3], const CDLParams & params)
+{
+    __m256 luma = _mm256_mul_ps(rgb[0], _mm256_set1_ps(0.2126f));
+    luma = _mm256_fmadd_ps(rgb[1], _mm256_set1_ps(0.7152f), luma);
+    luma = _mm256_fmadd_ps(rgb[2], _mm256_set1_ps(0.0722f), luma);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        rgb[c] = _mm256_fmadd_ps(params.saturation, _mm256_sub_ps(rgb[c], luma), luma);
+    }
+}
+
+template<bool isReverse, bool CLAMP>
+inline void ApplyCDL(__m256 (&rgb)[3], const CDLParams & params)
+{
+    if (!isReverse)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm256_fmadd_ps(rgb[c], params.slope[c], params.offset[c]);
+        }
+
+        ApplyPower<CLAMP>(rgb, params);
+        ApplySaturation(rgb, params);
+        ApplyClamp<CLAMP>(rgb);
+    }
+    else
+    {
+        ApplyClamp<CLAMP>(rgb);
+        ApplySaturation(rgb, params);
+        ApplyPower<CLAMP>(rgb, params);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm256_mul_ps(_mm256_add_ps(rgb[c], params.offset[c]), params.slope[c]);
+        }
+
+        ApplyClamp<CLAMP>(rgb);
+    }
+}
+
+// Process 8 RGBA pixels.
+template<bool isReverse, bool CLAMP>
+inline void ApplyCDL(const float * in, float * out, const CDLParams & params)
+{
+    __m256 rgb[3], a;
+
+    // Note that the pixels are shuffled by the transpose i.e. only the channels matter here.
+    avx2RGBATranspose_4x4_4x4(_mm256_loadu_ps(in +  0), _mm256_loadu_ps(in +  8),
+                              _mm256_loadu_ps(in + 16), _mm256_loadu_ps(in + 24),
+                              rgb[0], rgb[1], rgb[2], a);
+
+    ApplyCDL<isReverse, CLAMP>(rgb, params);
+
+    __m256 rgba0, rgba1, rgba2, rgba3;
+    avx2RGBATranspose_4x4_4x4(rgb[0], rgb[1], rgb[2], a, rgba0, rgba1, rgba2, rgba3);
+
+    _mm256_storeu_ps(out +  0, rgba0);
+    _mm256_storeu_ps(out +  8, rgba1);
+    _mm256_storeu_ps(out + 16, rgba2);
+    _mm256_storeu_ps(out + 24, rgba3);
+}
+
+template<bool isReverse, bool CLAMP>
+void ApplyCDLPacked(const float * slope, const float * offset, const float * power,
+                    float saturation, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    CDLParams params;
+    for (int c = 0; c < 3; ++c)
+    {
+        params.slope[c]  = _mm256_set1_ps(slope[c]);
+        params.offset[c] = _mm256_set1_ps(offset[c]);
+        params.power[c]  = _mm256_set1_ps(power[c]);
+    }
+    params.saturation = _mm256_set1_ps(saturation);
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        ApplyCDL<isReverse, CLAMP>(in, out, params);
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (idx < numPixels)
+    {
+        const long remainder = numPixels - idx;
+
+        float buf[32] = {};
+        for (long i = 0; i < 4 * remainder; ++i)
+        {
+            buf[i] = in[i];
+        }
+
+        ApplyCDL<isReverse, CLAMP>(buf, buf, params);
+
+        for (long i = 0; i < 4 * remainder; ++i)
+        {
+            out[i] = buf[i];
+        }
+    }
+}
+
+template<bool isReverse, bool CLAMP>
+void ApplyCDLPlanar(const float * slope, const float * offset, const float * power,
+                    float saturation,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    CDLParams params;
+    for (int c = 0; c < 3; ++c)
+    {
+        params.slope[c]  = _mm256_set1_ps(slope[c]);
+        params.offset[c] = _mm256_set1_ps(offset[c]);
+        params.power[c]  = _mm256_set1_ps(power[c]);
+    }
+    params.saturation = _mm256_set1_ps(saturation);
+
+    __m256 rgb[3];
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration i.e. the planes directly provide the channel registers.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm256_loadu_ps(inPlanes[c] + idx);
+        }
+
+        ApplyCDL<isReverse, CLAMP>(rgb, params);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            _mm256_storeu_ps(outPlanes[c] + idx, rgb[c]);
+        }
+    }
+
+    // Handle the leftover pixels.
+    if (idx < numPixels)
+    {
+        const long remainder = numPixels - idx;
+
+        float buf[3][8] = {};
+        for (int c = 0; c < 3; ++c)
+        {
+            for (long i = 0; i < remainder; ++i)
+            {
+                buf[c][i] = inPlanes[c][idx + i];
+            }
+            rgb[c] = _mm256_loadu_ps(buf[c]);
+        }
+
+        ApplyCDL<isReverse, CLAMP>(rgb, params);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            _mm256_storeu_ps(buf[c], rgb[c]);
+            for (long i = 0; i < remainder; ++i)
+            {
+                outPlanes[c][idx + i] = buf[c][i];
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+CDLOpCPUApplyFunc * AVX2GetCDLApplyFunc(bool isReverse, bool clamp)
+{
+    if (isReverse)
+    {
+        return clamp ? ApplyCDLPacked<true, true> : ApplyCDLPacked<true, false>;
+    }
+    return clamp ? ApplyCDLPacked<false, true> : ApplyCDLPacked<false, false>;
+}
+
+CDLOpCPUApplyPlanarFunc * AVX2GetCDLApplyPlanarFunc(bool isReverse, bool clamp)
+{
+    if (isReverse)
+    {
+        return clamp ? ApplyCDLPlanar<true, true> : ApplyCDLPlanar<true, false>;
+    }
+    return clamp ? ApplyCDLPlanar<false, true> : ApplyCDLPlanar<false, false>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+#define INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// The arguments are the slope, offset & power (i.e. R, G & B values) and the saturation of the
+// render parameters.
+typedef void (CDLOpCPUApplyFunc)(const float *, const float *, const float *, float,
+                                 const void *, void *, long);
+// The planar function only processes the R, G & B planes.
+typedef void (CDLOpCPUApplyPlanarFunc)(const float *, const float *, const float *, float,
+                                       const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+CDLOpCPUApplyFunc * AVX2GetCDLApplyFunc(bool isReverse, bool clamp);
+CDLOpCPUApplyPlanarFunc * AVX2GetCDLApplyPlanarFunc(bool isReverse, bool clamp);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_CDLOP_CPU_AVX2_H */
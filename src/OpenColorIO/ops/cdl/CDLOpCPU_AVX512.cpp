@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct CDLParams
+{
+    __m512 slope[3];
+    __m512 offset[3];
+    __m512 power[3];
+    __m512 saturation;
+};
+
+// Conditionally clamp the values to the range [0, 1] where NaNs become 0.
+template<bool CLAMP>
+inline void ApplyClamp(__m512 (&rgb)[3])
+{
+    if (CLAMP)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm512_min_ps(_mm512_max_ps(rgb[c], _mm512_setzero_ps()),
+                                   _mm512_set1_ps(1.0f));
+        }
+    }
+}
+
+// Apply the power component. In clamp mode the values are first clamped to the range [0, 1],
+// otherwise the negative values are passed through. In both cases NaNs become 0.
+template<bool CLAMP>
+inline void ApplyPower(__m512 (&rgb)[3], const CDLParams & params)
+{
+    ApplyClamp<CLAMP>(rgb);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m512 pix = avx512Power(rgb[c], params.power[c]);
+        rgb[c] = CLAMP ? pix
+                       : _mm512_mask_blend_ps(
+                             _mm512_cmp_ps_mask(rgb[c], _mm512_setzero_ps(), _CMP_LT_OQ),
+                             pix, rgb[c]);
+    }
+}
+
+inline void ApplySaturation(__m512 (&rgb)[3], const CDLParams & params)
+{
+    __m512 luma = _mm512_mul_ps(rgb[0], _mm512_set1_ps(0.2126f));
+    luma = _mm512_fmadd_ps(rgb[1], _mm512_set1_ps(0.7152f), luma);
+    luma = _mm512_fmadd_ps(rgb[2], _mm512_set1_ps(0.0722f), luma);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        rgb[c] = _mm512_fmadd_ps(params.saturation, _mm512_sub_ps(rgb[c], luma), luma);
+    }
+}
+
+template<bool isReverse, bool CLAMP>
+inline void ApplyCDL(__m512 (&rgb)[3], const CDLParams & params)
+{
+    if (!isReverse)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm512_fmadd_ps(rgb[c], params.slope[c], params.offset[c]);
+        }
+
+        ApplyPower<CLAMP>(rgb, params);
+        ApplySaturation(rgb, params);
+        ApplyClamp<CLAMP>(rgb);
+    }
+    else
+    {
+        ApplyClamp<CLAMP>(rgb);
+        ApplySaturation(rgb, params);
+        ApplyPower<CLAMP>(rgb, params);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm512_mul_ps(_mm512_add_ps(rgb[c], params.offset[c]), params.slope[c]);
+        }
+
+        ApplyClamp<CLAMP>(rgb);
+    }
+}
+
+// Process 16 RGBA pixels, where the mask selects the values to load & store.
+template<bool isReverse, bool CLAMP>
+inline void ApplyCDL(const float * in, float * out, const CDLParams & params,
+                     const __mmask16 (&k)[4])
+{
+    __m512 rgb[3], a;
+
+    // Note that the pixels are shuffled by the transpose i.e. only the channels matter here.
+    avx512RGBATranspose_4x4_4x4_4x4_4x4(_mm512_maskz_loadu_ps(k[0], in +  0),
+                                        _mm512_maskz_loadu_ps(k[1], in + 16),
+                                        _mm512_maskz_loadu_ps(k[2], in + 32),
+                                        _mm512_maskz_loadu_ps(k[3], in + 48),
+                                        rgb[0], rgb[1], rgb[2], a);
+
+    ApplyCDL<isReverse, CLAMP>(rgb, params);
+
+    __m512 rgba0, rgba1, rgba2, rgba3;
+    avx512RGBATranspose_4x4_4x4_4x4_4x4(rgb[0], rgb[1], rgb[2], a, rgba0, rgba1, rgba2, rgba3);
+
+    _mm512_mask_storeu_ps(out +  0, k[0], rgba0);
+    _mm512_mask_storeu_ps(out + 16, k[1], rgba1);
+    _mm512_mask_storeu_ps(out + 32, k[2], rgba2);
+    _mm512_mask_storeu_ps(out + 48, k[3], rgba3);
+}
+
+template<bool isReverse, bool CLAMP>
+void ApplyCDLPacked(const float * slope, const float * offset, const float * power,
+                    float saturation, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    CDLParams params;
+    for (int c = 0; c < 3; ++c)
+    {
+        params.slope[c]  = _mm512_set1_ps(slope[c]);
+        params.offset[c] = _mm512_set1_ps(offset[c]);
+        params.power[c]  = _mm512_set1_ps(power[c]);
+    }
+    params.saturation = _mm512_set1_ps(saturation);
+
+    const __mmask16 all = _mm512_int2mask(0xFFFF);
+    const __mmask16 allMasks[4] = { all, all, all, all };
+
+    long idx = 0;
+
+    // Process 16 pixels per iteration.
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        ApplyCDL<isReverse, CLAMP>(in, out, params, allMasks);
+
+        in  += 64;
+        out += 64;
+    }
+
+    // Handle the leftover pixels using masks.
+    if (idx < numPixels)
+    {
+        const long numValues = 4 * (numPixels - idx);
+
+        __mmask16 masks[4];
+        for (long v = 0; v < 4; ++v)
+        {
+            const long n = std::min(std::max(numValues - 16 * v, 0L), 16L);
+            masks[v] = _mm512_int2mask((1 << n) - 1);
+        }
+
+        ApplyCDL<isReverse, CLAMP>(in, out, params, masks);
+    }
+}
+
+template<bool isReverse, bool CLAMP>
+void ApplyCDLPlanar(const float * slope, const float * offset, const float * power,
+                    float saturation,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    CDLParams params;
+    for (int c = 0; c < 3; ++c)
+    {
+        params.slope[c]  = _mm512_set1_ps(slope[c]);
+        params.offset[c] = _mm512_set1_ps(offset[c]);
+        params.power[c]  = _mm512_set1_ps(power[c]);
+    }
+    params.saturation = _mm512_set1_ps(saturation);
+
+    __m512 rgb[3];
+
+    // Process 16 pixels per iteration i.e. the planes directly provide the channel registers.
+    for (long idx = 0; idx < numPixels; idx += 16)
+    {
+        const long n = std::min(numPixels - idx, 16L);
+        const __mmask16 k = _mm512_int2mask((1 << n) - 1);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[c] = _mm512_maskz_loadu_ps(k, inPlanes[c] + idx);
+        }
+
+        ApplyCDL<isReverse, CLAMP>(rgb, params);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            _mm512_mask_storeu_ps(outPlanes[c] + idx, k, rgb[c]);
+        }
+    }
+}
+
+} // anonymous namespace
+
+CDLOpCPUApplyFunc * AVX512GetCDLApplyFunc(bool isReverse, bool clamp)
+{
+    if (isReverse)
+    {
+        return clamp ? ApplyCDLPacked<true, true> : ApplyCDLPacked<true, false>;
+    }
+    return clamp ? ApplyCDLPacked<false, true> : ApplyCDLPacked<false, false>;
+}
+
+CDLOpCPUApplyPlanarFunc * AVX512GetCDLApplyPlanarFunc(bool isReverse, bool clamp)
+{
+    if (isReverse)
+    {
+        return clamp ? ApplyCDLPlanar<true, true> : ApplyCDLPlanar<true, false>;
+    }
+    return clamp ? ApplyCDLPlanar<false, true> : ApplyCDLPlanar<false, false>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -7,8 +7,11 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "DynamicProperty.h"
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX2.h"
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX512.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -17,6 +20,90 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+#if OCIO_USE_SSE2
+// Get the fastest function supported by the CPU for the power computation of the renderers
+// (i.e. using the fast power approximation), if any.
+ECOpCPUApplyFunc * GetECPowerApplyFunc()
+{
+    ECOpCPUApplyFunc * applyFunc = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetECPowerApplyFunc();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetECPowerApplyFunc();
+    }
+#endif
+
+    return applyFunc;
+}
+
+// The planar function always comes from the same instruction set as the packed one so the
+// packed and planar processing match.
+ECOpCPUApplyPlanarFunc * GetECPowerApplyPlanarFunc()
+{
+    ECOpCPUApplyPlanarFunc * applyFunc = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetECPowerApplyPlanarFunc();
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetECPowerApplyPlanarFunc();
+    }
+#endif
+
+    return applyFunc;
+}
+#endif
+
+// Apply out = in * scale + offset to the R, G & B planes of a planar apply.
+void ApplyPlanarScaleOffset(const float * const * inPlanes, float * const * outPlanes,
+                            long numPixels, float scale, float offset)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale + offset;
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
+// Apply out = in * scale to the R, G & B planes of a planar apply.
+void ApplyPlanarScale(const float * const * inPlanes, float * const * outPlanes,
+                      long numPixels, float scale)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale;
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 class ECRendererBase : public OpCPU
 {
 public:
@@ -38,6 +125,16 @@ protected:
 
     float m_pivot = 0.0f;
     float m_logExposureStep = 0.088f;
+
+    // Apply out = pow( in * inScale, power ) * outScale to the R, G & B planes of a planar
+    // apply, using the same instructions as the packed processing.
+    void applyPlanarPower(const float * const * inPlanes, float * const * outPlanes,
+                          long numPixels, float inScale, float power, float outScale) const;
+
+#if OCIO_USE_SSE2
+    ECOpCPUApplyFunc * m_applyPowerFunc = nullptr;
+    ECOpCPUApplyPlanarFunc * m_applyPowerPlanarFunc = nullptr;
+#endif
 };
 
 ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
@@ -59,6 +156,50 @@ ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
     {
         m_gamma = m_gamma->createEditableCopy();
     }
+
+#if OCIO_USE_SSE2
+    m_applyPowerFunc = GetECPowerApplyFunc();
+    m_applyPowerPlanarFunc = GetECPowerApplyPlanarFunc();
+#endif
+}
+
+void ECRendererBase::applyPlanarPower(const float * const * inPlanes, float * const * outPlanes,
+                                      long numPixels,
+                                      float inScale, float power, float outScale) const
+{
+#if OCIO_USE_SSE2
+    if (m_applyPowerPlanarFunc)
+    {
+        m_applyPowerPlanarFunc(inScale, power, outScale, inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    const __m128 mm_inScale  = _mm_set1_ps(inScale);
+    const __m128 mm_power    = _mm_set1_ps(power);
+    const __m128 mm_outScale = _mm_set1_ps(outScale);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [&](int /* c */, __m128 data)
+                   {
+                       return _mm_mul_ps(ssePower(_mm_mul_ps(data, mm_inScale), mm_power),
+                                         mm_outScale);
+                   });
+#else
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // Note: With std::max NAN becomes 0.
+            out[idx] = powf(std::max(0.0f, in[idx] * inScale), power) * outScale;
+        }
+    }
+#endif
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
 }
 
 ECRendererBase::~ECRendererBase()
@@ -135,6 +276,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -181,6 +327,16 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyPowerFunc)
+        {
+            //
+            // out = powf( i * exposure / pivot, contrast ) * pivot
+            //
+            m_applyPowerFunc(exposureVal / m_pivot, contrastVal, m_pivot,
+                             inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 contrast = _mm_set1_ps(contrastVal);
         __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
         __m128 piv = _mm_set1_ps(m_pivot);
@@ -232,6 +388,26 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void ECLinearRenderer::applyPlanar(const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              m_contrast->getValue() *
+                                              m_gamma->getValue());
+    const float exposureVal = powf(2.f, (float)m_exposure->getValue());
+
+    if (contrastVal == 1.f)
+    {
+        ApplyPlanarScale(inPlanes, outPlanes, numPixels, exposureVal);
+    }
+    else
+    {
+        applyPlanarPower(inPlanes, outPlanes, numPixels,
+                         exposureVal / m_pivot, contrastVal, m_pivot);
+    }
+}
+
 class ECLinearRevRenderer : public ECRendererBase
 {
 public:
@@ -239,6 +415,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -281,6 +462,16 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyPowerFunc)
+        {
+            //
+            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+            //
+            m_applyPowerFunc(1.f / m_pivot, invContrastVal, m_pivot * invExposureVal,
+                             inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 inv_contrast = _mm_set1_ps(invContrastVal);
 
         const float pivotOverExposureVal = m_pivot * invExposureVal;
@@ -338,6 +529,26 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void ECLinearRevRenderer::applyPlanar(const float * const * inPlanes,
+                                      float * const * outPlanes,
+                                      long numPixels) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float invContrastVal = 1.f / contrastVal;
+    const float invExposureVal = 1.f / powf(2.f, (float)m_exposure->getValue());
+
+    if (contrastVal == 1.f)
+    {
+        ApplyPlanarScale(inPlanes, outPlanes, numPixels, invExposureVal);
+    }
+    else
+    {
+        applyPlanarPower(inPlanes, outPlanes, numPixels,
+                         1.f / m_pivot, invContrastVal, m_pivot * invExposureVal);
+    }
+}
+
 class ECVideoRenderer : public ECRendererBase
 {
 public:
@@ -345,6 +556,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -391,6 +607,16 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyPowerFunc)
+        {
+            //
+            // out = powf( i * exposure / pivot, contrast ) * pivot
+            //
+            m_applyPowerFunc(exposureVal / m_pivot, contrastVal, m_pivot,
+                             inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 contrast = _mm_set1_ps(contrastVal);
         __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
         __m128 piv = _mm_set1_ps(m_pivot);
@@ -440,6 +666,26 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void ECVideoRenderer::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float exposureVal = powf(powf(2.f, (float)m_exposure->getValue()),
+                                   (float)EC::VIDEO_OETF_POWER);
+
+    if (contrastVal == 1.f)
+    {
+        ApplyPlanarScale(inPlanes, outPlanes, numPixels, exposureVal);
+    }
+    else
+    {
+        applyPlanarPower(inPlanes, outPlanes, numPixels,
+                         exposureVal / m_pivot, contrastVal, m_pivot);
+    }
+}
+
 class ECVideoRevRenderer : public ECRendererBase
 {
 public:
@@ -447,6 +693,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -496,6 +747,16 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyPowerFunc)
+        {
+            //
+            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+            //
+            m_applyPowerFunc(1.f / m_pivot, invContrastVal, m_pivot * invExposureVal,
+                             inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 inv_contrast = _mm_set1_ps(invContrastVal);
         __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
         __m128 inv_pivot = _mm_set1_ps(invPivotVal);
@@ -545,6 +806,27 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
     }
 }
 
+void ECVideoRevRenderer::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
+                                              (m_contrast->getValue() * m_gamma->getValue()));
+    const float invContrastVal = 1.f / contrastVal;
+    const float invExposureVal = 1.f / powf(powf(2.f, (float)m_exposure->getValue()),
+                                            (float)EC::VIDEO_OETF_POWER);
+
+    if (contrastVal == 1.f)
+    {
+        ApplyPlanarScale(inPlanes, outPlanes, numPixels, invExposureVal);
+    }
+    else
+    {
+        applyPlanarPower(inPlanes, outPlanes, numPixels,
+                         1.f / m_pivot, invContrastVal, m_pivot * invExposureVal);
+    }
+}
+
 class ECLogarithmicRenderer : public ECRendererBase
 {
 public:
@@ -552,6 +834,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -629,6 +916,20 @@ void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
+void ECLogarithmicRenderer::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const float exposureVal = (float)m_exposure->getValue() *
+                              m_logExposureStep;
+    const float contrastVal
+        = (float)std::max(EC::MIN_CONTRAST,
+                          (m_contrast->getValue() * m_gamma->getValue()));
+    const float offsetVal = (exposureVal - m_pivot) * contrastVal + m_pivot;
+
+    ApplyPlanarScaleOffset(inPlanes, outPlanes, numPixels, contrastVal, offsetVal);
+}
+
 class ECLogarithmicRevRenderer : public ECRendererBase
 {
 public:
@@ -636,6 +937,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
@@ -682,6 +988,21 @@ void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void ECLogarithmicRevRenderer::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    const float exposureVal = (float)m_exposure->getValue() *
+                              m_logExposureStep;
+    const float inv_contrastVal
+        = (float)std::max(EC::MIN_CONTRAST,
+                          1. / (m_contrast->getValue() * m_gamma->getValue()));
+    const float negOffsetVal = m_pivot - m_pivot * inv_contrastVal -
+                               exposureVal;
+
+    ApplyPlanarScaleOffset(inPlanes, outPlanes, numPixels, inv_contrastVal, negOffsetVal);
+}
+
 }
 
 OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec)
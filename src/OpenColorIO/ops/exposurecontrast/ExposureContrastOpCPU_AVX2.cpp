@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the negative values & NaNs become 0.
+inline __m256 ApplyPowerValues(__m256 values, __m256 inScale, __m256 power, __m256 outScale)
+{
+    return _mm256_mul_ps(avx2Power(_mm256_mul_ps(values, inScale), power), outScale);
+}
+
+inline __m256 ApplyPower(__m256 pixels, __m256 inScale, __m256 power, __m256 outScale)
+{
+    const __m256 out = ApplyPowerValues(pixels, inScale, power, outScale);
+
+    // Restore the alpha values.
+    return _mm256_blend_ps(out, pixels, 0x88);
+}
+
+void ApplyPowerPacked(float inScaleValue, float powerValue, float outScaleValue,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m256 inScale  = _mm256_set1_ps(inScaleValue);
+    const __m256 power    = _mm256_set1_ps(powerValue);
+    const __m256 outScale = _mm256_set1_ps(outScaleValue);
+
+    long idx = 0;
+
+    // Process 4 pixels per iteration.
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m256 pix0 = _mm256_loadu_ps(in);
+        const __m256 pix1 = _mm256_loadu_ps(in + 8);
+
+        _mm256_storeu_ps(out,     ApplyPower(pix0, inScale, power, outScale));
+        _mm256_storeu_ps(out + 8, ApplyPower(pix1, inScale, power, outScale));
+
+        in  += 16;
+        out += 16;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 2)
+    {
+        const __m256i mask = (idx + 2 <= numPixels) ? _mm256_set1_epi32(-1)
+                                                    : _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+
+        const __m256 pix = _mm256_maskload_ps(in, mask);
+        _mm256_maskstore_ps(out, mask, ApplyPower(pix, inScale, power, outScale));
+
+        in  += 8;
+        out += 8;
+    }
+}
+
+void ApplyPowerPlanar(float inScaleValue, float powerValue, float outScaleValue,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    const __m256 inScale  = _mm256_set1_ps(inScaleValue);
+    const __m256 power    = _mm256_set1_ps(powerValue);
+    const __m256 outScale = _mm256_set1_ps(outScaleValue);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        long idx = 0;
+        for (; idx + 8 <= numPixels; idx += 8)
+        {
+            const __m256 values = _mm256_loadu_ps(in + idx);
+            _mm256_storeu_ps(out + idx, ApplyPowerValues(values, inScale, power, outScale));
+        }
+
+        // Handle the leftover values one at a time, using the same instructions.
+        for (; idx < numPixels; ++idx)
+        {
+            const __m256 value = _mm256_castps128_ps256(_mm_load_ss(in + idx));
+            const __m256 res = ApplyPowerValues(value, inScale, power, outScale);
+            _mm_store_ss(out + idx, _mm256_castps256_ps128(res));
+        }
+    }
+}
+
+} // anonymous namespace
+
+ECOpCPUApplyFunc * AVX2GetECPowerApplyFunc()
+{
+    return ApplyPowerPacked;
+}
+
+ECOpCPUApplyPlanarFunc * AVX2GetECPowerApplyPlanarFunc()
+{
+    return ApplyPowerPlanar;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the negative values & NaNs become 0.
+inline __m512 ApplyPowerValues(__m512 values, __m512 inScale, __m512 power, __m512 outScale)
+{
+    return _mm512_mul_ps(avx512Power(_mm512_mul_ps(values, inScale), power), outScale);
+}
+
+inline __m512 ApplyPower(__m512 pixels, __m512 inScale, __m512 power, __m512 outScale)
+{
+    const __m512 out = ApplyPowerValues(pixels, inScale, power, outScale);
+
+    // Restore the alpha values.
+    return _mm512_mask_blend_ps(_mm512_int2mask(0x8888), out, pixels);
+}
+
+// Mask of the first numValues values of a register.
+inline __mmask16 GetMask(long numValues)
+{
+    return _mm512_int2mask((1 << numValues) - 1);
+}
+
+void ApplyPowerPacked(float inScaleValue, float powerValue, float outScaleValue,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m512 inScale  = _mm512_set1_ps(inScaleValue);
+    const __m512 power    = _mm512_set1_ps(powerValue);
+    const __m512 outScale = _mm512_set1_ps(outScaleValue);
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m512 pix0 = _mm512_loadu_ps(in);
+        const __m512 pix1 = _mm512_loadu_ps(in + 16);
+
+        _mm512_storeu_ps(out,      ApplyPower(pix0, inScale, power, outScale));
+        _mm512_storeu_ps(out + 16, ApplyPower(pix1, inScale, power, outScale));
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 4)
+    {
+        const __mmask16 mask = GetMask(4 * std::min(4L, numPixels - idx));
+
+        const __m512 pix = _mm512_maskz_loadu_ps(mask, in);
+        _mm512_mask_storeu_ps(out, mask, ApplyPower(pix, inScale, power, outScale));
+
+        in  += 16;
+        out += 16;
+    }
+}
+
+void ApplyPowerPlanar(float inScaleValue, float powerValue, float outScaleValue,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    const __m512 inScale  = _mm512_set1_ps(inScaleValue);
+    const __m512 power    = _mm512_set1_ps(powerValue);
+    const __m512 outScale = _mm512_set1_ps(outScaleValue);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; idx += 16)
+        {
+            const __mmask16 mask = GetMask(std::min(numPixels - idx, 16L));
+
+            const __m512 values = _mm512_maskz_loadu_ps(mask, in + idx);
+            _mm512_mask_storeu_ps(out + idx, mask,
+                                  ApplyPowerValues(values, inScale, power, outScale));
+        }
+    }
+}
+
+} // anonymous namespace
+
+ECOpCPUApplyFunc * AVX512GetECPowerApplyFunc()
+{
+    return ApplyPowerPacked;
+}
+
+ECOpCPUApplyPlanarFunc * AVX512GetECPowerApplyPlanarFunc()
+{
+    return ApplyPowerPlanar;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
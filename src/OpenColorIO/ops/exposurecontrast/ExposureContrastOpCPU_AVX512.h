@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H
+#define INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// Compute out = pow( in * inScale, power ) * outScale where the arguments are inScale, power
+// & outScale. The alpha channel is not modified.
+typedef void (ECOpCPUApplyFunc)(float, float, float, const void *, void *, long);
+// The planar function only processes the R, G & B planes.
+typedef void (ECOpCPUApplyPlanarFunc)(float, float, float,
+                                      const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+ECOpCPUApplyFunc * AVX512GetECPowerApplyFunc();
+ECOpCPUApplyPlanarFunc * AVX512GetECPowerApplyPlanarFunc();
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX512_H */
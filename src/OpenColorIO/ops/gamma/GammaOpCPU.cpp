@@ -3,11 +3,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ops/gamma/GammaOpCPU.h"
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpCPU_AVX512.h"
 #include "ops/gamma/GammaOpUtils.h"
 
 #include "SSE.h"
@@ -30,6 +34,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
@@ -41,15 +50,75 @@ protected:
 };
 
 #if OCIO_USE_SSE2
+// Get the fastest function supported by the CPU for the SSE renderers (i.e. using the fast power
+// approximation), if any.
+GammaOpCPUApplyFunc * GetGammaApplyFunc(GammaOpData::Style style)
+{
+    GammaOpCPUApplyFunc * applyFunc = nullptr;
+
+    std::ignore = style;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetGammaApplyFunc(style);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetGammaApplyFunc(style);
+    }
+#endif
+
+    return applyFunc;
+}
+
+// The planar function always comes from the same instruction set as the packed one so the
+// packed and planar processing match.
+GammaOpCPUApplyPlanarFunc * GetGammaApplyPlanarFunc(GammaOpData::Style style)
+{
+    GammaOpCPUApplyPlanarFunc * applyFunc = nullptr;
+
+    std::ignore = style;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetGammaApplyPlanarFunc(style);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetGammaApplyPlanarFunc(style);
+    }
+#endif
+
+    return applyFunc;
+}
+
 class GammaBasicOpCPUSSE : public GammaBasicOpCPU
 {
 public:
     explicit GammaBasicOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicOpCPU(gamma)
     {
+        m_applyFunc = GetGammaApplyFunc(gamma->getStyle());
+        m_applyPlanarFunc = GetGammaApplyPlanarFunc(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    GammaOpCPUApplyFunc * m_applyFunc = nullptr;
+    GammaOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -61,6 +130,11 @@ public:
     explicit GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
@@ -70,9 +144,19 @@ public:
     explicit GammaBasicMirrorOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicMirrorOpCPU(gamma)
     {
+        m_applyFunc = GetGammaApplyFunc(gamma->getStyle());
+        m_applyPlanarFunc = GetGammaApplyPlanarFunc(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    GammaOpCPUApplyFunc * m_applyFunc = nullptr;
+    GammaOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -84,6 +168,11 @@ public:
     explicit GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
@@ -93,9 +182,19 @@ public:
     explicit GammaBasicPassThruOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicPassThruOpCPU(gamma)
     {
+        m_applyFunc = GetGammaApplyFunc(gamma->getStyle());
+        m_applyPlanarFunc = GetGammaApplyPlanarFunc(gamma->getStyle());
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    GammaOpCPUApplyFunc * m_applyFunc = nullptr;
+    GammaOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -118,6 +217,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 };
@@ -132,6 +236,10 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -142,6 +250,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
@@ -157,6 +270,10 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -167,6 +284,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 };
@@ -181,6 +303,10 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -191,6 +317,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 };
@@ -205,6 +336,10 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -320,6 +455,13 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+        m_applyFunc(gammaValues, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -337,6 +479,25 @@ void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels
         out += 4;
     }
 }
+
+void GammaBasicOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(gammaValues, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       return ssePower(pixel, _mm_set1_ps(gammaValues[c]));
+                   });
+}
 #endif // OCIO_USE_SSE2
 
 void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -361,6 +522,25 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void GammaBasicOpCPU::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = std::max(0.0f, in[idx]);
+            out[idx] = std::pow(pixel, gammaValues[c]);
+        }
+    }
+}
+
 GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
@@ -369,6 +549,13 @@ GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+        m_applyFunc(gammaValues, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -389,6 +576,29 @@ void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaBasicMirrorOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(gammaValues, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+                       __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+                       pixel = ssePower(abs_pix, _mm_set1_ps(gammaValues[c]));
+                       return _mm_or_ps(sign_pix, pixel);
+                   });
+}
 #endif
 
 void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -413,6 +623,27 @@ void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaBasicMirrorOpCPU::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, in[idx]);
+            const float pixel = std::fabs(in[idx]);
+
+            out[idx] = sign * std::pow(pixel, gammaValues[c]);
+        }
+    }
+}
+
 GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
@@ -421,6 +652,13 @@ GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+        m_applyFunc(gammaValues, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -445,6 +683,32 @@ void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long n
         out += 4;
     }
 }
+
+void GammaBasicPassThruOpCPUSSE::applyPlanar(const float * const * inPlanes,
+                                             float * const * outPlanes,
+                                             long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(gammaValues, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    const __m128 breakPnt = _mm_set1_ps(0.f);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       __m128 data = ssePower(pixel, _mm_set1_ps(gammaValues[c]));
+
+                       __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+
+                       return _mm_or_ps(_mm_and_ps(flag, data),
+                                        _mm_andnot_ps(flag, pixel));
+                   });
+}
 #endif
 
 void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -466,6 +730,25 @@ void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void GammaBasicPassThruOpCPU::applyPlanar(const float * const * inPlanes,
+                                          float * const * outPlanes,
+                                          long numPixels) const
+{
+    const float gammaValues[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = in[idx];
+            out[idx] = pixel > 0.f ? std::pow(pixel, gammaValues[c]) : pixel;
+        }
+    }
+}
+
 GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -520,6 +803,30 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaMoncurveOpCPUFwdSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       const RendererParams & p = *params[c];
+
+                       __m128 data = _mm_add_ps(_mm_mul_ps(pixel, _mm_set1_ps(p.scale)),
+                                                _mm_set1_ps(p.offset));
+
+                       data = ssePower(data, _mm_set1_ps(p.gamma));
+
+                       __m128 flag = _mm_cmpgt_ps(pixel, _mm_set1_ps(p.breakPnt));
+
+                       return _mm_or_ps(_mm_and_ps(flag, data),
+                                        _mm_andnot_ps(flag,
+                                                      _mm_mul_ps(pixel, _mm_set1_ps(p.slope))));
+                   });
+}
 #endif // OCIO_USE_SSE2
 
 void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
@@ -555,6 +862,29 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaMoncurveOpCPUFwd::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const RendererParams & p = *params[c];
+
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = in[idx];
+            const float data = std::pow(pixel * p.scale + p.offset, p.gamma);
+
+            out[idx] = pixel<=p.breakPnt ? pixel * p.slope : data;
+        }
+    }
+}
+
 GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -609,6 +939,30 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaMoncurveOpCPURevSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       const RendererParams & p = *params[c];
+
+                       __m128 data = ssePower(pixel, _mm_set1_ps(p.gamma));
+
+                       data = _mm_sub_ps(_mm_mul_ps(data, _mm_set1_ps(p.scale)),
+                                         _mm_set1_ps(p.offset));
+
+                       __m128 flag = _mm_cmpgt_ps(pixel, _mm_set1_ps(p.breakPnt));
+
+                       return _mm_or_ps(_mm_and_ps(flag, data),
+                                        _mm_andnot_ps(flag,
+                                                      _mm_mul_ps(pixel, _mm_set1_ps(p.slope))));
+                   });
+}
 #endif
 
 void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
@@ -644,6 +998,29 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaMoncurveOpCPURev::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const RendererParams & p = *params[c];
+
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = in[idx];
+            const float data = std::pow(pixel, p.gamma) * p.scale - p.offset;
+
+            out[idx] = pixel<=p.breakPnt ? pixel * p.slope : data;
+        }
+    }
+}
+
 GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -702,6 +1079,35 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
         out += 4;
     }
 }
+
+void GammaMoncurveMirrorOpCPUFwdSSE::applyPlanar(const float * const * inPlanes,
+                                                 float * const * outPlanes,
+                                                 long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       const RendererParams & p = *params[c];
+
+                       __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+                       __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+                       __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, _mm_set1_ps(p.scale)),
+                                                _mm_set1_ps(p.offset));
+
+                       data = ssePower(data, _mm_set1_ps(p.gamma));
+
+                       __m128 flagbrk = _mm_cmpgt_ps(abs_pix, _mm_set1_ps(p.breakPnt));
+
+                       data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                                        _mm_andnot_ps(flagbrk,
+                                                      _mm_mul_ps(abs_pix, _mm_set1_ps(p.slope))));
+
+                       return _mm_or_ps(sign_pix, data);
+                   });
+}
 #endif
 
 void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
@@ -740,6 +1146,30 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
     }
 }
 
+void GammaMoncurveMirrorOpCPUFwd::applyPlanar(const float * const * inPlanes,
+                                              float * const * outPlanes,
+                                              long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const RendererParams & p = *params[c];
+
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, in[idx]);
+            const float pixel = std::fabs(in[idx]);
+            const float data = std::pow(pixel * p.scale + p.offset, p.gamma);
+
+            out[idx] = sign * (pixel <= p.breakPnt ? pixel * p.slope : data);
+        }
+    }
+}
+
 GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -798,6 +1228,35 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
         out += 4;
     }
 }
+
+void GammaMoncurveMirrorOpCPURevSSE::applyPlanar(const float * const * inPlanes,
+                                                 float * const * outPlanes,
+                                                 long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 4,
+                   [&](int c, __m128 pixel)
+                   {
+                       const RendererParams & p = *params[c];
+
+                       __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+                       __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+                       __m128 data = ssePower(abs_pix, _mm_set1_ps(p.gamma));
+
+                       data = _mm_sub_ps(_mm_mul_ps(data, _mm_set1_ps(p.scale)),
+                                         _mm_set1_ps(p.offset));
+
+                       __m128 flagbrk = _mm_cmpgt_ps(abs_pix, _mm_set1_ps(p.breakPnt));
+
+                       data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                                        _mm_andnot_ps(flagbrk,
+                                                      _mm_mul_ps(abs_pix, _mm_set1_ps(p.slope))));
+
+                       return _mm_or_ps(sign_pix, data);
+                   });
+}
 #endif
 
 void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
@@ -837,4 +1296,28 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
     }
 }
 
+void GammaMoncurveMirrorOpCPURev::applyPlanar(const float * const * inPlanes,
+                                              float * const * outPlanes,
+                                              long numPixels) const
+{
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const RendererParams & p = *params[c];
+
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, in[idx]);
+            const float pixel = std::fabs(in[idx]);
+            const float data = std::pow(pixel, p.gamma) * p.scale - p.offset;
+
+            out[idx] = sign * (pixel <= p.breakPnt ? pixel * p.slope : data);
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
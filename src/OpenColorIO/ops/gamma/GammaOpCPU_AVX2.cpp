@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+enum GammaBasicStyle
+{
+    GAMMA_BASIC,
+    GAMMA_BASIC_MIRROR,
+    GAMMA_BASIC_PASS_THRU
+};
+
+template<GammaBasicStyle style>
+inline __m256 ApplyGamma(__m256 pixels, __m256 gamma)
+{
+    switch (style)
+    {
+        case GAMMA_BASIC:
+        {
+            // Negative values & NaNs become 0.
+            return avx2Power(pixels, gamma);
+        }
+        case GAMMA_BASIC_MIRROR:
+        {
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            const __m256 sign = _mm256_and_ps(pixels, signMask);
+            const __m256 abs  = _mm256_andnot_ps(signMask, pixels);
+            return _mm256_or_ps(sign, avx2Power(abs, gamma));
+        }
+        case GAMMA_BASIC_PASS_THRU:
+        {
+            // Negative values & NaNs are passed through.
+            return _mm256_blendv_ps(pixels, avx2Power(pixels, gamma),
+                                    _mm256_cmp_ps(pixels, _mm256_setzero_ps(), _CMP_GT_OQ));
+        }
+    }
+    return pixels;
+}
+
+template<GammaBasicStyle style>
+void ApplyGammaPacked(const float * gammaValues, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    // Each register holds two pixels.
+    const __m256 gamma = _mm256_setr_ps(gammaValues[0], gammaValues[1], gammaValues[2], gammaValues[3],
+                                        gammaValues[0], gammaValues[1], gammaValues[2], gammaValues[3]);
+
+    long idx = 0;
+
+    // Process 4 pixels per iteration.
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m256 pix0 = _mm256_loadu_ps(in);
+        const __m256 pix1 = _mm256_loadu_ps(in + 8);
+
+        _mm256_storeu_ps(out,     ApplyGamma<style>(pix0, gamma));
+        _mm256_storeu_ps(out + 8, ApplyGamma<style>(pix1, gamma));
+
+        in  += 16;
+        out += 16;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 2)
+    {
+        const __m256i mask = (idx + 2 <= numPixels) ? _mm256_set1_epi32(-1)
+                                                    : _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+
+        const __m256 pix = _mm256_maskload_ps(in, mask);
+        _mm256_maskstore_ps(out, mask, ApplyGamma<style>(pix, gamma));
+
+        in  += 8;
+        out += 8;
+    }
+}
+
+template<GammaBasicStyle style>
+void ApplyGammaPlanar(const float * gammaValues,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        const __m256 gamma = _mm256_set1_ps(gammaValues[c]);
+
+        long idx = 0;
+        for (; idx + 8 <= numPixels; idx += 8)
+        {
+            const __m256 pix = _mm256_loadu_ps(in + idx);
+            _mm256_storeu_ps(out + idx, ApplyGamma<style>(pix, gamma));
+        }
+
+        // Handle the leftover values one at a time, using the same instructions.
+        for (; idx < numPixels; ++idx)
+        {
+            const __m256 pix = _mm256_castps128_ps256(_mm_load_ss(in + idx));
+            _mm_store_ss(out + idx, _mm256_castps256_ps128(ApplyGamma<style>(pix, gamma)));
+        }
+    }
+}
+
+} // anonymous namespace
+
+GammaOpCPUApplyFunc * AVX2GetGammaApplyFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGammaPacked<GAMMA_BASIC>;
+
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGammaPacked<GAMMA_BASIC_MIRROR>;
+
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGammaPacked<GAMMA_BASIC_PASS_THRU>;
+
+        case GammaOpData::MONCURVE_FWD:
+        case GammaOpData::MONCURVE_REV:
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            break;
+    }
+    return nullptr;
+}
+
+GammaOpCPUApplyPlanarFunc * AVX2GetGammaApplyPlanarFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC>;
+
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC_MIRROR>;
+
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC_PASS_THRU>;
+
+        case GammaOpData::MONCURVE_FWD:
+        case GammaOpData::MONCURVE_REV:
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            break;
+    }
+    return nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
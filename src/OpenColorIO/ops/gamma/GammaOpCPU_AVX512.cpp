@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+enum GammaBasicStyle
+{
+    GAMMA_BASIC,
+    GAMMA_BASIC_MIRROR,
+    GAMMA_BASIC_PASS_THRU
+};
+
+template<GammaBasicStyle style>
+inline __m512 ApplyGamma(__m512 pixels, __m512 gamma)
+{
+    switch (style)
+    {
+        case GAMMA_BASIC:
+        {
+            // Negative values & NaNs become 0.
+            return avx512Power(pixels, gamma);
+        }
+        case GAMMA_BASIC_MIRROR:
+        {
+            const __m512i signMask = _mm512_set1_epi32(0x80000000);
+            const __m512i sign = _mm512_and_si512(_mm512_castps_si512(pixels), signMask);
+            const __m512 abs
+                = _mm512_castsi512_ps(_mm512_andnot_si512(signMask, _mm512_castps_si512(pixels)));
+            return _mm512_castsi512_ps(
+                _mm512_or_si512(sign, _mm512_castps_si512(avx512Power(abs, gamma))));
+        }
+        case GAMMA_BASIC_PASS_THRU:
+        {
+            // Negative values & NaNs are passed through.
+            return _mm512_mask_blend_ps(
+                _mm512_cmp_ps_mask(pixels, _mm512_setzero_ps(), _CMP_GT_OQ),
+                pixels, avx512Power(pixels, gamma));
+        }
+    }
+    return pixels;
+}
+
+// Mask of the first numValues values of a register.
+inline __mmask16 GetMask(long numValues)
+{
+    return _mm512_int2mask((1 << numValues) - 1);
+}
+
+template<GammaBasicStyle style>
+void ApplyGammaPacked(const float * gammaValues, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    // Each register holds four pixels.
+    const __m512 gamma = _mm512_setr4_ps(gammaValues[0], gammaValues[1],
+                                         gammaValues[2], gammaValues[3]);
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m512 pix0 = _mm512_loadu_ps(in);
+        const __m512 pix1 = _mm512_loadu_ps(in + 16);
+
+        _mm512_storeu_ps(out,      ApplyGamma<style>(pix0, gamma));
+        _mm512_storeu_ps(out + 16, ApplyGamma<style>(pix1, gamma));
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 4)
+    {
+        const __mmask16 mask = GetMask(4 * std::min(4L, numPixels - idx));
+
+        const __m512 pix = _mm512_maskz_loadu_ps(mask, in);
+        _mm512_mask_storeu_ps(out, mask, ApplyGamma<style>(pix, gamma));
+
+        in  += 16;
+        out += 16;
+    }
+}
+
+template<GammaBasicStyle style>
+void ApplyGammaPlanar(const float * gammaValues,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        const __m512 gamma = _mm512_set1_ps(gammaValues[c]);
+
+        for (long idx = 0; idx < numPixels; idx += 16)
+        {
+            const __mmask16 mask = GetMask(std::min(numPixels - idx, 16L));
+
+            const __m512 pix = _mm512_maskz_loadu_ps(mask, in + idx);
+            _mm512_mask_storeu_ps(out + idx, mask, ApplyGamma<style>(pix, gamma));
+        }
+    }
+}
+
+} // anonymous namespace
+
+GammaOpCPUApplyFunc * AVX512GetGammaApplyFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGammaPacked<GAMMA_BASIC>;
+
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGammaPacked<GAMMA_BASIC_MIRROR>;
+
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGammaPacked<GAMMA_BASIC_PASS_THRU>;
+
+        case GammaOpData::MONCURVE_FWD:
+        case GammaOpData::MONCURVE_REV:
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            break;
+    }
+    return nullptr;
+}
+
+GammaOpCPUApplyPlanarFunc * AVX512GetGammaApplyPlanarFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC>;
+
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC_MIRROR>;
+
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGammaPlanar<GAMMA_BASIC_PASS_THRU>;
+
+        case GammaOpData::MONCURVE_FWD:
+        case GammaOpData::MONCURVE_REV:
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            break;
+    }
+    return nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gamma/GammaOpData.h"
+
+// The argument holds the four red, green, blue & alpha powers.
+typedef void (GammaOpCPUApplyFunc)(const float *, const void *, void *, long);
+typedef void (GammaOpCPUApplyPlanarFunc)(const float *,
+                                         const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Only the basic styles are supported, nullptr is returned for the other ones.
+GammaOpCPUApplyFunc * AVX512GetGammaApplyFunc(GammaOpData::Style style);
+GammaOpCPUApplyPlanarFunc * AVX512GetGammaApplyPlanarFunc(GammaOpData::Style style);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H */
@@ -4,15 +4,16 @@
 #include <algorithm>
 #include <cstring>
 #include <cmath>
-#if OCIO_USE_SSE2 == 0
 #include <tuple>
-#endif
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/log/LogOpCPU.h"
+#include "ops/log/LogOpCPU_AVX2.h"
+#include "ops/log/LogOpCPU_AVX512.h"
 #include "ops/log/LogUtils.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -57,6 +58,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
 
@@ -67,12 +73,116 @@ protected:
 };
 
 #if OCIO_USE_SSE2
+// Get the fastest functions supported by the CPU for the SSE renderers (i.e. using the fast log
+// & exp approximations), if any.
+LogOpCPUApplyFunc * GetLogApplyFunc(bool antiLog)
+{
+    LogOpCPUApplyFunc * applyFunc = nullptr;
+
+    std::ignore = antiLog;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetLogApplyFunc(antiLog);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetLogApplyFunc(antiLog);
+    }
+#endif
+
+    return applyFunc;
+}
+
+L2LOpCPUApplyFunc * GetL2LApplyFunc(bool linToLog)
+{
+    L2LOpCPUApplyFunc * applyFunc = nullptr;
+
+    std::ignore = linToLog;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetL2LApplyFunc(linToLog);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetL2LApplyFunc(linToLog);
+    }
+#endif
+
+    return applyFunc;
+}
+
+// The planar functions always come from the same instruction set as the packed ones so the
+// packed and planar processing match.
+LogOpCPUApplyPlanarFunc * GetLogApplyPlanarFunc(bool antiLog)
+{
+    LogOpCPUApplyPlanarFunc * applyFunc = nullptr;
+
+    std::ignore = antiLog;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetLogApplyPlanarFunc(antiLog);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetLogApplyPlanarFunc(antiLog);
+    }
+#endif
+
+    return applyFunc;
+}
+
+L2LOpCPUApplyPlanarFunc * GetL2LApplyPlanarFunc(bool linToLog)
+{
+    L2LOpCPUApplyPlanarFunc * applyFunc = nullptr;
+
+    std::ignore = linToLog;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = AVX2GetL2LApplyPlanarFunc(linToLog);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = AVX512GetL2LApplyPlanarFunc(linToLog);
+    }
+#endif
+
+    return applyFunc;
+}
+
 class Log2LinRendererSSE : public Log2LinRenderer
 {
 public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    L2LOpCPUApplyFunc * m_applyFunc = nullptr;
+    L2LOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -84,6 +194,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
 
@@ -100,6 +215,14 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    L2LOpCPUApplyFunc * m_applyFunc = nullptr;
+    L2LOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -125,6 +248,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
 
@@ -143,6 +271,10 @@ public:
     explicit CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -154,6 +286,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
 
@@ -171,6 +308,10 @@ public:
     explicit CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 #endif
 
@@ -182,6 +323,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     float m_logScale;
 };
@@ -193,6 +339,14 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    LogOpCPUApplyFunc * m_applyFunc = nullptr;
+    LogOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -204,6 +358,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 protected:
     float m_log2_base;
 };
@@ -215,6 +374,14 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
+private:
+    LogOpCPUApplyFunc * m_applyFunc = nullptr;
+    LogOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 #endif
 
@@ -413,13 +580,43 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
     }
 }
 
+void LogRenderer::applyPlanar(const float * const * inPlanes,
+                              float * const * outPlanes,
+                              long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            float value = std::max(minValue, in[idx]);
+            value = log2(value);
+            out[idx] = value * m_logScale;
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
 {
+    m_applyFunc = GetLogApplyFunc(false);
+    m_applyPlanarFunc = GetLogApplyPlanarFunc(false);
 }
 void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_logScale, inImg, outImg, numPixels);
+        return;
+    }
+
     //
     // out = log2( max(in, minValue) ) * logScale;
     //
@@ -449,6 +646,33 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
         out += 4;
     }
 }
+
+void LogRendererSSE::applyPlanar(const float * const * inPlanes,
+                                 float * const * outPlanes,
+                                 long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_logScale, inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+    const __m128 mm_logScale = _mm_set1_ps(m_logScale);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [&](int /* c */, __m128 mm_pixel)
+                   {
+                       mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+                       mm_pixel = sseLog2(mm_pixel);
+                       return _mm_mul_ps(mm_pixel, mm_logScale);
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 // Renderer for AntiLog10 and AntiLog2 operations
@@ -481,14 +705,41 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void AntiLogRenderer::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float value = in[idx] * m_log2_base;
+            out[idx] = exp2(value);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
 {
+    m_applyFunc = GetLogApplyFunc(true);
+    m_applyPlanarFunc = GetLogApplyPlanarFunc(true);
 }
 
 void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_log2_base, inImg, outImg, numPixels);
+        return;
+    }
+
     //
     // out = pow(base, in);
     //
@@ -518,6 +769,28 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         out += 4;
     }
 }
+
+void AntiLogRendererSSE::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_log2_base, inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [&](int /* c */, __m128 mm_pixel)
+                   {
+                       return sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 // Renderer for LogToLin operations
@@ -571,15 +844,44 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Log2LinRenderer::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            float value = in[idx] + m_minuskb[c];
+            value = value * m_kinv[c];
+            value = exp2(value);
+            value = value + m_minusb[c];
+            out[idx] = value * m_minv[c];
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
 {
-
+    m_applyFunc = GetL2LApplyFunc(false);
+    m_applyPlanarFunc = GetL2LApplyPlanarFunc(false);
 }
 
 void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_minuskb, m_kinv, m_minusb, m_minv, inImg, outImg, numPixels);
+        return;
+    }
+
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
     //
@@ -618,6 +920,30 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Log2LinRendererSSE::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_minuskb, m_kinv, m_minusb, m_minv, inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [this](int c, __m128 mm_pixel)
+                   {
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_minuskb[c]));
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_kinv[c]));
+                       mm_pixel = sseExp2(mm_pixel);
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_minusb[c]));
+                       return _mm_mul_ps(mm_pixel, _mm_set1_ps(m_minv[c]));
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 // Renderer for Lin2Log operations
@@ -673,14 +999,47 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Lin2LogRenderer::applyPlanar(const float * const * inPlanes,
+                                  float * const * outPlanes,
+                                  long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            float value = in[idx] * m_m[c];
+            value = value + m_b[c];
+            value = std::max(minValue, value);
+            value = log2(value);
+            value = value * m_klog[c];
+            out[idx] = value + m_kb[c];
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
 {
+    m_applyFunc = GetL2LApplyFunc(true);
+    m_applyPlanarFunc = GetL2LApplyPlanarFunc(true);
 }
 
 void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_m, m_b, m_klog, m_kb, inImg, outImg, numPixels);
+        return;
+    }
+
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
     // out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
@@ -718,6 +1077,35 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Lin2LogRendererSSE::applyPlanar(const float * const * inPlanes,
+                                     float * const * outPlanes,
+                                     long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_m, m_b, m_klog, m_kb, inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [&](int c, __m128 mm_pixel)
+                   {
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_m[c]));
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_b[c]));
+                       mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+                       mm_pixel = sseLog2(mm_pixel);
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_klog[c]));
+                       return _mm_add_ps(mm_pixel, _mm_set1_ps(m_kb[c]));
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 CameraL2LBaseRenderer::CameraL2LBaseRenderer(ConstLogOpDataRcPtr & log)
@@ -801,6 +1189,33 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLog2LinRenderer::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            if (in[idx] < m_logSideBreak[c])
+            {
+                out[idx] = m_linsinv[c] * (in[idx] + m_minuslino[c]);
+            }
+            else
+            {
+                float value = (in[idx] + m_minuskb[c]) * m_kinv[c];
+                value = exp2(value);
+                out[idx] = (value + m_minusb[c]) * m_minv[c];
+            }
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
@@ -857,6 +1272,31 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLog2LinRendererSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [this](int c, __m128 mm_pixel)
+                   {
+                       const __m128 flag = _mm_cmpgt_ps(mm_pixel, _mm_set1_ps(m_logSideBreak[c]));
+
+                       __m128 mm_pixel_lin = _mm_add_ps(mm_pixel, _mm_set1_ps(m_minuslino[c]));
+                       mm_pixel_lin = _mm_mul_ps(mm_pixel_lin, _mm_set1_ps(m_linsinv[c]));
+
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_minuskb[c]));
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_kinv[c]));
+                       mm_pixel = sseExp2(mm_pixel);
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_minusb[c]));
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_minv[c]));
+
+                       return _mm_or_ps(_mm_and_ps(flag, mm_pixel),
+                                        _mm_andnot_ps(flag, mm_pixel_lin));
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 CameraLin2LogRenderer::CameraLin2LogRenderer(ConstLogOpDataRcPtr & log)
@@ -919,6 +1359,36 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLin2LogRenderer::applyPlanar(const float * const * inPlanes,
+                                        float * const * outPlanes,
+                                        long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            if (in[idx] < m_linb[c])
+            {
+                out[idx] = m_linearSlope[c] * in[idx] + m_linearOffset[c];
+            }
+            else
+            {
+                float value = in[idx] * m_m[c] + m_b[c];
+                value = std::max(minValue, value);
+                value = log2(value);
+                out[idx] = value * m_klog[c] + m_kb[c];
+            }
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 #if OCIO_USE_SSE2
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
@@ -979,6 +1449,36 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLin2LogRendererSSE::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    ssePlanarApply(inPlanes, outPlanes, numPixels, 3,
+                   [&](int c, __m128 mm_pixel)
+                   {
+                       const __m128 flag = _mm_cmpgt_ps(mm_pixel, _mm_set1_ps(m_linb[c]));
+
+                       __m128 mm_pixel_lin = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_linearSlope[c]));
+                       mm_pixel_lin = _mm_add_ps(mm_pixel_lin, _mm_set1_ps(m_linearOffset[c]));
+
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_m[c]));
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_b[c]));
+                       mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+                       mm_pixel = sseLog2(mm_pixel);
+                       mm_pixel = _mm_mul_ps(mm_pixel, _mm_set1_ps(m_klog[c]));
+                       mm_pixel = _mm_add_ps(mm_pixel, _mm_set1_ps(m_kb[c]));
+
+                       return _mm_or_ps(_mm_and_ps(flag, mm_pixel),
+                                        _mm_andnot_ps(flag, mm_pixel_lin));
+                   });
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
 #endif
 
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+enum LogStyle
+{
+    LOG,
+    ANTI_LOG,
+    LIN_TO_LOG,
+    LOG_TO_LIN
+};
+
+// The registers hold two pixels i.e. the parameters are repeated and the alpha values ignored.
+struct LogParams
+{
+    __m256 p0;
+    __m256 p1;
+    __m256 p2;
+    __m256 p3;
+};
+
+inline __m256 LoadParams(const float * rgb)
+{
+    return _mm256_setr_ps(rgb[0], rgb[1], rgb[2], 0.0f, rgb[0], rgb[1], rgb[2], 0.0f);
+}
+
+template<LogStyle style>
+inline __m256 ApplyLogValues(__m256 values, const LogParams & params)
+{
+    // Note that the max instruction returns its second argument when the first one is a NaN
+    // i.e. NaNs become the minimum value.
+    const __m256 minValue = _mm256_set1_ps(std::numeric_limits<float>::min());
+
+    __m256 out = values;
+
+    switch (style)
+    {
+        case LOG:
+        {
+            // out = log2( max(in, minValue) ) * logScale
+            out = _mm256_max_ps(out, minValue);
+            out = _mm256_mul_ps(avx2Log2(out), params.p0);
+            break;
+        }
+        case ANTI_LOG:
+        {
+            // out = exp2( in * log2(base) )
+            out = avx2Exp2(_mm256_mul_ps(out, params.p0));
+            break;
+        }
+        case LIN_TO_LOG:
+        {
+            // out = log2( max(in * m + b, minValue) ) * klog + kb
+            out = _mm256_max_ps(_mm256_fmadd_ps(out, params.p0, params.p1), minValue);
+            out = _mm256_fmadd_ps(avx2Log2(out), params.p2, params.p3);
+            break;
+        }
+        case LOG_TO_LIN:
+        {
+            // out = ( exp2( (in - kb) * kinv ) - b ) * minv
+            out = _mm256_mul_ps(_mm256_add_ps(out, params.p0), params.p1);
+            out = _mm256_mul_ps(_mm256_add_ps(avx2Exp2(out), params.p2), params.p3);
+            break;
+        }
+    }
+
+    return out;
+}
+
+template<LogStyle style>
+inline __m256 ApplyLog(__m256 pixels, const LogParams & params)
+{
+    // Restore the alpha values.
+    return _mm256_blend_ps(ApplyLogValues<style>(pixels, params), pixels, 0x88);
+}
+
+template<LogStyle style>
+void ApplyPacked(const LogParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    long idx = 0;
+
+    // Process 4 pixels per iteration.
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m256 pix0 = _mm256_loadu_ps(in);
+        const __m256 pix1 = _mm256_loadu_ps(in + 8);
+
+        _mm256_storeu_ps(out,     ApplyLog<style>(pix0, params));
+        _mm256_storeu_ps(out + 8, ApplyLog<style>(pix1, params));
+
+        in  += 16;
+        out += 16;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 2)
+    {
+        const __m256i mask = (idx + 2 <= numPixels) ? _mm256_set1_epi32(-1)
+                                                    : _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+
+        const __m256 pix = _mm256_maskload_ps(in, mask);
+        _mm256_maskstore_ps(out, mask, ApplyLog<style>(pix, params));
+
+        in  += 8;
+        out += 8;
+    }
+}
+
+template<LogStyle style>
+void ApplyLogPacked(float value, const void * inImg, void * outImg, long numPixels)
+{
+    LogParams params;
+    params.p0 = _mm256_set1_ps(value);
+    params.p1 = params.p2 = params.p3 = _mm256_setzero_ps();
+
+    ApplyPacked<style>(params, inImg, outImg, numPixels);
+}
+
+template<LogStyle style>
+void ApplyL2LPacked(const float * p0, const float * p1, const float * p2, const float * p3,
+                    const void * inImg, void * outImg, long numPixels)
+{
+    LogParams params;
+    params.p0 = LoadParams(p0);
+    params.p1 = LoadParams(p1);
+    params.p2 = LoadParams(p2);
+    params.p3 = LoadParams(p3);
+
+    ApplyPacked<style>(params, inImg, outImg, numPixels);
+}
+
+template<LogStyle style>
+void ApplyPlanar(const LogParams * params,
+                 const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        long idx = 0;
+        for (; idx + 8 <= numPixels; idx += 8)
+        {
+            const __m256 values = _mm256_loadu_ps(in + idx);
+            _mm256_storeu_ps(out + idx, ApplyLogValues<style>(values, params[c]));
+        }
+
+        // Handle the leftover values one at a time, using the same instructions.
+        for (; idx < numPixels; ++idx)
+        {
+            const __m256 value = _mm256_castps128_ps256(_mm_load_ss(in + idx));
+            const __m256 res = ApplyLogValues<style>(value, params[c]);
+            _mm_store_ss(out + idx, _mm256_castps256_ps128(res));
+        }
+    }
+}
+
+template<LogStyle style>
+void ApplyLogPlanar(float value,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    LogParams params[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        params[c].p0 = _mm256_set1_ps(value);
+        params[c].p1 = params[c].p2 = params[c].p3 = _mm256_setzero_ps();
+    }
+
+    ApplyPlanar<style>(params, inPlanes, outPlanes, numPixels);
+}
+
+template<LogStyle style>
+void ApplyL2LPlanar(const float * p0, const float * p1, const float * p2, const float * p3,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    LogParams params[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        params[c].p0 = _mm256_set1_ps(p0[c]);
+        params[c].p1 = _mm256_set1_ps(p1[c]);
+        params[c].p2 = _mm256_set1_ps(p2[c]);
+        params[c].p3 = _mm256_set1_ps(p3[c]);
+    }
+
+    ApplyPlanar<style>(params, inPlanes, outPlanes, numPixels);
+}
+
+} // anonymous namespace
+
+LogOpCPUApplyFunc * AVX2GetLogApplyFunc(bool antiLog)
+{
+    return antiLog ? ApplyLogPacked<ANTI_LOG> : ApplyLogPacked<LOG>;
+}
+
+L2LOpCPUApplyFunc * AVX2GetL2LApplyFunc(bool linToLog)
+{
+    return linToLog ? ApplyL2LPacked<LIN_TO_LOG> : ApplyL2LPacked<LOG_TO_LIN>;
+}
+
+LogOpCPUApplyPlanarFunc * AVX2GetLogApplyPlanarFunc(bool antiLog)
+{
+    return antiLog ? ApplyLogPlanar<ANTI_LOG> : ApplyLogPlanar<LOG>;
+}
+
+L2LOpCPUApplyPlanarFunc * AVX2GetL2LApplyPlanarFunc(bool linToLog)
+{
+    return linToLog ? ApplyL2LPlanar<LIN_TO_LOG> : ApplyL2LPlanar<LOG_TO_LIN>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
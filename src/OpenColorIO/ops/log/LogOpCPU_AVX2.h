@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+#define INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// The argument is the log scale of the log renderer or the log2(base) of the anti-log renderer.
+typedef void (LogOpCPUApplyFunc)(float, const void *, void *, long);
+
+// The arguments are the four red, green & blue parameters of the renderers i.e. the m, b, klog
+// & kb values for the LinToLog renderer and the minuskb, kinv, minusb & minv values for the
+// LogToLin renderer.
+typedef void (L2LOpCPUApplyFunc)(const float *, const float *, const float *, const float *,
+                                 const void *, void *, long);
+
+// The planar functions only process the R, G & B planes as the alpha channel is never modified.
+typedef void (LogOpCPUApplyPlanarFunc)(float, const float * const *, float * const *, long);
+typedef void (L2LOpCPUApplyPlanarFunc)(const float *, const float *, const float *, const float *,
+                                       const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+LogOpCPUApplyFunc * AVX2GetLogApplyFunc(bool antiLog);
+L2LOpCPUApplyFunc * AVX2GetL2LApplyFunc(bool linToLog);
+LogOpCPUApplyPlanarFunc * AVX2GetLogApplyPlanarFunc(bool antiLog);
+L2LOpCPUApplyPlanarFunc * AVX2GetL2LApplyPlanarFunc(bool linToLog);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_LOGOP_CPU_AVX2_H */
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+enum LogStyle
+{
+    LOG,
+    ANTI_LOG,
+    LIN_TO_LOG,
+    LOG_TO_LIN
+};
+
+// The registers hold four pixels i.e. the parameters are repeated and the alpha values ignored.
+struct LogParams
+{
+    __m512 p0;
+    __m512 p1;
+    __m512 p2;
+    __m512 p3;
+};
+
+inline __m512 LoadParams(const float * rgb)
+{
+    return _mm512_setr4_ps(rgb[0], rgb[1], rgb[2], 0.0f);
+}
+
+template<LogStyle style>
+inline __m512 ApplyLogValues(__m512 values, const LogParams & params)
+{
+    // Note that the max instruction returns its second argument when the first one is a NaN
+    // i.e. NaNs become the minimum value.
+    const __m512 minValue = _mm512_set1_ps(std::numeric_limits<float>::min());
+
+    __m512 out = values;
+
+    switch (style)
+    {
+        case LOG:
+        {
+            // out = log2( max(in, minValue) ) * logScale
+            out = _mm512_max_ps(out, minValue);
+            out = _mm512_mul_ps(avx512Log2(out), params.p0);
+            break;
+        }
+        case ANTI_LOG:
+        {
+            // out = exp2( in * log2(base) )
+            out = avx512Exp2(_mm512_mul_ps(out, params.p0));
+            break;
+        }
+        case LIN_TO_LOG:
+        {
+            // out = log2( max(in * m + b, minValue) ) * klog + kb
+            out = _mm512_max_ps(_mm512_fmadd_ps(out, params.p0, params.p1), minValue);
+            out = _mm512_fmadd_ps(avx512Log2(out), params.p2, params.p3);
+            break;
+        }
+        case LOG_TO_LIN:
+        {
+            // out = ( exp2( (in - kb) * kinv ) - b ) * minv
+            out = _mm512_mul_ps(_mm512_add_ps(out, params.p0), params.p1);
+            out = _mm512_mul_ps(_mm512_add_ps(avx512Exp2(out), params.p2), params.p3);
+            break;
+        }
+    }
+
+    return out;
+}
+
+template<LogStyle style>
+inline __m512 ApplyLog(__m512 pixels, const LogParams & params)
+{
+    // Restore the alpha values.
+    return _mm512_mask_blend_ps(_mm512_int2mask(0x8888),
+                                ApplyLogValues<style>(pixels, params), pixels);
+}
+
+// Mask of the first numValues values of a register.
+inline __mmask16 GetMask(long numValues)
+{
+    return _mm512_int2mask((1 << numValues) - 1);
+}
+
+template<LogStyle style>
+void ApplyPacked(const LogParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m512 pix0 = _mm512_loadu_ps(in);
+        const __m512 pix1 = _mm512_loadu_ps(in + 16);
+
+        _mm512_storeu_ps(out,      ApplyLog<style>(pix0, params));
+        _mm512_storeu_ps(out + 16, ApplyLog<style>(pix1, params));
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; idx += 4)
+    {
+        const __mmask16 mask = GetMask(4 * std::min(4L, numPixels - idx));
+
+        const __m512 pix = _mm512_maskz_loadu_ps(mask, in);
+        _mm512_mask_storeu_ps(out, mask, ApplyLog<style>(pix, params));
+
+        in  += 16;
+        out += 16;
+    }
+}
+
+template<LogStyle style>
+void ApplyLogPacked(float value, const void * inImg, void * outImg, long numPixels)
+{
+    LogParams params;
+    params.p0 = _mm512_set1_ps(value);
+    params.p1 = params.p2 = params.p3 = _mm512_setzero_ps();
+
+    ApplyPacked<style>(params, inImg, outImg, numPixels);
+}
+
+template<LogStyle style>
+void ApplyL2LPacked(const float * p0, const float * p1, const float * p2, const float * p3,
+                    const void * inImg, void * outImg, long numPixels)
+{
+    LogParams params;
+    params.p0 = LoadParams(p0);
+    params.p1 = LoadParams(p1);
+    params.p2 = LoadParams(p2);
+    params.p3 = LoadParams(p3);
+
+    ApplyPacked<style>(params, inImg, outImg, numPixels);
+}
+
+template<LogStyle style>
+void ApplyPlanar(const LogParams * params,
+                 const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; idx += 16)
+        {
+            const __mmask16 mask = GetMask(std::min(numPixels - idx, 16L));
+
+            const __m512 values = _mm512_maskz_loadu_ps(mask, in + idx);
+            _mm512_mask_storeu_ps(out + idx, mask, ApplyLogValues<style>(values, params[c]));
+        }
+    }
+}
+
+template<LogStyle style>
+void ApplyLogPlanar(float value,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    LogParams params[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        params[c].p0 = _mm512_set1_ps(value);
+        params[c].p1 = params[c].p2 = params[c].p3 = _mm512_setzero_ps();
+    }
+
+    ApplyPlanar<style>(params, inPlanes, outPlanes, numPixels);
+}
+
+template<LogStyle style>
+void ApplyL2LPlanar(const float * p0, const float * p1, const float * p2, const float * p3,
+                    const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    LogParams params[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        params[c].p0 = _mm512_set1_ps(p0[c]);
+        params[c].p1 = _mm512_set1_ps(p1[c]);
+        params[c].p2 = _mm512_set1_ps(p2[c]);
+        params[c].p3 = _mm512_set1_ps(p3[c]);
+    }
+
+    ApplyPlanar<style>(params, inPlanes, outPlanes, numPixels);
+}
+
+} // anonymous namespace
+
+LogOpCPUApplyFunc * AVX512GetLogApplyFunc(bool antiLog)
+{
+    return antiLog ? ApplyLogPacked<ANTI_LOG> : ApplyLogPacked<LOG>;
+}
+
+L2LOpCPUApplyFunc * AVX512GetL2LApplyFunc(bool linToLog)
+{
+    return linToLog ? ApplyL2LPacked<LIN_TO_LOG> : ApplyL2LPacked<LOG_TO_LIN>;
+}
+
+LogOpCPUApplyPlanarFunc * AVX512GetLogApplyPlanarFunc(bool antiLog)
+{
+    return antiLog ? ApplyLogPlanar<ANTI_LOG> : ApplyLogPlanar<LOG>;
+}
+
+L2LOpCPUApplyPlanarFunc * AVX512GetL2LApplyPlanarFunc(bool linToLog)
+{
+    return linToLog ? ApplyL2LPlanar<LIN_TO_LOG> : ApplyL2LPlanar<LOG_TO_LIN>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -3,12 +3,14 @@
 
 #include <algorithm>
 #include <math.h>
+#include <sstream>
 #include <stdint.h>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Logging.h"
 #include "MathUtils.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/OpTools.h"
@@ -30,16 +32,23 @@ typedef void (apply_lut_func)(const float *lut3d, int dim, const float *src, flo
 class BaseLut3DRenderer : public OpCPU
 {
 public:
-    explicit BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
+    BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked);
     virtual ~BaseLut3DRenderer();
 
+    // Is the LUT stored by 4x4x4 bricks?
+    bool isBricked() const noexcept { return m_bricked; }
+
 protected:
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
     // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
-    // in order to be able to load the LUT using _mm_load_ps.
+    // in order to be able to load the LUT using _mm_load_ps.  When bricked, the
+    // LUT is stored by 4x4x4 bricks (refer to GetLut3DIndexBricked).
     float* createOptLut(const Array::Values& lut) const;
 
+    // Index of a LUT entry in m_optLut.
+    inline int getIndex(int indexR, int indexG, int indexB) const;
+
 protected:
     // Keep all these values because they are invariant during the
     // processing. So to slim the processing code, these variables
@@ -48,6 +57,7 @@ protected:
     unsigned long  m_dim;
     float          m_step;
     int            m_components;
+    bool           m_bricked;
     apply_lut_func *m_applyLutFunc;
 
 private:
@@ -59,7 +69,7 @@ private:
 class Lut3DTetrahedralRenderer : public BaseLut3DRenderer
 {
 public:
-    explicit Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut);
+    Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked);
     virtual ~Lut3DTetrahedralRenderer();
 
     void apply(const void * inImg, void * outImg, long numPixels) const;
@@ -68,7 +78,7 @@ public:
 class Lut3DRenderer : public BaseLut3DRenderer
 {
 public:
-    explicit Lut3DRenderer(ConstLut3DOpDataRcPtr & lut);
+    Lut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked);
     virtual ~Lut3DRenderer();
 
     void apply(const void * inImg, void * outImg, long numPixels) const;
@@ -167,6 +177,44 @@ class InvLut3DRenderer : public OpCPU
         ulongVector     m_levelScales;        // scaling of the tree levels
     };
 
+    // A uniform grid over the domain of the inverse (i.e. the [0, 1] clamped input values)
+    // listing for each bin the LUT cubes whose part inside the domain overlaps the bin.  A
+    // search only tests the cubes of one bin rather than walking the RangeTree.  The cubes of
+    // a bin are kept in the order of the tree leaves so the search finds the same cube as a
+    // tree walk.
+    class CubeGrid
+    {
+    public:
+        CubeGrid() = default;
+        CubeGrid(const CubeGrid &) = delete;
+        CubeGrid & operator=(const CubeGrid &) = delete;
+
+        // Populate the grid using the leaves of a RangeTree built from the grvec values.
+        void initialize(const RangeTree & tree, const float * grvec, unsigned long numBins);
+
+        // Get the cubes (i.e. the indices of the tree leaves) that could contain the inverse
+        // of a [0, 1] clamped value.
+        inline void getCubes(float R, float G, float B,
+                             const unsigned * & first, const unsigned * & last) const
+        {
+            const unsigned long bin = (getBin(R) * m_numBins + getBin(G)) * m_numBins
+                                      + getBin(B);
+            first = m_cubes.data() + m_offsets[bin];
+            last  = m_cubes.data() + m_offsets[bin + 1];
+        }
+
+    private:
+        inline unsigned long getBin(float val) const
+        {
+            const unsigned long bin = (unsigned long)(val * (float)m_numBins);
+            return std::min(bin, m_numBins - 1);
+        }
+
+        unsigned long         m_numBins = 0; // number of bins along each axis
+        std::vector<unsigned> m_offsets;     // offsets to the first cube of each bin
+        std::vector<unsigned> m_cubes;       // cubes of all the bins
+    };
+
 public:
 
     explicit InvLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
@@ -185,6 +233,7 @@ protected:
     long               m_dim;          // grid size of the extrapolated 3d-LUT
     RangeTree          m_tree;         // object to allow fast range queries of
                                        // the LUT
+    CubeGrid           m_grid;         // object to find the cubes to search
     std::vector<float> m_grvec;        // extrapolated 3d-LUT values
 
 private:
@@ -194,6 +243,82 @@ private:
 };
 
 
+typedef void (apply_lut16_func)(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
+// Renderer storing the LUT entries as 16-bit RGB values (refer to OPTIMIZATION_LUT_COMPACT_STORAGE)
+// i.e. 6 bytes per entry instead of the 16 bytes of the padded RGBA float entries of the other
+// renderers.  The values are normalized integers when they are all in [0, 1] and half floats
+// otherwise.  The tetrahedral interpolation gathers and converts the entries using AVX2 or
+// AVX512 when available.  Otherwise, the pixels are processed by blocks: first the entries to
+// interpolate and their weights are computed for all the pixels of the block, then the entries
+// are read and converted to float (using F16C when available).
+class Lut3DCompactRenderer : public OpCPU
+{
+public:
+    explicit Lut3DCompactRenderer(ConstLut3DOpDataRcPtr & lut);
+    virtual ~Lut3DCompactRenderer();
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Max absolute error of the stored LUT values.
+    float getMaxError() const noexcept { return m_maxError; }
+
+    // Are the LUT values stored as half floats (instead of normalized integers)?
+    bool isHalf() const noexcept { return m_half; }
+
+    // Check that all the LUT values could be stored as half floats.
+    static bool IsSupported(ConstLut3DOpDataRcPtr & lut);
+
+protected:
+    // Get the entries to interpolate (i.e. offsets in entries) and their weights for a pixel,
+    // and return the number of entries.
+    int getCorners(const float * in, int * corners, float * weights) const;
+
+    // Interpolate the pixels using their entries and weights.
+    void applyCorners(const int * corners, const float * weights,
+                      const float * in, float * out, long numPixels) const;
+
+private:
+    // The RGB values of the entries followed by a padding value, so that the last entry could
+    // also be read using 32 or 64-bit loads.
+    std::vector<uint16_t> m_lut;
+    long                  m_dim;
+    float                 m_step;
+    bool                  m_tetrahedral;
+    bool                  m_half;
+    float                 m_maxError;
+    apply_lut16_func *    m_applyLutFunc;
+
+    Lut3DCompactRenderer() = delete;
+    Lut3DCompactRenderer(const Lut3DCompactRenderer&) = delete;
+    Lut3DCompactRenderer& operator=(const Lut3DCompactRenderer&) = delete;
+};
+
+inline int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim, int components=3)
+{
+    return components * (indexB + (int)dim * (indexG + (int)dim * indexR));
+}
+
+// The bricked layout stores the LUT by 4x4x4 bricks (with the blue-fastest ordering for the
+// bricks and for the entries of a brick) so the corners of a cube are close in memory (i.e. in
+// one brick most of the time).  It reduces the cache and TLB misses of the large LUTs when the
+// image content is not coherent.  Each side of the LUT is padded to a multiple of 4.
+inline int GetLut3DIndexBricked(int indexR, int indexG, int indexB, long numBricks, int components)
+{
+    const int brick = (indexB >> 2) + (int)numBricks * ((indexG >> 2) + (int)numBricks * (indexR >> 2));
+    const int entry = (indexB & 3) + 4 * ((indexG & 3) + 4 * (indexR & 3));
+    return components * (brick * 64 + entry);
+}
+
+inline long GetLut3DNumBricks(unsigned long dim)
+{
+    return long(dim + 3) / 4;
+}
+
+// The LUT is bricked when its table does not fit in the caches (i.e. the blue-fastest layout is
+// faster for the small LUTs).
+constexpr unsigned long MinBrickedLutSize = 48;
+
 #if OCIO_USE_SSE2
 
 //----------------------------------------------------------------------------
@@ -263,6 +388,31 @@ inline void LookupNearest4(float* optLut,
     res[3] = _mm_load_ps(optLut + offsetInt[3]);
 }
 
+// Same as LookupNearest4 for a LUT stored by 4x4x4 bricks.
+inline void LookupNearest4Bricked(float* optLut,
+                                  const __m128i &rIndices,
+                                  const __m128i &gIndices,
+                                  const __m128i &bIndices,
+                                  long numBricks,
+                                  __m128 res[4])
+{
+    int r[4], g[4], b[4];
+    _mm_storeu_si128((__m128i *)r, rIndices);
+    _mm_storeu_si128((__m128i *)g, gIndices);
+    _mm_storeu_si128((__m128i *)b, bIndices);
+
+    int offsetInt[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        offsetInt[i] = GetLut3DIndexBricked(r[i], g[i], b[i], numBricks, 4);
+    }
+
+    res[0] = _mm_load_ps(optLut + offsetInt[0]);
+    res[1] = _mm_load_ps(optLut + offsetInt[1]);
+    res[2] = _mm_load_ps(optLut + offsetInt[2]);
+    res[3] = _mm_load_ps(optLut + offsetInt[3]);
+}
+
 #else
 
 // Linear
@@ -299,17 +449,13 @@ inline void lerp_rgb(float* out, float* a, float* b, float* c, float* d,
 }
 #endif
 
-inline int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim, int components=3)
-{
-    return components * (indexB + (int)dim * (indexG + (int)dim * indexR));
-}
-
-BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked)
     : OpCPU()
     , m_optLut(0x0)
     , m_dim(0)
     , m_step(0.0f)
     , m_components(0)
+    , m_bricked(bricked)
     , m_applyLutFunc(nullptr)
 {
     updateData(lut);
@@ -347,6 +493,33 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
     const long maxEntries = m_dim * m_dim * m_dim;
 
+    if (m_bricked)
+    {
+        const long numBricks = GetLut3DNumBricks(m_dim);
+        const long size = numBricks * numBricks * numBricks * 64 * m_components;
+
+        float *optLut = (float*)Platform::AlignedMalloc(size * sizeof(float), 16);
+        // The padding entries are never read.
+        std::fill(optLut, optLut + size, 0.0f);
+
+        long idx = 0;
+        for (int r = 0; r < (int)m_dim; ++r)
+        {
+            for (int g = 0; g < (int)m_dim; ++g)
+            {
+                for (int b = 0; b < (int)m_dim; ++b, ++idx)
+                {
+                    float* currentValue = optLut + getIndex(r, g, b);
+                    currentValue[0] = SanitizeFloat(lut[idx * 3]);
+                    currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
+                    currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
+                }
+            }
+        }
+
+        return optLut;
+    }
+
     float *optLut =
         (float*)Platform::AlignedMalloc(maxEntries * m_components * sizeof(float), 16);
 
@@ -367,6 +540,32 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
     const long maxEntries = m_dim * m_dim * m_dim;
 
+    if (m_bricked)
+    {
+        const long numBricks = GetLut3DNumBricks(m_dim);
+        const long size = numBricks * numBricks * numBricks * 64 * m_components;
+
+        // The padding entries are never read.
+        float *optLut = (float*)calloc(size, sizeof(float));
+
+        long idx = 0;
+        for (int r = 0; r < (int)m_dim; ++r)
+        {
+            for (int g = 0; g < (int)m_dim; ++g)
+            {
+                for (int b = 0; b < (int)m_dim; ++b, ++idx)
+                {
+                    float* currentValue = optLut + getIndex(r, g, b);
+                    currentValue[0] = SanitizeFloat(lut[idx * 3]);
+                    currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
+                    currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
+                }
+            }
+        }
+
+        return optLut;
+    }
+
     float *optLut =
         (float*)malloc(maxEntries * m_components * sizeof(float));
 
@@ -383,34 +582,41 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 }
 #endif
 
-Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut)
-    : BaseLut3DRenderer(lut)
+int BaseLut3DRenderer::getIndex(int indexR, int indexG, int indexB) const
+{
+    return m_bricked
+        ? GetLut3DIndexBricked(indexR, indexG, indexB, GetLut3DNumBricks(m_dim), m_components)
+        : GetLut3DIndexBlueFast(indexR, indexG, indexB, m_dim, m_components);
+}
+
+Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked)
+    : BaseLut3DRenderer(lut, bricked)
 {
     #if OCIO_USE_SSE2
     if (CPUInfo::instance().hasSSE2())
     {
-        m_applyLutFunc = applyTetrahedralSSE2;
+        m_applyLutFunc = m_bricked ? applyTetrahedralBrickedSSE2 : applyTetrahedralSSE2;
     }
     #endif
 
     #if OCIO_USE_AVX
     if (CPUInfo::instance().hasAVX() && !CPUInfo::instance().AVXSlow())
     {
-        m_applyLutFunc = applyTetrahedralAVX;
+        m_applyLutFunc = m_bricked ? applyTetrahedralBrickedAVX : applyTetrahedralAVX;
     }
     #endif
 
     #if OCIO_USE_AVX2
     if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
     {
-        m_applyLutFunc = applyTetrahedralAVX2;
+        m_applyLutFunc = m_bricked ? applyTetrahedralBrickedAVX2 : applyTetrahedralAVX2;
     }
     #endif
 
     #if OCIO_USE_AVX512
     if (CPUInfo::instance().hasAVX512())
     {
-        m_applyLutFunc = applyTetrahedralAVX512;
+        m_applyLutFunc = m_bricked ? applyTetrahedralBrickedAVX512 : applyTetrahedralAVX512;
     }
     #endif
 }
@@ -466,29 +672,21 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
 
             // Compute index into LUT for surrounding corners
             const int n000 =
-                GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexLow[2],
-                                    m_dim, m_components);
+                getIndex(indexLow[0], indexLow[1], indexLow[2]);
             const int n100 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexLow[2],
-                                    m_dim, m_components);
+                getIndex(indexHigh[0], indexLow[1], indexLow[2]);
             const int n010 =
-                GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexLow[2],
-                                    m_dim, m_components);
+                getIndex(indexLow[0], indexHigh[1], indexLow[2]);
             const int n001 =
-                GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexHigh[2],
-                                    m_dim, m_components);
+                getIndex(indexLow[0], indexLow[1], indexHigh[2]);
             const int n110 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexLow[2],
-                                    m_dim, m_components);
+                getIndex(indexHigh[0], indexHigh[1], indexLow[2]);
             const int n101 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexHigh[2],
-                                    m_dim, m_components);
+                getIndex(indexHigh[0], indexLow[1], indexHigh[2]);
             const int n011 =
-                GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexHigh[2],
-                                    m_dim, m_components);
+                getIndex(indexLow[0], indexHigh[1], indexHigh[2]);
             const int n111 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexHigh[2],
-                                    m_dim, m_components);
+                getIndex(indexHigh[0], indexHigh[1], indexHigh[2]);
 
             if (fx > fy) {
                 if (fy > fz) {
@@ -623,8 +821,8 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
-Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut)
-    : BaseLut3DRenderer(lut)
+Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool bricked)
+    : BaseLut3DRenderer(lut, bricked)
 {
 }
 
@@ -642,6 +840,7 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     __m128 step = _mm_set1_ps(m_step);
     __m128 maxIdx = _mm_set1_ps((float)(m_dim - 1));
     __m128i dim = _mm_set1_epi32(m_dim);
+    const long numBricks = GetLut3DNumBricks(m_dim);
 
     __m128 v[8];
 
@@ -694,8 +893,16 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         idxB = _mm_unpacklo_epi64(lh23, lh23);
 
         // Lookup 8 corners of cube
-        LookupNearest4(m_optLut, idxR_L0, idxG, idxB, dim, v);
-        LookupNearest4(m_optLut, idxR_H0, idxG, idxB, dim, v + 4);
+        if (m_bricked)
+        {
+            LookupNearest4Bricked(m_optLut, idxR_L0, idxG, idxB, numBricks, v);
+            LookupNearest4Bricked(m_optLut, idxR_H0, idxG, idxB, numBricks, v + 4);
+        }
+        else
+        {
+            LookupNearest4(m_optLut, idxR_L0, idxG, idxB, dim, v);
+            LookupNearest4(m_optLut, idxR_H0, idxG, idxB, dim, v + 4);
+        }
 
         // Perform the trilinear interpolation
         __m128 wr = _mm_shuffle_ps(delta, delta, _MM_SHUFFLE(0, 0, 0, 0));
@@ -775,29 +982,21 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 
         // Compute index into LUT for surrounding corners
         const int n000 =
-            GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexLow[2],
-                                  m_dim);
+            getIndex(indexLow[0], indexLow[1], indexLow[2]);
         const int n100 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexLow[2],
-                                  m_dim);
+            getIndex(indexHigh[0], indexLow[1], indexLow[2]);
         const int n010 =
-            GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexLow[2],
-                                  m_dim);
+            getIndex(indexLow[0], indexHigh[1], indexLow[2]);
         const int n001 =
-            GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexHigh[2],
-                                  m_dim);
+            getIndex(indexLow[0], indexLow[1], indexHigh[2]);
         const int n110 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexLow[2],
-                                  m_dim);
+            getIndex(indexHigh[0], indexHigh[1], indexLow[2]);
         const int n101 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexHigh[2],
-                                  m_dim);
+            getIndex(indexHigh[0], indexLow[1], indexHigh[2]);
         const int n011 =
-            GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexHigh[2],
-                                  m_dim);
+            getIndex(indexLow[0], indexHigh[1], indexHigh[2]);
         const int n111 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexHigh[2],
-                                  m_dim);
+            getIndex(indexHigh[0], indexHigh[1], indexHigh[2]);
 
         float x[3], y[3], z[3];
         x[0] = delta[0]; x[1] = delta[0]; x[2] = delta[0];
@@ -1077,6 +1276,79 @@ unsigned long invert_hypercube
     }
 }
 
+// This function is a fast but conservative version of the test above: it never rejects a
+// grid cell containing the inverse, but it could accept a cell which does not.  The cell is
+// split in the same 6 tetrahedra along the main diagonal and the tetrahedral coordinates of
+// the value are checked with a tolerance much larger than the rounding errors.  A degenerate
+// tetrahedron is always accepted.
+bool may_contain_inverse
+(
+    const float*         gr,
+    const unsigned long* ind2off,
+    const float*         val,
+    const unsigned long* guess
+)
+{
+    const double DET_TOL = 1.0e-8;
+    const double COORD_TOL = 1.0e-6;
+
+    // Tetrahedra as the order of the axes along the path from the first to the last vertex.
+    static const unsigned long paths[6][2] = { {0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 0}, {0, 2} };
+
+    const float* v0 = gr + guess[0] * ind2off[0] + guess[1] * ind2off[1] + guess[2] * ind2off[2];
+    const float* v7 = v0 + ind2off[0] + ind2off[1] + ind2off[2];
+
+    const double d[3] = { double(val[0]) - v0[0], double(val[1]) - v0[1], double(val[2]) - v0[2] };
+
+    for (const auto & path : paths)
+    {
+        const float* v1 = v0 + ind2off[path[0]];
+        const float* v2 = v1 + ind2off[path[1]];
+
+        double e1[3], e2[3], e3[3];
+        for (int k = 0; k < 3; k++)
+        {
+            e1[k] = double(v1[k]) - v0[k];
+            e2[k] = double(v2[k]) - v1[k];
+            e3[k] = double(v7[k]) - v2[k];
+        }
+
+        const double c23[3] = { e2[1] * e3[2] - e2[2] * e3[1],
+                                e2[2] * e3[0] - e2[0] * e3[2],
+                                e2[0] * e3[1] - e2[1] * e3[0] };
+        const double det = e1[0] * c23[0] + e1[1] * c23[1] + e1[2] * c23[2];
+
+        const double norms = (fabs(e1[0]) + fabs(e1[1]) + fabs(e1[2]))
+                           * (fabs(e2[0]) + fabs(e2[1]) + fabs(e2[2]))
+                           * (fabs(e3[0]) + fabs(e3[1]) + fabs(e3[2]));
+        if (fabs(det) <= DET_TOL * norms)
+        {
+            return true;
+        }
+
+        // Solve d = x1 * e1 + x2 * e2 + x3 * e3 using Cramer's rule.
+        const double cd3[3] = { d[1] * e3[2] - d[2] * e3[1],
+                                d[2] * e3[0] - d[0] * e3[2],
+                                d[0] * e3[1] - d[1] * e3[0] };
+        const double c2d[3] = { e2[1] * d[2] - e2[2] * d[1],
+                                e2[2] * d[0] - e2[0] * d[2],
+                                e2[0] * d[1] - e2[1] * d[0] };
+
+        const double x1 = (d[0] * c23[0] + d[1] * c23[1] + d[2] * c23[2]) / det;
+        const double x2 = (e1[0] * cd3[0] + e1[1] * cd3[1] + e1[2] * cd3[2]) / det;
+        const double x3 = (e1[0] * c2d[0] + e1[1] * c2d[1] + e1[2] * c2d[2]) / det;
+
+        // The value is inside the tetrahedron if 1 >= x1 >= x2 >= x3 >= 0.
+        if (x1 <= 1.0 + COORD_TOL && x1 >= x2 - COORD_TOL
+            && x2 >= x3 - COORD_TOL && x3 >= -COORD_TOL)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 InvLut3DRenderer::RangeTree::RangeTree()
 {
 }
@@ -1421,6 +1693,206 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     }
 }*/
 
+// Get the bounds of the intersection of the convex hull of some points with the [0, 1] domain.
+// Return false if the intersection is empty.
+bool get_clipped_bounds(std::vector<float> & pts, float minVals[3], float maxVals[3])
+{
+    // The clipping could add many points, the bounds of the points are then used as is.
+    const size_t MAX_POINTS = 64;
+
+    std::vector<float> clipped;
+    std::vector<float> dists;
+    for (unsigned long axis = 0; axis < 3 && pts.size() <= 3 * MAX_POINTS; axis++)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            // The points are inside when the distance to the domain face is positive.
+            const float bound = (float)side;
+            const size_t numPts = pts.size() / 3;
+            dists.resize(numPts);
+            size_t numOutside = 0;
+            for (size_t p = 0; p < numPts; p++)
+            {
+                dists[p] = side ? bound - pts[3 * p + axis] : pts[3 * p + axis] - bound;
+                numOutside += dists[p] < 0.f ? 1 : 0;
+            }
+
+            if (numOutside == 0)
+            {
+                continue;
+            }
+            else if (numOutside == numPts)
+            {
+                return false;
+            }
+
+            // The hull of the clipped points is the clipped hull when adding the intersections
+            // of the segments joining the inside and the outside points.
+            clipped.clear();
+            for (size_t p = 0; p < numPts; p++)
+            {
+                const float dp = dists[p];
+                if (dp < 0.f)
+                {
+                    continue;
+                }
+
+                clipped.insert(clipped.end(), pts.begin() + 3 * p, pts.begin() + 3 * p + 3);
+
+                for (size_t q = 0; q < numPts && dp > 0.f; q++)
+                {
+                    const float dq = dists[q];
+                    if (dq < 0.f)
+                    {
+                        const float t = dp / (dp - dq);
+                        for (unsigned long k = 0; k < 3; k++)
+                        {
+                            clipped.push_back(k == axis ? bound
+                                                        : pts[3 * p + k]
+                                                          + t * (pts[3 * q + k] - pts[3 * p + k]));
+                        }
+                    }
+                }
+            }
+
+            pts.swap(clipped);
+        }
+    }
+
+    for (unsigned long k = 0; k < 3; k++)
+    {
+        minVals[k] = pts[k];
+        maxVals[k] = pts[k];
+    }
+    for (size_t p = 3; p < pts.size(); p += 3)
+    {
+        for (unsigned long k = 0; k < 3; k++)
+        {
+            minVals[k] = std::min(minVals[k], pts[p + k]);
+            maxVals[k] = std::max(maxVals[k], pts[p + k]);
+        }
+    }
+
+    return true;
+}
+
+void InvLut3DRenderer::CubeGrid::initialize(const RangeTree & tree,
+                                            const float * grvec,
+                                            unsigned long numBins)
+{
+    m_numBins = numBins;
+
+    const unsigned long chans = tree.getChans();
+    const unsigned long * gsz = tree.getGridSize();
+    const treeLevel & leaves = tree.getLevels()[tree.getDepth() - 1];
+    const BaseIndsVec & baseInds = tree.getBaseInds();
+    const unsigned long numCubes = leaves.elems;
+
+    const unsigned long offs[3] = { gsz[2] * gsz[1] * chans, gsz[2] * chans, chans };
+
+    // Get the bins overlapped by the part of a cube inside the domain (i.e. the [0, 1] clamped
+    // input values).  Note that the range of the extrapolated cubes is very large although only
+    // a face is often inside the domain.
+    std::vector<unsigned> cubeBins(numCubes * 6);
+    std::vector<float> pts;
+    for (unsigned long cube = 0; cube < numCubes; cube++)
+    {
+        float minVals[3], maxVals[3];
+        bool inside = true;
+        bool overlaps = true;
+        for (unsigned long k = 0; k < chans; k++)
+        {
+            minVals[k] = leaves.minVals[cube * chans + k];
+            maxVals[k] = leaves.maxVals[cube * chans + k];
+            inside = inside && minVals[k] >= 0.f && maxVals[k] <= 1.f;
+            overlaps = overlaps && maxVals[k] >= 0.f && minVals[k] <= 1.f;
+        }
+
+        if (overlaps && !inside)
+        {
+            // The range of the part of the cube inside the domain.
+            const float * base = grvec + baseInds[cube].inds[0] * offs[0]
+                                       + baseInds[cube].inds[1] * offs[1]
+                                       + baseInds[cube].inds[2] * offs[2];
+            pts.clear();
+            for (unsigned long v = 0; v < 8; v++)
+            {
+                const float * vert = base + ((v >> 2) & 1) * offs[0]
+                                          + ((v >> 1) & 1) * offs[1]
+                                          + (v & 1) * offs[2];
+                pts.insert(pts.end(), vert, vert + 3);
+            }
+
+            overlaps = get_clipped_bounds(pts, minVals, maxVals);
+
+            // Allow for the rounding errors of the clipping.
+            for (unsigned long k = 0; k < chans; k++)
+            {
+                minVals[k] -= 1e-5f;
+                maxVals[k] += 1e-5f;
+            }
+        }
+
+        unsigned * bins = &cubeBins[cube * 6];
+        if (!overlaps)
+        {
+            // Empty range.
+            bins[0] = 1;
+            bins[3] = 0;
+            continue;
+        }
+
+        for (unsigned long k = 0; k < chans; k++)
+        {
+            bins[k]     = (unsigned)getBin(std::max(minVals[k], 0.f));
+            bins[k + 3] = (unsigned)getBin(std::min(maxVals[k], 1.f));
+        }
+    }
+
+    // Count the cubes of each bin, then fill the bins with the cubes in the order of the leaves.
+
+    m_offsets.assign(m_numBins * m_numBins * m_numBins + 1, 0);
+
+    for (unsigned long cube = 0; cube < numCubes; cube++)
+    {
+        const unsigned * bins = &cubeBins[cube * 6];
+        for (unsigned long r = bins[0]; r <= bins[3]; r++)
+        {
+            for (unsigned long g = bins[1]; g <= bins[4]; g++)
+            {
+                for (unsigned long b = bins[2]; b <= bins[5]; b++)
+                {
+                    m_offsets[(r * m_numBins + g) * m_numBins + b + 1]++;
+                }
+            }
+        }
+    }
+
+    for (size_t bin = 1; bin < m_offsets.size(); bin++)
+    {
+        m_offsets[bin] += m_offsets[bin - 1];
+    }
+
+    m_cubes.resize(m_offsets.back());
+
+    std::vector<unsigned> positions(m_offsets.begin(), m_offsets.end() - 1);
+    for (unsigned long cube = 0; cube < numCubes; cube++)
+    {
+        const unsigned * bins = &cubeBins[cube * 6];
+        for (unsigned long r = bins[0]; r <= bins[3]; r++)
+        {
+            for (unsigned long g = bins[1]; g <= bins[4]; g++)
+            {
+                for (unsigned long b = bins[2]; b <= bins[5]; b++)
+                {
+                    const unsigned long bin = (r * m_numBins + g) * m_numBins + b;
+                    m_cubes[positions[bin]++] = (unsigned)cube;
+                }
+            }
+        }
+    }
+}
+
 float* extrapolate(float RGB[3], float center, float scale)
 {
     RGB[0] = (RGB[0] - center) * scale + center;
@@ -1451,6 +1923,11 @@ void InvLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_tree.initialize(m_grvec.data(), m_dim);
     //m_tree.print();
 
+    // Use about one bin per cube of the original LUT (the extrapolated cubes are outside the
+    // domain), but limit the size of the grid for the large LUTs.
+    const unsigned long MaxNumBins = 64;
+    m_grid.initialize(m_tree, m_grvec.data(), std::min((unsigned long)(m_dim - 3), MaxNumBins));
+
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     // (Note that the result should be relative to the unextrapolated LUT,
@@ -1590,8 +2067,6 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
     m_grvec = newArray.getValues();
 }
 
-// TODO apply() needs further optimization work.
-
 void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const unsigned long* gsz = m_tree.getGridSize();
@@ -1636,16 +2111,9 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         offs[i] = offs[i] * chans;
     }
 
-    const unsigned long MAX_LEVELS = 16;
-    unsigned long currentChild[MAX_LEVELS];
-    unsigned long currentNumChildren[MAX_LEVELS];
-    unsigned long currentChildInd[MAX_LEVELS];
-    for (unsigned long i = 0; i<MAX_LEVELS; i++)
-    {
-        currentChild[i] = 0;
-        currentNumChildren[i] = 1;
-        currentChildInd[i] = 0;
-    }
+    const unsigned long depthm1 = depth - 1;
+    const std::vector<float> & minVals = levels[depthm1].minVals;
+    const std::vector<float> & maxVals = levels[depthm1].maxVals;
 
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -1662,87 +2130,331 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         const float G = Clamp(in[1], 0.f, inMax);
         const float B = Clamp(in[2], 0.f, inMax);
 
-        const long depthm1 = depth - 1;
         unsigned long baseIndx[3] = {0, 0, 0};
 
-        currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
-        currentChild[0] = 0;
-        currentChildInd[0] = 0;
-
         // For now, if no result is found, return 0.
         float result[3] = { 0.f, 0.f, 0.f };
 
-        long level = 0;
-        while (level >= 0)
+        // Search the cubes that could contain the inverse in the leaf order (i.e. the order of
+        // a walk of the tree).
+        const unsigned * cube = nullptr;
+        const unsigned * lastCube = nullptr;
+        m_grid.getCubes(R, G, B, cube, lastCube);
+
+        for (; cube != lastCube; ++cube)
         {
-            while (currentChild[level] < currentNumChildren[level])
+            const unsigned long node = *cube;
+            const bool inRange =
+                R >= minVals[node * chans] &&
+                G >= minVals[node * chans + 1] &&
+                B >= minVals[node * chans + 2] &&
+                R <= maxVals[node * chans] &&
+                G <= maxVals[node * chans + 1] &&
+                B <= maxVals[node * chans + 2];
+
+            if (inRange)
             {
-                const unsigned long node = currentChildInd[level];
-                const bool inRange =
-                    R >= levels[level].minVals[node * chans] &&
-                    G >= levels[level].minVals[node * chans + 1] &&
-                    B >= levels[level].minVals[node * chans + 2] &&
-                    R <= levels[level].maxVals[node * chans] &&
-                    G <= levels[level].maxVals[node * chans + 1] &&
-                    B <= levels[level].maxVals[node * chans + 2];
-                currentChild[level]++;
-                currentChildInd[level]++;
-
-                if (inRange)
-                {
-                    if (level == depthm1)
-                    {
-                        for (unsigned long k = 0; k < chans; k++)
-                            baseIndx[k] = baseInds[node].inds[k];
+                for (unsigned long k = 0; k < chans; k++)
+                    baseIndx[k] = baseInds[node].inds[k];
 
-                        float fxval[3] = { R, G, B };
+                float fxval[3] = { R, G, B };
 
-                        const bool valid = (invert_hypercube(3, result, m_grvec.data(),
-                                                             offs, fxval, baseIndx,
-                                                             list_len, ops_list,
-                                                             entering_list, new_vert_list,
-                                                             path_list, path_order) != 0);
+                // Most of the cubes are quickly rejected (e.g. the range of the extrapolated
+                // cubes is very large).
+                if (!may_contain_inverse(m_grvec.data(), offs, fxval, baseIndx))
+                {
+                    continue;
+                }
 
-                        if (valid)
-                        {
-                            level = 0;  // to exit outer loop
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        const int newLevel = level + 1;
-                        currentNumChildren[newLevel] = levels[level].numChildren[node];
-                        currentChildInd[newLevel] = levels[level].child0offsets[node];
-                        level = newLevel;
-                        currentChild[level] = 0;
-                    }
+                const bool valid = (invert_hypercube(3, result, m_grvec.data(),
+                                                     offs, fxval, baseIndx,
+                                                     list_len, ops_list,
+                                                     entering_list, new_vert_list,
+                                                     path_list, path_order) != 0);
+
+                if (valid)
+                {
+                    break;
                 }
             }
-            level--;
+        }
+
+        // Need to subtract 1 since the indices include the extrapolation.
+        out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+        out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+        out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+Lut3DCompactRenderer::Lut3DCompactRenderer(ConstLut3DOpDataRcPtr & lut)
+    : OpCPU()
+    , m_dim(lut->getArray().getLength())
+    , m_step(float(m_dim) - 1.0f)
+    , m_tetrahedral(lut->getConcreteInterpolation() == INTERP_TETRAHEDRAL)
+    , m_half(false)
+    , m_maxError(0.0f)
+    , m_applyLutFunc(nullptr)
+{
+    const Array::Values & values = lut->getArray().getValues();
+    const long numValues = m_dim * m_dim * m_dim * 3;
+
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        const float val = SanitizeFloat(values[idx]);
+        if (val < 0.f || val > 1.f)
+        {
+            m_half = true;
+            break;
+        }
+    }
+
+    m_lut.resize(numValues + 1, 0);
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        const float val = SanitizeFloat(values[idx]);
+
+        float stored = 0.f;
+        if (m_half)
+        {
+            const half hval(val);
+            m_lut[idx] = hval.bits();
+            stored = float(hval);
+        }
+        else
+        {
+            m_lut[idx] = static_cast<uint16_t>(val * 65535.f + 0.5f);
+            stored = float(m_lut[idx]) * (1.f / 65535.f);
+        }
+        m_maxError = std::max(m_maxError, std::abs(stored - val));
+    }
+
+    if (m_tetrahedral)
+    {
+    #if OCIO_USE_AVX2
+        if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+        {
+        #if OCIO_USE_F16C
+            if (m_half && CPUInfo::instance().hasF16C())
+            {
+                m_applyLutFunc = applyTetrahedralHalfAVX2;
+            }
+        #endif
+            if (!m_half)
+            {
+                m_applyLutFunc = applyTetrahedralUnorm16AVX2;
+            }
+        }
+    #endif
+
+    #if OCIO_USE_AVX512
+        if (CPUInfo::instance().hasAVX512())
+        {
+            m_applyLutFunc = m_half ? applyTetrahedralHalfAVX512 : applyTetrahedralUnorm16AVX512;
+        }
+    #endif
+    }
+}
+
+Lut3DCompactRenderer::~Lut3DCompactRenderer()
+{
+}
+
+bool Lut3DCompactRenderer::IsSupported(ConstLut3DOpDataRcPtr & lut)
+{
+    for (const float val : lut->getArray().getValues())
+    {
+        if (std::abs(SanitizeFloat(val)) > HALF_MAX)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int Lut3DCompactRenderer::getCorners(const float * in, int * corners, float * weights) const
+{
+    const float dimMinusOne = float(m_dim) - 1.f;
+
+    // NaNs become 0.
+    const float idx[3] = { Clamp(in[0] * m_step, 0.f, dimMinusOne),
+                           Clamp(in[1] * m_step, 0.f, dimMinusOne),
+                           Clamp(in[2] * m_step, 0.f, dimMinusOne) };
+
+    const int indexLow[3] = { static_cast<int>(std::floor(idx[0])),
+                              static_cast<int>(std::floor(idx[1])),
+                              static_cast<int>(std::floor(idx[2])) };
+
+    // When the idx is exactly equal to an index the delta is zero so the highIdx has no impact.
+    const int indexHigh[3] = { static_cast<int>(std::ceil(idx[0])),
+                               static_cast<int>(std::ceil(idx[1])),
+                               static_cast<int>(std::ceil(idx[2])) };
+
+    const float fx = idx[0] - static_cast<float>(indexLow[0]);
+    const float fy = idx[1] - static_cast<float>(indexLow[1]);
+    const float fz = idx[2] - static_cast<float>(indexLow[2]);
+
+    const int n000 = GetLut3DIndexBlueFast(indexLow[0],  indexLow[1],  indexLow[2],  m_dim, 1);
+    const int n100 = GetLut3DIndexBlueFast(indexHigh[0], indexLow[1],  indexLow[2],  m_dim, 1);
+    const int n010 = GetLut3DIndexBlueFast(indexLow[0],  indexHigh[1], indexLow[2],  m_dim, 1);
+    const int n001 = GetLut3DIndexBlueFast(indexLow[0],  indexLow[1],  indexHigh[2], m_dim, 1);
+    const int n110 = GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexLow[2],  m_dim, 1);
+    const int n101 = GetLut3DIndexBlueFast(indexHigh[0], indexLow[1],  indexHigh[2], m_dim, 1);
+    const int n011 = GetLut3DIndexBlueFast(indexLow[0],  indexHigh[1], indexHigh[2], m_dim, 1);
+    const int n111 = GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexHigh[2], m_dim, 1);
+
+    if (!m_tetrahedral)
+    {
+        corners[0] = n000; weights[0] = (1 - fx) * (1 - fy) * (1 - fz);
+        corners[1] = n001; weights[1] = (1 - fx) * (1 - fy) * fz;
+        corners[2] = n010; weights[2] = (1 - fx) * fy * (1 - fz);
+        corners[3] = n011; weights[3] = (1 - fx) * fy * fz;
+        corners[4] = n100; weights[4] = fx * (1 - fy) * (1 - fz);
+        corners[5] = n101; weights[5] = fx * (1 - fy) * fz;
+        corners[6] = n110; weights[6] = fx * fy * (1 - fz);
+        corners[7] = n111; weights[7] = fx * fy * fz;
+        return 8;
+    }
+
+    // Refer to Lut3DTetrahedralRenderer::apply() for the tetrahedra.
+    corners[0] = n000;
+    corners[3] = n111;
+
+    if (fx > fy)
+    {
+        if (fy > fz)
+        {
+            corners[1] = n100; corners[2] = n110;
+            weights[0] = 1 - fx; weights[1] = fx - fy; weights[2] = fy - fz; weights[3] = fz;
+        }
+        else if (fx > fz)
+        {
+            corners[1] = n100; corners[2] = n101;
+            weights[0] = 1 - fx; weights[1] = fx - fz; weights[2] = fz - fy; weights[3] = fy;
+        }
+        else
+        {
+            corners[1] = n001; corners[2] = n101;
+            weights[0] = 1 - fz; weights[1] = fz - fx; weights[2] = fx - fy; weights[3] = fy;
+        }
+    }
+    else
+    {
+        if (fz > fy)
+        {
+            corners[1] = n001; corners[2] = n011;
+            weights[0] = 1 - fz; weights[1] = fz - fy; weights[2] = fy - fx; weights[3] = fx;
+        }
+        else if (fz > fx)
+        {
+            corners[1] = n010; corners[2] = n011;
+            weights[0] = 1 - fy; weights[1] = fy - fz; weights[2] = fz - fx; weights[3] = fx;
+        }
+        else
+        {
+            corners[1] = n010; corners[2] = n110;
+            weights[0] = 1 - fy; weights[1] = fy - fx; weights[2] = fx - fz; weights[3] = fz;
+        }
+    }
+
+    return 4;
+}
+
+void Lut3DCompactRenderer::applyCorners(const int * corners, const float * weights,
+                                        const float * in, float * out, long numPixels) const
+{
+    const int numCorners = m_tetrahedral ? 4 : 8;
+
+#if OCIO_USE_AVX && OCIO_USE_F16C
+    if (m_half && CPUInfo::instance().hasF16C())
+    {
+        applyHalfCornersF16C(m_lut.data(), corners, weights, numCorners, in, out, (int)numPixels);
+        return;
+    }
+#endif
+
+    const uint16_t * lut = m_lut.data();
 
-            // Need to subtract 1 since the indices include the extrapolation.
-            out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
-            out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
-            out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
-            out[3] = in[3];
+    for (long i = 0; i < numPixels; ++i)
+    {
+        float rgb[3] = { 0.f, 0.f, 0.f };
+        for (int c = 0; c < numCorners; ++c)
+        {
+            const uint16_t * entry = lut + 3 * corners[c];
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                float val = float(entry[channel]) * (1.f / 65535.f);
+                if (m_half)
+                {
+                    half hval;
+                    hval.setBits(entry[channel]);
+                    val = float(hval);
+                }
+                rgb[channel] += weights[c] * val;
+            }
         }
 
+        const float alpha = in[3];
+        out[0] = rgb[0];
+        out[1] = rgb[1];
+        out[2] = rgb[2];
+        out[3] = alpha;
+
+        corners += numCorners;
+        weights += numCorners;
         in  += 4;
         out += 4;
     }
 }
 
+void Lut3DCompactRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    if (m_applyLutFunc && numPixels > 1)
+    {
+        m_applyLutFunc(m_lut.data(), m_dim, in, out, numPixels);
+        return;
+    }
+
+    static constexpr long BlockSize = 64;
+
+    int corners[BlockSize * 8];
+    float weights[BlockSize * 8];
+
+    for (long first = 0; first < numPixels; first += BlockSize)
+    {
+        const long numBlockPixels = std::min(BlockSize, numPixels - first);
+
+        int numCorners = 0;
+        for (long i = 0; i < numBlockPixels; ++i)
+        {
+            numCorners += getCorners(in + 4 * i, corners + numCorners, weights + numCorners);
+        }
+
+        applyCorners(corners, weights, in, out, numBlockPixels);
+
+        in  += 4 * numBlockPixels;
+        out += 4 * numBlockPixels;
+    }
+}
+
 ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
 {
+    const bool bricked = lut->getArray().getLength() >= MinBrickedLutSize;
+
     const Interpolation interp = lut->getConcreteInterpolation();
     if (interp == INTERP_TETRAHEDRAL)
     {
-        return std::make_shared<Lut3DTetrahedralRenderer>(lut);
+        return std::make_shared<Lut3DTetrahedralRenderer>(lut, bricked);
     }
     else
     {
-        return std::make_shared<Lut3DRenderer>(lut);
+        return std::make_shared<Lut3DRenderer>(lut, bricked);
     }
 }
 
@@ -1762,4 +2474,29 @@ ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     throw Exception("Illegal LUT3D direction.");
 }
 
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool compactStorage, float & maxError)
+{
+    maxError = 0.f;
+
+    if (compactStorage && lut->getDirection() == TRANSFORM_DIR_FORWARD
+        && Lut3DCompactRenderer::IsSupported(lut))
+    {
+        auto renderer = std::make_shared<Lut3DCompactRenderer>(lut);
+        maxError = renderer->getMaxError();
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << "3D LUT of size " << lut->getArray().getLength() << " stored as 16-bit "
+                << (renderer->isHalf() ? "half floats" : "normalized integers")
+                << ", max error: " << maxError;
+            LogDebug(oss.str());
+        }
+
+        return renderer;
+    }
+
+    return GetLut3DRenderer(lut);
+}
+
 } // namespace OCIO_NAMESPACE
@@ -14,6 +14,12 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
 
+// Same as above but the forward LUTs are stored with 16-bit entries if requested and possible
+// (refer to OPTIMIZATION_LUT_COMPACT_STORAGE).  The renderer does not keep a reference to the
+// LUT so its float array is released with the ops.  The max error of the stored values is
+// returned (i.e. 0 if the LUT is not stored compactly).
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool compactStorage, float & maxError);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
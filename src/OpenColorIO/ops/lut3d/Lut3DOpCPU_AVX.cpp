@@ -17,6 +17,10 @@ struct Lut3DContextAVX {
     __m256 lutmax;
     __m256 lutsize;
     __m256 lutsize2;
+    // Bricked layout only (refer to axis_offset_avx).
+    __m256 brickstride_r;
+    __m256 brickstride_g;
+    __m256 brickstride_b;
 };
 
 struct rgbavec_avx {
@@ -72,6 +76,22 @@ static inline __m256 blendv_avx(__m256 a, __m256 b, __m256 mask)
 #endif
 }
 
+// Offset of the LUT entries for the indices along an axis i.e. index * stride. For a LUT stored
+// by 4x4x4 bricks, the stride is the one inside a brick and the brick offset is added (i.e.
+// floor(index / 4) * (brick stride - 4 * stride)).
+template<bool bricked>
+static inline __m256 axis_offset_avx(__m256 idx, __m256 stride, __m256 brickstride)
+{
+    __m256 offset = _mm256_mul_ps(idx, stride);
+    if (bricked)
+    {
+        __m256 brick = _mm256_floor_ps(_mm256_mul_ps(idx, _mm256_set1_ps(0.25f)));
+        offset = fmadd_ps_avx(brick, brickstride, offset);
+    }
+    return offset;
+}
+
+template<bool bricked>
 static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m256 r, __m256 g, __m256 b, __m256 a)
 {
     AVX_ALIGN(uint32_t indices[8]);
@@ -108,14 +128,14 @@ static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m
     __m256 next_b = _mm256_min_ps(lut_max, _mm256_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm256_mul_ps(prev_r, lutsize2);
-    next_r = _mm256_mul_ps(next_r, lutsize2);
+    prev_r = axis_offset_avx<bricked>(prev_r, lutsize2, ctx.brickstride_r);
+    next_r = axis_offset_avx<bricked>(next_r, lutsize2, ctx.brickstride_r);
 
-    prev_g = _mm256_mul_ps(prev_g, lutsize);
-    next_g = _mm256_mul_ps(next_g, lutsize);
+    prev_g = axis_offset_avx<bricked>(prev_g, lutsize, ctx.brickstride_g);
+    next_g = axis_offset_avx<bricked>(next_g, lutsize, ctx.brickstride_g);
 
-    prev_b = _mm256_mul_ps(prev_b, four_f);
-    next_b = _mm256_mul_ps(next_b, four_f);
+    prev_b = axis_offset_avx<bricked>(prev_b, four_f, ctx.brickstride_b);
+    next_b = axis_offset_avx<bricked>(next_b, four_f, ctx.brickstride_b);
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -221,7 +241,7 @@ static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
+template<bool bricked, BitDepth inBD, BitDepth outBD>
 static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
@@ -240,6 +260,17 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
     ctx.lutmax   = _mm256_set1_ps(lutmax);
     ctx.lutsize  = _mm256_set1_ps((float)dim * 4);
     ctx.lutsize2 = _mm256_set1_ps((float)dim * dim * 4);
+    ctx.brickstride_r = ctx.brickstride_g = ctx.brickstride_b = _mm256_setzero_ps();
+
+    if (bricked)
+    {
+        const float numBricks = float((dim + 3) / 4);
+        ctx.lutsize       = _mm256_set1_ps(16.0f);
+        ctx.lutsize2      = _mm256_set1_ps(64.0f);
+        ctx.brickstride_r = _mm256_set1_ps(numBricks * numBricks * 256.0f - 256.0f);
+        ctx.brickstride_g = _mm256_set1_ps(numBricks * 256.0f - 64.0f);
+        ctx.brickstride_b = _mm256_set1_ps(256.0f - 16.0f);
+    }
 
     int pixel_count = total_pixel_count / 8 * 8;
     int remainder = total_pixel_count - pixel_count;
@@ -262,7 +293,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx<bricked>(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -300,7 +331,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx<bricked>(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -319,8 +350,41 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
 
 void applyTetrahedralAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVXFunc<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyTetrahedralAVXFunc<false, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralBrickedAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVXFunc<true, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+#if OCIO_USE_F16C
+void applyHalfCornersF16C(const uint16_t *lut3d, const int *corners, const float *weights,
+                          int numCorners, const float *src, float *dst, int total_pixel_count)
+{
+    for (int i = 0; i < total_pixel_count; ++i)
+    {
+        // Each LUT entry is 3 halves, the 64-bit load also reads the first half of the next
+        // entry (or the padding value) which is ignored.
+        __m128 rgba = _mm_setzero_ps();
+        for (int c = 0; c < numCorners; ++c)
+        {
+            const __m128i entry
+                = _mm_loadl_epi64((const __m128i *)(lut3d + 3 * corners[c]));
+            rgba = _mm_add_ps(rgba, _mm_mul_ps(_mm_set1_ps(weights[c]), _mm_cvtph_ps(entry)));
+        }
+
+        const float alpha = src[3];
+        _mm_storeu_ps(dst, rgba);
+        dst[3] = alpha;
+
+        corners += numCorners;
+        weights += numCorners;
+        src += 4;
+        dst += 4;
+    }
 }
+#endif // OCIO_USE_F16C
 
 } // OCIO_NAMESPACE
 
@@ -4,6 +4,8 @@
 #ifndef INCLUDED_OCIO_LUT3DOP_CPU_AVX_H
 #define INCLUDED_OCIO_LUT3DOP_CPU_AVX_H
 
+#include <stdint.h>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
@@ -14,6 +16,16 @@ namespace OCIO_NAMESPACE
 
 void applyTetrahedralAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+// Same as above for a LUT stored by 4x4x4 bricks.
+void applyTetrahedralBrickedAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
+#if OCIO_USE_F16C
+// Interpolate the pixels from LUT entries stored as RGB half floats followed by a padding value.
+// Each pixel uses numCorners entries (i.e. offsets in entries) and weights.
+void applyHalfCornersF16C(const uint16_t *lut3d, const int *corners, const float *weights,
+                          int numCorners, const float *src, float *dst, int total_pixel_count);
+#endif // OCIO_USE_F16C
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX
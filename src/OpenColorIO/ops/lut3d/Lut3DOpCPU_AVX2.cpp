@@ -13,11 +13,24 @@ namespace OCIO_NAMESPACE
 {
 namespace {
 
+// Storage of the LUT entries i.e. RGBA floats, or RGB 16-bit values (refer to
+// Lut3DCompactRenderer).
+enum class Lut3DStorage
+{
+    F32,
+    HALF,
+    UNORM16
+};
+
 struct Lut3DContextAVX2 {
-    const float *lut;
+    const void *lut;
     __m256 lutmax;
     __m256 lutsize;
     __m256 lutsize2;
+    // Bricked layout only (refer to axis_offset_avx2).
+    __m256 brickstride_r;
+    __m256 brickstride_g;
+    __m256 brickstride_b;
 };
 
 struct rgbavec_avx2 {
@@ -25,10 +38,81 @@ struct rgbavec_avx2 {
 };
 
 #define gather_rgb_avx2(src, idx)                               \
-    sample_r = _mm256_i32gather_ps(src+0, idx, 4);              \
-    sample_g = _mm256_i32gather_ps(src+1, idx, 4);              \
-    sample_b = _mm256_i32gather_ps(src+2, idx, 4)
+    gather_rgb_entries_avx2<storage>(src, idx, sample_r, sample_g, sample_b)
+
+template<Lut3DStorage storage>
+static inline void gather_rgb_entries_avx2(const void *src, __m256i idx,
+                                           __m256& r, __m256& g, __m256& b)
+{
+    const float *lut = (const float *)src;
+    r = _mm256_i32gather_ps(lut+0, idx, 4);
+    g = _mm256_i32gather_ps(lut+1, idx, 4);
+    b = _mm256_i32gather_ps(lut+2, idx, 4);
+}
+
+// The 16-bit entries are gathered by two 32-bit loads i.e. R and G, then G and B.
+static inline void gather_rgb16_avx2(const void *src, __m256i idx,
+                                     __m256i& r, __m256i& g, __m256i& b)
+{
+    const uint16_t *lut = (const uint16_t *)src;
+    __m256i rg = _mm256_i32gather_epi32((const int *)(lut+0), idx, 2);
+    __m256i gb = _mm256_i32gather_epi32((const int *)(lut+1), idx, 2);
+
+    r = _mm256_and_si256(rg, _mm256_set1_epi32(0xFFFF));
+    g = _mm256_srli_epi32(rg, 16);
+    b = _mm256_srli_epi32(gb, 16);
+}
+
+template<>
+inline void gather_rgb_entries_avx2<Lut3DStorage::UNORM16>(const void *src, __m256i idx,
+                                                           __m256& r, __m256& g, __m256& b)
+{
+    __m256i ri, gi, bi;
+    gather_rgb16_avx2(src, idx, ri, gi, bi);
+
+    const __m256 scale = _mm256_set1_ps(1.0f / 65535.0f);
+    r = _mm256_mul_ps(_mm256_cvtepi32_ps(ri), scale);
+    g = _mm256_mul_ps(_mm256_cvtepi32_ps(gi), scale);
+    b = _mm256_mul_ps(_mm256_cvtepi32_ps(bi), scale);
+}
+
+#if OCIO_USE_F16C
+// Convert the halves stored in the low 16 bits of the 32-bit elements.
+static inline __m256 half_to_float_avx2(__m256i h)
+{
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(h, h), _MM_SHUFFLE(0, 0, 2, 0));
+    return _mm256_cvtph_ps(_mm256_castsi256_si128(packed));
+}
+
+template<>
+inline void gather_rgb_entries_avx2<Lut3DStorage::HALF>(const void *src, __m256i idx,
+                                                        __m256& r, __m256& g, __m256& b)
+{
+    __m256i ri, gi, bi;
+    gather_rgb16_avx2(src, idx, ri, gi, bi);
 
+    r = half_to_float_avx2(ri);
+    g = half_to_float_avx2(gi);
+    b = half_to_float_avx2(bi);
+}
+#endif // OCIO_USE_F16C
+
+// Offset of the LUT entries for the indices along an axis i.e. index * stride. For a LUT stored
+// by 4x4x4 bricks, the stride is the one inside a brick and the brick offset is added (i.e.
+// floor(index / 4) * (brick stride - 4 * stride)).
+template<bool bricked>
+static inline __m256 axis_offset_avx2(__m256 idx, __m256 stride, __m256 brickstride)
+{
+    __m256 offset = _mm256_mul_ps(idx, stride);
+    if (bricked)
+    {
+        __m256 brick = _mm256_floor_ps(_mm256_mul_ps(idx, _mm256_set1_ps(0.25f)));
+        offset = _mm256_fmadd_ps(brick, brickstride, offset);
+    }
+    return offset;
+}
+
+template<bool bricked, Lut3DStorage storage>
 static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx, __m256& r, __m256& g, __m256& b, __m256& a)
 {
     __m256 x0, x1, x2;
@@ -44,7 +128,8 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     __m256 lutsize2 = ctx.lutsize2;
 
     __m256 one_f    = _mm256_set1_ps(1.0f);
-    __m256 four_f  = _mm256_set1_ps(4.0f);
+    // Number of values per entry.
+    __m256 four_f  = _mm256_set1_ps(storage == Lut3DStorage::F32 ? 4.0f : 3.0f);
 
     __m256 prev_r = _mm256_floor_ps(r);
     __m256 prev_g = _mm256_floor_ps(g);
@@ -60,14 +145,14 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     __m256 next_b = _mm256_min_ps(lut_max, _mm256_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm256_mul_ps(prev_r, lutsize2);
-    next_r = _mm256_mul_ps(next_r, lutsize2);
+    prev_r = axis_offset_avx2<bricked>(prev_r, lutsize2, ctx.brickstride_r);
+    next_r = axis_offset_avx2<bricked>(next_r, lutsize2, ctx.brickstride_r);
 
-    prev_g = _mm256_mul_ps(prev_g, lutsize);
-    next_g = _mm256_mul_ps(next_g, lutsize);
+    prev_g = axis_offset_avx2<bricked>(prev_g, lutsize, ctx.brickstride_g);
+    next_g = axis_offset_avx2<bricked>(next_g, lutsize, ctx.brickstride_g);
 
-    prev_b = _mm256_mul_ps(prev_b, four_f);
-    next_b = _mm256_mul_ps(next_b, four_f);
+    prev_b = axis_offset_avx2<bricked>(prev_b, four_f, ctx.brickstride_b);
+    next_b = axis_offset_avx2<bricked>(next_b, four_f, ctx.brickstride_b);
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -173,8 +258,8 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
+template<bool bricked, Lut3DStorage storage, BitDepth inBD, BitDepth outBD>
+inline void applyTetrahedralAVX2Func(const void *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -192,8 +277,20 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
 
     ctx.lut      = lut3d;
     ctx.lutmax   = _mm256_set1_ps(lutmax);
-    ctx.lutsize  = _mm256_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm256_set1_ps((float)dim * dim * 4);
+    const float entrysize = storage == Lut3DStorage::F32 ? 4.0f : 3.0f;
+    ctx.lutsize  = _mm256_set1_ps((float)dim * entrysize);
+    ctx.lutsize2 = _mm256_set1_ps((float)dim * dim * entrysize);
+    ctx.brickstride_r = ctx.brickstride_g = ctx.brickstride_b = _mm256_setzero_ps();
+
+    if (bricked)
+    {
+        const float numBricks = float((dim + 3) / 4);
+        ctx.lutsize       = _mm256_set1_ps(16.0f);
+        ctx.lutsize2      = _mm256_set1_ps(64.0f);
+        ctx.brickstride_r = _mm256_set1_ps(numBricks * numBricks * 256.0f - 256.0f);
+        ctx.brickstride_g = _mm256_set1_ps(numBricks * 256.0f - 64.0f);
+        ctx.brickstride_b = _mm256_set1_ps(256.0f - 16.0f);
+    }
 
     int pixel_count = numPixels / 8 * 8;
     int remainder = numPixels - pixel_count;
@@ -215,7 +312,7 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx2(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx2<bricked, storage>(ctx, r, g, b, a);
 
         AVX2RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -253,7 +350,7 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx2(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx2<bricked, storage>(ctx, r, g, b, a);
 
         AVX2RGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -272,7 +369,24 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
 
 void applyTetrahedralAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVX2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyTetrahedralAVX2Func<false, Lut3DStorage::F32, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralBrickedAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX2Func<true, Lut3DStorage::F32, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+#if OCIO_USE_F16C
+void applyTetrahedralHalfAVX2(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX2Func<false, Lut3DStorage::HALF, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+#endif // OCIO_USE_F16C
+
+void applyTetrahedralUnorm16AVX2(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX2Func<false, Lut3DStorage::UNORM16, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
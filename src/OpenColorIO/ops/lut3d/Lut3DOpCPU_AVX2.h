@@ -4,6 +4,8 @@
 #ifndef INCLUDED_OCIO_LUT3DOP_CPU_AVX2_H
 #define INCLUDED_OCIO_LUT3DOP_CPU_AVX2_H
 
+#include <stdint.h>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
@@ -14,6 +16,16 @@ namespace OCIO_NAMESPACE
 
 void applyTetrahedralAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+// Same as above for a LUT stored by 4x4x4 bricks.
+void applyTetrahedralBrickedAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
+// Same as above for a LUT stored as RGB 16-bit values followed by a padding value, i.e. half
+// floats or normalized integers (refer to OPTIMIZATION_LUT_COMPACT_STORAGE).
+#if OCIO_USE_F16C
+void applyTetrahedralHalfAVX2(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+#endif // OCIO_USE_F16C
+void applyTetrahedralUnorm16AVX2(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
@@ -13,11 +13,24 @@ namespace OCIO_NAMESPACE
 {
 namespace {
 
+// Storage of the LUT entries i.e. RGBA floats, or RGB 16-bit values (refer to
+// Lut3DCompactRenderer).
+enum class Lut3DStorage
+{
+    F32,
+    HALF,
+    UNORM16
+};
+
 struct Lut3DContextAVX512 {
-    const float *lut;
+    const void *lut;
     __m512 lutmax;
     __m512 lutsize;
     __m512 lutsize2;
+    // Bricked layout only (refer to axis_offset_avx512).
+    __m512 brickstride_r;
+    __m512 brickstride_g;
+    __m512 brickstride_b;
 };
 
 struct rgbavec_avx512 {
@@ -25,10 +38,72 @@ struct rgbavec_avx512 {
 };
 
 #define gather_rgb_avx512(src, idx)                            \
-    sample_r = _mm512_i32gather_ps(idx, (void * )(src+0), 4);  \
-    sample_g = _mm512_i32gather_ps(idx, (void * )(src+1), 4);  \
-    sample_b = _mm512_i32gather_ps(idx, (void * )(src+2), 4)
+    gather_rgb_entries_avx512<storage>(src, idx, sample_r, sample_g, sample_b)
+
+template<Lut3DStorage storage>
+static inline void gather_rgb_entries_avx512(const void *src, __m512i idx,
+                                             __m512& r, __m512& g, __m512& b)
+{
+    const float *lut = (const float *)src;
+    r = _mm512_i32gather_ps(idx, (void * )(lut+0), 4);
+    g = _mm512_i32gather_ps(idx, (void * )(lut+1), 4);
+    b = _mm512_i32gather_ps(idx, (void * )(lut+2), 4);
+}
+
+// The 16-bit entries are gathered by two 32-bit loads i.e. R and G, then G and B.
+static inline void gather_rgb16_avx512(const void *src, __m512i idx,
+                                       __m512i& r, __m512i& g, __m512i& b)
+{
+    const uint16_t *lut = (const uint16_t *)src;
+    __m512i rg = _mm512_i32gather_epi32(idx, (void * )(lut+0), 2);
+    __m512i gb = _mm512_i32gather_epi32(idx, (void * )(lut+1), 2);
+
+    r = _mm512_and_si512(rg, _mm512_set1_epi32(0xFFFF));
+    g = _mm512_srli_epi32(rg, 16);
+    b = _mm512_srli_epi32(gb, 16);
+}
+
+template<>
+inline void gather_rgb_entries_avx512<Lut3DStorage::UNORM16>(const void *src, __m512i idx,
+                                                             __m512& r, __m512& g, __m512& b)
+{
+    __m512i ri, gi, bi;
+    gather_rgb16_avx512(src, idx, ri, gi, bi);
+
+    const __m512 scale = _mm512_set1_ps(1.0f / 65535.0f);
+    r = _mm512_mul_ps(_mm512_cvtepi32_ps(ri), scale);
+    g = _mm512_mul_ps(_mm512_cvtepi32_ps(gi), scale);
+    b = _mm512_mul_ps(_mm512_cvtepi32_ps(bi), scale);
+}
+
+template<>
+inline void gather_rgb_entries_avx512<Lut3DStorage::HALF>(const void *src, __m512i idx,
+                                                          __m512& r, __m512& g, __m512& b)
+{
+    __m512i ri, gi, bi;
+    gather_rgb16_avx512(src, idx, ri, gi, bi);
+
+    r = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(ri));
+    g = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(gi));
+    b = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(bi));
+}
 
+// Offset of the LUT entries for the indices along an axis i.e. index * stride. For a LUT stored
+// by 4x4x4 bricks, the stride is the one inside a brick and the brick offset is added (i.e.
+// floor(index / 4) * (brick stride - 4 * stride)).
+template<bool bricked>
+static inline __m512 axis_offset_avx512(__m512 idx, __m512 stride, __m512 brickstride)
+{
+    __m512 offset = _mm512_mul_ps(idx, stride);
+    if (bricked)
+    {
+        __m512 brick = _mm512_floor_ps(_mm512_mul_ps(idx, _mm512_set1_ps(0.25f)));
+        offset = _mm512_fmadd_ps(brick, brickstride, offset);
+    }
+    return offset;
+}
+
+template<bool bricked, Lut3DStorage storage>
 static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512 &ctx, __m512& r, __m512& g, __m512& b, __m512& a)
 {
     __m512 x0, x1, x2;
@@ -44,7 +119,8 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     __m512 lutsize2 = ctx.lutsize2;
 
     __m512 one_f   = _mm512_set1_ps(1.0f);
-    __m512 four_f  = _mm512_set1_ps(4.0f);
+    // Number of values per entry.
+    __m512 four_f  = _mm512_set1_ps(storage == Lut3DStorage::F32 ? 4.0f : 3.0f);
 
     __m512 prev_r = _mm512_floor_ps(r);
     __m512 prev_g = _mm512_floor_ps(g);
@@ -60,14 +136,14 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     __m512 next_b = _mm512_min_ps(lut_max, _mm512_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm512_mul_ps(prev_r, lutsize2);
-    next_r = _mm512_mul_ps(next_r, lutsize2);
+    prev_r = axis_offset_avx512<bricked>(prev_r, lutsize2, ctx.brickstride_r);
+    next_r = axis_offset_avx512<bricked>(next_r, lutsize2, ctx.brickstride_r);
 
-    prev_g = _mm512_mul_ps(prev_g, lutsize);
-    next_g = _mm512_mul_ps(next_g, lutsize);
+    prev_g = axis_offset_avx512<bricked>(prev_g, lutsize, ctx.brickstride_g);
+    next_g = axis_offset_avx512<bricked>(next_g, lutsize, ctx.brickstride_g);
 
-    prev_b = _mm512_mul_ps(prev_b, four_f);
-    next_b = _mm512_mul_ps(next_b, four_f);
+    prev_b = axis_offset_avx512<bricked>(prev_b, four_f, ctx.brickstride_b);
+    next_b = axis_offset_avx512<bricked>(next_b, four_f, ctx.brickstride_b);
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -173,8 +249,8 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
+template<bool bricked, Lut3DStorage storage, BitDepth inBD, BitDepth outBD>
+inline void applyTetrahedralAVX512Func(const void *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -192,8 +268,20 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
 
     ctx.lut      = lut3d;
     ctx.lutmax   = _mm512_set1_ps(lutmax);
-    ctx.lutsize  = _mm512_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm512_set1_ps((float)dim * dim * 4);
+    const float entrysize = storage == Lut3DStorage::F32 ? 4.0f : 3.0f;
+    ctx.lutsize  = _mm512_set1_ps((float)dim * entrysize);
+    ctx.lutsize2 = _mm512_set1_ps((float)dim * dim * entrysize);
+    ctx.brickstride_r = ctx.brickstride_g = ctx.brickstride_b = _mm512_setzero_ps();
+
+    if (bricked)
+    {
+        const float numBricks = float((dim + 3) / 4);
+        ctx.lutsize       = _mm512_set1_ps(16.0f);
+        ctx.lutsize2      = _mm512_set1_ps(64.0f);
+        ctx.brickstride_r = _mm512_set1_ps(numBricks * numBricks * 256.0f - 256.0f);
+        ctx.brickstride_g = _mm512_set1_ps(numBricks * 256.0f - 64.0f);
+        ctx.brickstride_b = _mm512_set1_ps(256.0f - 16.0f);
+    }
 
     int pixel_count = numPixels / 16 * 16;
     int remainder = numPixels - pixel_count;
@@ -215,7 +303,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx512<bricked, storage>(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -241,7 +329,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx512<bricked, storage>(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::StoreMasked(dst, c.r, c.g, c.b, c.a, remainder);
     }
@@ -251,7 +339,22 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
 
 void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyTetrahedralAVX512Func<false, Lut3DStorage::F32, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralBrickedAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX512Func<true, Lut3DStorage::F32, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralHalfAVX512(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX512Func<false, Lut3DStorage::HALF, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralUnorm16AVX512(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralAVX512Func<false, Lut3DStorage::UNORM16, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
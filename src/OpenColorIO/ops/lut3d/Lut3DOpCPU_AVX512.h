@@ -4,6 +4,8 @@
 #ifndef INCLUDED_OCIO_LUT3DOP_CPU_AVX512_H
 #define INCLUDED_OCIO_LUT3DOP_CPU_AVX512_H
 
+#include <stdint.h>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
@@ -14,6 +16,14 @@ namespace OCIO_NAMESPACE
 
 void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+// Same as above for a LUT stored by 4x4x4 bricks.
+void applyTetrahedralBrickedAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
+// Same as above for a LUT stored as RGB 16-bit values followed by a padding value, i.e. half
+// floats or normalized integers (refer to OPTIMIZATION_LUT_COMPACT_STORAGE).
+void applyTetrahedralHalfAVX512(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+void applyTetrahedralUnorm16AVX512(const uint16_t *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
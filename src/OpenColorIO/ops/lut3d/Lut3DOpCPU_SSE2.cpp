@@ -16,6 +16,10 @@ struct Lut3DContextSSE2 {
     __m128 lutmax;
     __m128 lutsize;
     __m128 lutsize2;
+    // Bricked layout only (refer to axis_offset_sse2).
+    __m128 brickstride_r;
+    __m128 brickstride_g;
+    __m128 brickstride_b;
 };
 
 struct rgbavec_sse2 {
@@ -66,6 +70,22 @@ static inline __m128 fmadd_ps_sse2(__m128 a, __m128 b, __m128 c)
 #endif
 }
 
+// Offset of the LUT entries for the indices along an axis i.e. index * stride. For a LUT stored
+// by 4x4x4 bricks, the stride is the one inside a brick and the brick offset is added (i.e.
+// floor(index / 4) * (brick stride - 4 * stride)).
+template<bool bricked>
+static inline __m128 axis_offset_sse2(__m128 idx, __m128 stride, __m128 brickstride)
+{
+    __m128 offset = _mm_mul_ps(idx, stride);
+    if (bricked)
+    {
+        __m128 brick = floor_ps_sse2(_mm_mul_ps(idx, _mm_set1_ps(0.25f)));
+        offset = fmadd_ps_sse2(brick, brickstride, offset);
+    }
+    return offset;
+}
+
+template<bool bricked>
 static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx, __m128 r, __m128 g, __m128 b, __m128 a)
 {
     SSE2_ALIGN(uint32_t indices[4]);
@@ -102,14 +122,14 @@ static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx,
     __m128 next_b = _mm_min_ps(lut_max, _mm_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm_mul_ps(prev_r, lutsize2);
-    next_r = _mm_mul_ps(next_r, lutsize2);
+    prev_r = axis_offset_sse2<bricked>(prev_r, lutsize2, ctx.brickstride_r);
+    next_r = axis_offset_sse2<bricked>(next_r, lutsize2, ctx.brickstride_r);
 
-    prev_g = _mm_mul_ps(prev_g, lutsize);
-    next_g = _mm_mul_ps(next_g, lutsize);
+    prev_g = axis_offset_sse2<bricked>(prev_g, lutsize, ctx.brickstride_g);
+    next_g = axis_offset_sse2<bricked>(next_g, lutsize, ctx.brickstride_g);
 
-    prev_b = _mm_mul_ps(prev_b, four_f);
-    next_b = _mm_mul_ps(next_b, four_f);
+    prev_b = axis_offset_sse2<bricked>(prev_b, four_f, ctx.brickstride_b);
+    next_b = axis_offset_sse2<bricked>(next_b, four_f, ctx.brickstride_b);
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -215,7 +235,7 @@ static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx,
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
+template<bool bricked, BitDepth inBD, BitDepth outBD>
 static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
@@ -237,6 +257,17 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
     ctx.lutmax   = _mm_set1_ps(lutmax);
     ctx.lutsize  = _mm_set1_ps((float)dim * 4);
     ctx.lutsize2 = _mm_set1_ps((float)dim * dim * 4);
+    ctx.brickstride_r = ctx.brickstride_g = ctx.brickstride_b = _mm_setzero_ps();
+
+    if (bricked)
+    {
+        const float numBricks = float((dim + 3) / 4);
+        ctx.lutsize       = _mm_set1_ps(16.0f);
+        ctx.lutsize2      = _mm_set1_ps(64.0f);
+        ctx.brickstride_r = _mm_set1_ps(numBricks * numBricks * 256.0f - 256.0f);
+        ctx.brickstride_g = _mm_set1_ps(numBricks * 256.0f - 64.0f);
+        ctx.brickstride_b = _mm_set1_ps(256.0f - 16.0f);
+    }
 
     int pixel_count = total_pixel_count / 4 * 4;
     int remainder = total_pixel_count - pixel_count;
@@ -258,7 +289,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp_tetrahedral_sse2<bricked>(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -295,7 +326,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp_tetrahedral_sse2<bricked>(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -313,7 +344,12 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyTetrahedralSSE2Func<false, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTetrahedralBrickedSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyTetrahedralSSE2Func<true, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
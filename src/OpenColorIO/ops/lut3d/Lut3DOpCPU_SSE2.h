@@ -14,6 +14,9 @@ namespace OCIO_NAMESPACE
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+// Same as above for a LUT stored by 4x4x4 bricks.
+void applyTetrahedralBrickedSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -73,84 +74,131 @@ const unsigned long Lut3DOpData::maxSupportedLength = 129;
 // finely sampled domain to try and make the result less lossy.
 Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
                                       ConstLut3DOpDataRcPtr & lutc2)
+{
+    return Compose(ConstLut3DOpDataVec{ lutc1, lutc2 });
+}
+
+Lut3DOpDataRcPtr Lut3DOpData::Compose(const ConstLut3DOpDataVec & lutcs)
 {
     // TODO: Composition of LUTs is a potentially lossy operation.
-    // We try to be safe by making the result at least as big as either lut1 or
-    // lut2 but we may want to even increase the resolution further.  However,
-    // currently composition is done pairs at a time and we would want to
-    // determine the increase size once at the start rather than bumping it up
-    // as each pair is done.
-
-    Lut3DOpDataRcPtr lut1 = std::const_pointer_cast<Lut3DOpData>(lutc1);
-    Lut3DOpDataRcPtr lut2 = std::const_pointer_cast<Lut3DOpData>(lutc2);
-    bool restoreInverse = false;
-    if (lut1->getDirection() == TRANSFORM_DIR_INVERSE && lut2->getDirection() == TRANSFORM_DIR_INVERSE)
+    // We try to be safe by making the result at least as big as any of the
+    // LUTs but we may want to even increase the resolution further.  Note that
+    // the size is determined once for the whole sequence rather than bumping it
+    // up as each pair is done.
+
+    if (lutcs.size() < 2)
+    {
+        throw Exception("There is nothing to compose the 3D LUT with");
+    }
+
+    // We need non-const versions of the LUTs to create the ops and temporarily change the
+    // direction if needed. Ops will not be modified (except by finalize, but that should have
+    // been done already).
+    std::vector<Lut3DOpDataRcPtr> luts;
+    luts.reserve(lutcs.size());
+    for (const auto & lutc : lutcs)
+    {
+        luts.push_back(std::const_pointer_cast<Lut3DOpData>(lutc));
+    }
+
+    const bool allInverse
+        = std::all_of(luts.begin(), luts.end(), [](const Lut3DOpDataRcPtr & lut)
+                      { return lut->getDirection() == TRANSFORM_DIR_INVERSE; });
+
+    if (allInverse)
     {
-        // Using the fact that: iInv(l2 x l1) = inv(l1) x inv(l2).
-        // Compute l2 x l1 and inverse the result.
-        lut1.swap(lut2);
+        // Using the fact that: inv(ln x ... x l1) = inv(l1) x ... x inv(ln).
+        // Compute ln x ... x l1 and inverse the result.
+        std::reverse(luts.begin(), luts.end());
+
+        for (auto & lut : luts)
+        {
+            lut->setDirection(TRANSFORM_DIR_FORWARD);
+        }
+    }
 
-        lut1->setDirection(TRANSFORM_DIR_FORWARD);
-        lut2->setDirection(TRANSFORM_DIR_FORWARD);
-        restoreInverse = true;
+    unsigned long domain_size = 0;
+    for (const auto & lut : luts)
+    {
+        domain_size = std::max(domain_size, lut->getArray().getLength());
     }
 
-    const long min_sz = lut2->getArray().getLength();
-    const long n = lut1->getArray().getLength();
-    const long domain_size = std::max(min_sz, n);
     OpRcPtrVec ops;
+    for (size_t idx = 1; idx < luts.size(); ++idx)
+    {
+        CreateLut3DOp(ops, luts[idx], TRANSFORM_DIR_FORWARD);
+    }
+
+    Lut3DOpDataRcPtr result = Compose(luts.front(), ops, domain_size);
+
+    if (allInverse)
+    {
+        for (auto & lut : luts)
+        {
+            lut->setDirection(TRANSFORM_DIR_INVERSE);
+        }
+        result->setDirection(TRANSFORM_DIR_INVERSE);
+    }
+
+    return result;
+}
+
+Lut3DOpDataRcPtr Lut3DOpData::Compose(const ConstLut3DOpDataRcPtr & lut1,
+                                      const OpRcPtrVec & ops,
+                                      unsigned long gridSize)
+{
+    // The ops are cloned as the evaluation finalizes them.
+    OpRcPtrVec chain;
 
     Lut3DOpDataRcPtr result;
 
-    if (n >= min_sz && !(lut1->getDirection() == TRANSFORM_DIR_INVERSE))
+    if (lut1->getArray().getLength() >= gridSize
+        && !(lut1->getDirection() == TRANSFORM_DIR_INVERSE))
     {
-        // The range of the first LUT becomes the domain to interp in the second.
+        // The range of the first LUT becomes the domain to interp in the others.
         // Use the original domain.
         result = lut1->clone();
     }
     else
     {
-        // Since the 2nd LUT is more finely sampled, use its grid size.
+        // Since one of the other LUTs is more finely sampled, use its grid size.
 
         // Create identity with finer domain.
 
-        result = std::make_shared<Lut3DOpData>(lut1->getInterpolation(), domain_size);
+        result = std::make_shared<Lut3DOpData>(lut1->getInterpolation(), gridSize);
 
         auto metadata = lut1->getFormatMetadata();
         result->getFormatMetadata() = metadata;
 
-        // Interpolate through both LUTs in this case (resample).
-        Lut3DOpDataRcPtr nonConstLut1 = std::const_pointer_cast<Lut3DOpData>(lut1);
-        CreateLut3DOp(ops, nonConstLut1, TRANSFORM_DIR_FORWARD);
+        // Interpolate through all the LUTs in this case (resample).
+        Lut3DOpDataRcPtr lut = lut1->clone();
+        CreateLut3DOp(chain, lut, TRANSFORM_DIR_FORWARD);
     }
 
-    // We need a non-const version of lut2 to create the op.
-    // Op will not be modified (except by finalize, but that should have been done already).
-    Lut3DOpDataRcPtr nonConstLut2 = std::const_pointer_cast<Lut3DOpData>(lut2);
-    CreateLut3DOp(ops, nonConstLut2, TRANSFORM_DIR_FORWARD);
-
-    const BitDepth fileOutBD = lut1->getFileOutputBitDepth();
+    for (const auto & op : ops)
+    {
+        chain.push_back(op->clone());
 
-    // TODO: May want to revisit metadata propagation.
-    result->getFormatMetadata().combine(lut2->getFormatMetadata());
+        // TODO: May want to revisit metadata propagation.
+        ConstOpDataRcPtr data = std::const_pointer_cast<const Op>(op)->data();
+        if (data->getType() == OpData::Lut3DType)
+        {
+            result->getFormatMetadata().combine(data->getFormatMetadata());
+        }
+    }
 
-    result->setFileOutputBitDepth(fileOutBD);
+    result->setFileOutputBitDepth(lut1->getFileOutputBitDepth());
 
     const Array::Values & domain = result->getArray().getValues();
-    const long gridSize = result->getArray().getLength();
-    const long numPixels = gridSize * gridSize * gridSize;
+    const long numPixels = long(result->getArray().getLength())
+                           * long(result->getArray().getLength())
+                           * long(result->getArray().getLength());
 
+    // The grid entries are evaluated in parallel.
     EvalTransform((const float*)(&domain[0]),
                   (float*)(&domain[0]),
                   numPixels,
-                  ops);
-
-    if (restoreInverse)
-    {
-        lut1->setDirection(TRANSFORM_DIR_INVERSE);
-        lut2->setDirection(TRANSFORM_DIR_INVERSE);
-        result->setDirection(TRANSFORM_DIR_INVERSE);
-    }
+                  chain);
 
     return result;
 }
@@ -18,6 +18,7 @@ namespace OCIO_NAMESPACE
 class Lut3DOpData;
 typedef OCIO_SHARED_PTR<Lut3DOpData> Lut3DOpDataRcPtr;
 typedef OCIO_SHARED_PTR<const Lut3DOpData> ConstLut3DOpDataRcPtr;
+typedef std::vector<ConstLut3DOpDataRcPtr> ConstLut3DOpDataVec;
 
 class Lut3DOpData : public OpData
 {
@@ -30,6 +31,18 @@ public:
     // approximates the effect of the pair of ops.
     static Lut3DOpDataRcPtr Compose(ConstLut3DOpDataRcPtr & lut1, ConstLut3DOpDataRcPtr & lut2);
 
+    // Use functional composition to generate a single op that approximates the effect of
+    // a sequence of (at least two) ops. The grid size is determined once for the whole
+    // sequence so the result is only resampled once.
+    static Lut3DOpDataRcPtr Compose(const ConstLut3DOpDataVec & luts);
+
+    // Same as above for a 3D LUT followed by any ops (e.g. a matrix then another 3D LUT). The
+    // whole chain is evaluated on a grid of gridSize entries (the 3D LUT size if it is larger)
+    // taking the domain of the 3D LUT. The ops must only process the RGB channels.
+    static Lut3DOpDataRcPtr Compose(const ConstLut3DOpDataRcPtr & lut,
+                                    const OpRcPtrVec & ops,
+                                    unsigned long gridSize);
+
 public:
     // The gridSize parameter is the length of the cube axis.
     explicit Lut3DOpData(unsigned long gridSize);
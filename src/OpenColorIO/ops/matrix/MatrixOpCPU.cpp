@@ -1,11 +1,16 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <tuple>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
+#include "ops/matrix/MatrixOpCPU_AVX512.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -23,8 +28,16 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
     float m_scale[4];
+
+    ScaleOpCPUApplyFunc * m_applyFunc = nullptr;
+    ScaleOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 
 class ScaleWithOffsetRenderer : public OpCPU
@@ -36,9 +49,17 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
+
+    ScaleOpCPUApplyFunc * m_applyFunc = nullptr;
+    ScaleOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 
 class MatrixWithOffsetRenderer : public OpCPU
@@ -50,6 +71,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
 
     float m_column1[4];
@@ -58,6 +84,9 @@ private:
     float m_column4[4];
 
     float m_offset[4];
+
+    MatrixOpCPUApplyFunc * m_applyFunc = nullptr;
+    MatrixOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 
 class MatrixRenderer : public OpCPU
@@ -69,13 +98,167 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
+
 private:
     float m_column1[4];
     float m_column2[4];
     float m_column3[4];
     float m_column4[4];
+
+    MatrixOpCPUApplyFunc * m_applyFunc = nullptr;
+    MatrixOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
 };
 
+// Select the fastest packed & planar functions supported by the CPU, if any. Note that both
+// always come from the same instruction set so the packed and planar processing match.
+void GetScaleApplyFuncs(bool hasOffsets,
+                        ScaleOpCPUApplyFunc *& applyFunc,
+                        ScaleOpCPUApplyPlanarFunc *& applyPlanarFunc)
+{
+    std::ignore = hasOffsets;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc       = AVX2GetScaleApplyFunc(hasOffsets);
+        applyPlanarFunc = AVX2GetScaleApplyPlanarFunc(hasOffsets);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc       = AVX512GetScaleApplyFunc(hasOffsets);
+        applyPlanarFunc = AVX512GetScaleApplyPlanarFunc(hasOffsets);
+    }
+#endif
+}
+
+void GetMatrixApplyFuncs(bool hasOffsets,
+                         MatrixOpCPUApplyFunc *& applyFunc,
+                         MatrixOpCPUApplyPlanarFunc *& applyPlanarFunc)
+{
+    std::ignore = hasOffsets;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc       = AVX2GetMatrixApplyFunc(hasOffsets);
+        applyPlanarFunc = AVX2GetMatrixApplyPlanarFunc(hasOffsets);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc       = AVX512GetMatrixApplyFunc(hasOffsets);
+        applyPlanarFunc = AVX512GetMatrixApplyPlanarFunc(hasOffsets);
+    }
+#endif
+}
+
+// Apply a 4x4 matrix (plus optional offsets) on R, G, B & A planes. The additions are done in
+// the same order than the packed renderers so both give identical results. Note that the
+// computation is done per output channel to use all the SIMD lanes, and that the results are
+// only stored once the four input values of the pixels are read (i.e. in place processing).
+template<bool hasOffsets>
+void ApplyPlanarMatrix(const float (&column1)[4],
+                       const float (&column2)[4],
+                       const float (&column3)[4],
+                       const float (&column4)[4],
+                       const float (&offset)[4],
+                       const float * const * inPlanes,
+                       float * const * outPlanes,
+                       long numPixels)
+{
+    const float * rIn = inPlanes[0];
+    const float * gIn = inPlanes[1];
+    const float * bIn = inPlanes[2];
+    const float * aIn = inPlanes[3];
+
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m128 r = _mm_loadu_ps(rIn + idx);
+        const __m128 g = _mm_loadu_ps(gIn + idx);
+        const __m128 b = _mm_loadu_ps(bIn + idx);
+        const __m128 a = _mm_loadu_ps(aIn + idx);
+
+        __m128 res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            const __m128 rm0 = _mm_mul_ps(_mm_set1_ps(column1[c]), r);
+            const __m128 gm1 = _mm_mul_ps(_mm_set1_ps(column2[c]), g);
+            const __m128 bm2 = _mm_mul_ps(_mm_set1_ps(column3[c]), b);
+            const __m128 am3 = _mm_mul_ps(_mm_set1_ps(column4[c]), a);
+
+            res[c] = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+            if (hasOffsets)
+            {
+                res[c] = _mm_add_ps(res[c], _mm_set1_ps(offset[c]));
+            }
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            _mm_storeu_ps(outPlanes[c] + idx, res[c]);
+        }
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = rIn[idx];
+        const float g = gIn[idx];
+        const float b = bIn[idx];
+        const float a = aIn[idx];
+
+        float res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            res[c] = (r*column1[c] + g*column2[c]) + (b*column3[c] + a*column4[c]);
+            if (hasOffsets)
+            {
+                res[c] += offset[c];
+            }
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            outPlanes[c][idx] = res[c];
+        }
+    }
+#else
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = rIn[idx];
+        const float g = gIn[idx];
+        const float b = bIn[idx];
+        const float a = aIn[idx];
+
+        float res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            res[c] = r*column1[c] + g*column2[c] + b*column3[c] + a*column4[c];
+            if (hasOffsets)
+            {
+                res[c] += offset[c];
+            }
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            outPlanes[c][idx] = res[c];
+        }
+    }
+#endif
+}
+
 ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -85,10 +268,18 @@ ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     m_scale[1] = (float)m[5];
     m_scale[2] = (float)m[10];
     m_scale[3] = (float)m[15];
+
+    GetScaleApplyFuncs(false, m_applyFunc, m_applyPlanarFunc);
 }
 
 void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, nullptr, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -104,6 +295,29 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyPlanar(const float * const * inPlanes,
+                                float * const * outPlanes,
+                                long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, nullptr, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale = m_scale[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale;
+        }
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -120,10 +334,18 @@ ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     m_offset[1] = (float)o[1];
     m_offset[2] = (float)o[2];
     m_offset[3] = (float)o[3];
+
+    GetScaleApplyFuncs(true, m_applyFunc, m_applyPlanarFunc);
 }
 
 void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -139,6 +361,30 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyPlanar(const float * const * inPlanes,
+                                          float * const * outPlanes,
+                                          long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, m_offset, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale  = m_scale[c];
+        const float offset = m_offset[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale + offset;
+        }
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -178,6 +424,7 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     m_offset[2] = (float)o[2];
     m_offset[3] = (float)o[3];
 
+    GetMatrixApplyFuncs(true, m_applyFunc, m_applyPlanarFunc);
 }
 
 // Apply the rendering
@@ -208,6 +455,13 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
 //      image = res1 + res2
 void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        const float * columns[4] = { m_column1, m_column2, m_column3, m_column4 };
+        m_applyFunc(columns, m_offset, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -287,6 +541,21 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+void MatrixWithOffsetRenderer::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        const float * columns[4] = { m_column1, m_column2, m_column3, m_column4 };
+        m_applyPlanarFunc(columns, m_offset, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    ApplyPlanarMatrix<true>(m_column1, m_column2, m_column3, m_column4, m_offset,
+                            inPlanes, outPlanes, numPixels);
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -318,10 +587,19 @@ MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     m_column4[1] = (float)m[dim + 3];
     m_column4[2] = (float)m[twoDim + 3];
     m_column4[3] = (float)m[threeDim + 3];
+
+    GetMatrixApplyFuncs(false, m_applyFunc, m_applyPlanarFunc);
 }
 
 void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        const float * columns[4] = { m_column1, m_column2, m_column3, m_column4 };
+        m_applyFunc(columns, nullptr, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -395,6 +673,23 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyPlanar(const float * const * inPlanes,
+                                 float * const * outPlanes,
+                                 long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        const float * columns[4] = { m_column1, m_column2, m_column3, m_column4 };
+        m_applyPlanarFunc(columns, nullptr, inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    static constexpr float noOffsets[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    ApplyPlanarMatrix<false>(m_column1, m_column2, m_column3, m_column4, noOffsets,
+                             inPlanes, outPlanes, numPixels);
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <cmath>
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that all the functions below (i.e. packed & planar, vector & scalar) perform the
+// computations in the same order using fused multiply-adds, so the packed and the planar
+// processing give identical results.
+
+inline __m256 ApplyMatrix(__m256 pix, const __m256 & m0, const __m256 & m1,
+                          const __m256 & m2, const __m256 & m3, const __m256 & o,
+                          bool hasOffsets)
+{
+    // Each 128-bit lane holds one pixel so the channel values are broadcasted within the lanes.
+    const __m256 r = _mm256_permute_ps(pix, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m256 g = _mm256_permute_ps(pix, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m256 b = _mm256_permute_ps(pix, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m256 a = _mm256_permute_ps(pix, _MM_SHUFFLE(3, 3, 3, 3));
+
+    __m256 res = hasOffsets ? _mm256_fmadd_ps(r, m0, o) : _mm256_mul_ps(r, m0);
+    res = _mm256_fmadd_ps(g, m1, res);
+    res = _mm256_fmadd_ps(b, m2, res);
+    return _mm256_fmadd_ps(a, m3, res);
+}
+
+template<bool hasOffsets>
+void ApplyMatrixPacked(const float * const * columns, const float * offset,
+                       const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)columns[0]);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)columns[1]);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)columns[2]);
+    const __m256 m3 = _mm256_broadcast_ps((const __m128 *)columns[3]);
+    const __m256 o  = hasOffsets ? _mm256_broadcast_ps((const __m128 *)offset)
+                                 : _mm256_setzero_ps();
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m256 p01 = _mm256_loadu_ps(in +  0);
+        const __m256 p23 = _mm256_loadu_ps(in +  8);
+        const __m256 p45 = _mm256_loadu_ps(in + 16);
+        const __m256 p67 = _mm256_loadu_ps(in + 24);
+
+        _mm256_storeu_ps(out +  0, ApplyMatrix(p01, m0, m1, m2, m3, o, hasOffsets));
+        _mm256_storeu_ps(out +  8, ApplyMatrix(p23, m0, m1, m2, m3, o, hasOffsets));
+        _mm256_storeu_ps(out + 16, ApplyMatrix(p45, m0, m1, m2, m3, o, hasOffsets));
+        _mm256_storeu_ps(out + 24, ApplyMatrix(p67, m0, m1, m2, m3, o, hasOffsets));
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx + 2 <= numPixels; idx += 2)
+    {
+        const __m256 p01 = _mm256_loadu_ps(in);
+        _mm256_storeu_ps(out, ApplyMatrix(p01, m0, m1, m2, m3, o, hasOffsets));
+
+        in  += 8;
+        out += 8;
+    }
+
+    if (idx < numPixels)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+
+        const __m128 r = _mm_permute_ps(pix, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 g = _mm_permute_ps(pix, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 b = _mm_permute_ps(pix, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 a = _mm_permute_ps(pix, _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m128 res = hasOffsets ? _mm_fmadd_ps(r, _mm256_castps256_ps128(m0),
+                                                  _mm256_castps256_ps128(o))
+                                : _mm_mul_ps(r, _mm256_castps256_ps128(m0));
+        res = _mm_fmadd_ps(g, _mm256_castps256_ps128(m1), res);
+        res = _mm_fmadd_ps(b, _mm256_castps256_ps128(m2), res);
+        res = _mm_fmadd_ps(a, _mm256_castps256_ps128(m3), res);
+
+        _mm_storeu_ps(out, res);
+    }
+}
+
+template<bool hasOffsets>
+void ApplyMatrixPlanar(const float * const * columns, const float * offset,
+                       const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    const float * rIn = inPlanes[0];
+    const float * gIn = inPlanes[1];
+    const float * bIn = inPlanes[2];
+    const float * aIn = inPlanes[3];
+
+    long idx = 0;
+
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m256 r = _mm256_loadu_ps(rIn + idx);
+        const __m256 g = _mm256_loadu_ps(gIn + idx);
+        const __m256 b = _mm256_loadu_ps(bIn + idx);
+        const __m256 a = _mm256_loadu_ps(aIn + idx);
+
+        __m256 res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            res[c] = hasOffsets
+                ? _mm256_fmadd_ps(r, _mm256_set1_ps(columns[0][c]), _mm256_set1_ps(offset[c]))
+                : _mm256_mul_ps(r, _mm256_set1_ps(columns[0][c]));
+            res[c] = _mm256_fmadd_ps(g, _mm256_set1_ps(columns[1][c]), res[c]);
+            res[c] = _mm256_fmadd_ps(b, _mm256_set1_ps(columns[2][c]), res[c]);
+            res[c] = _mm256_fmadd_ps(a, _mm256_set1_ps(columns[3][c]), res[c]);
+        }
+
+        // Only store once all the input values are read for the in place processing.
+        for (int c = 0; c < 4; ++c)
+        {
+            _mm256_storeu_ps(outPlanes[c] + idx, res[c]);
+        }
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = rIn[idx];
+        const float g = gIn[idx];
+        const float b = bIn[idx];
+        const float a = aIn[idx];
+
+        float res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            res[c] = hasOffsets ? std::fma(r, columns[0][c], offset[c]) : r * columns[0][c];
+            res[c] = std::fma(g, columns[1][c], res[c]);
+            res[c] = std::fma(b, columns[2][c], res[c]);
+            res[c] = std::fma(a, columns[3][c], res[c]);
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            outPlanes[c][idx] = res[c];
+        }
+    }
+}
+
+template<bool hasOffsets>
+void ApplyScalePacked(const float * scale, const float * offset,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m256 s = _mm256_broadcast_ps((const __m128 *)scale);
+    const __m256 o = hasOffsets ? _mm256_broadcast_ps((const __m128 *)offset)
+                                : _mm256_setzero_ps();
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        for (int v = 0; v < 4; ++v)
+        {
+            const __m256 pix = _mm256_loadu_ps(in + 8 * v);
+            _mm256_storeu_ps(out + 8 * v, hasOffsets ? _mm256_fmadd_ps(pix, s, o)
+                                                     : _mm256_mul_ps(pix, s));
+        }
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx < numPixels; ++idx)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+        _mm_storeu_ps(out, hasOffsets ? _mm_fmadd_ps(pix, _mm256_castps256_ps128(s),
+                                                          _mm256_castps256_ps128(o))
+                                      : _mm_mul_ps(pix, _mm256_castps256_ps128(s)));
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+template<bool hasOffsets>
+void ApplyScalePlanar(const float * scale, const float * offset,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        const __m256 s = _mm256_set1_ps(scale[c]);
+        const __m256 o = hasOffsets ? _mm256_set1_ps(offset[c]) : _mm256_setzero_ps();
+
+        long idx = 0;
+        for (; idx + 8 <= numPixels; idx += 8)
+        {
+            const __m256 pix = _mm256_loadu_ps(in + idx);
+            _mm256_storeu_ps(out + idx, hasOffsets ? _mm256_fmadd_ps(pix, s, o)
+                                                   : _mm256_mul_ps(pix, s));
+        }
+
+        for (; idx < numPixels; ++idx)
+        {
+            out[idx] = hasOffsets ? std::fma(in[idx], scale[c], offset[c]) : in[idx] * scale[c];
+        }
+    }
+}
+
+} // anonymous namespace
+
+MatrixOpCPUApplyFunc * AVX2GetMatrixApplyFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyMatrixPacked<true> : ApplyMatrixPacked<false>;
+}
+
+MatrixOpCPUApplyPlanarFunc * AVX2GetMatrixApplyPlanarFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyMatrixPlanar<true> : ApplyMatrixPlanar<false>;
+}
+
+ScaleOpCPUApplyFunc * AVX2GetScaleApplyFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyScalePacked<true> : ApplyScalePacked<false>;
+}
+
+ScaleOpCPUApplyPlanarFunc * AVX2GetScaleApplyPlanarFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyScalePlanar<true> : ApplyScalePlanar<false>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that all the functions below (i.e. packed & planar) perform the computations in the same
+// order using fused multiply-adds, so the packed and the planar processing give identical
+// results. The leftover pixels use masked loads & stores.
+
+inline __m512 ApplyMatrix(__m512 pix, const __m512 & m0, const __m512 & m1,
+                          const __m512 & m2, const __m512 & m3, const __m512 & o,
+                          bool hasOffsets)
+{
+    // Each 128-bit lane holds one pixel so the channel values are broadcasted within the lanes.
+    const __m512 r = _mm512_permute_ps(pix, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m512 g = _mm512_permute_ps(pix, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m512 b = _mm512_permute_ps(pix, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m512 a = _mm512_permute_ps(pix, _MM_SHUFFLE(3, 3, 3, 3));
+
+    __m512 res = hasOffsets ? _mm512_fmadd_ps(r, m0, o) : _mm512_mul_ps(r, m0);
+    res = _mm512_fmadd_ps(g, m1, res);
+    res = _mm512_fmadd_ps(b, m2, res);
+    return _mm512_fmadd_ps(a, m3, res);
+}
+
+// Mask of the first numValues values of a register.
+inline __mmask16 GetMask(long numValues)
+{
+    return _mm512_int2mask((1 << numValues) - 1);
+}
+
+template<bool hasOffsets>
+void ApplyMatrixPacked(const float * const * columns, const float * offset,
+                       const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m512 m0 = _mm512_broadcast_f32x4(_mm_loadu_ps(columns[0]));
+    const __m512 m1 = _mm512_broadcast_f32x4(_mm_loadu_ps(columns[1]));
+    const __m512 m2 = _mm512_broadcast_f32x4(_mm_loadu_ps(columns[2]));
+    const __m512 m3 = _mm512_broadcast_f32x4(_mm_loadu_ps(columns[3]));
+    const __m512 o  = hasOffsets ? _mm512_broadcast_f32x4(_mm_loadu_ps(offset))
+                                 : _mm512_setzero_ps();
+
+    long idx = 0;
+
+    // Process 16 pixels per iteration.
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        const __m512 p0 = _mm512_loadu_ps(in +  0);
+        const __m512 p1 = _mm512_loadu_ps(in + 16);
+        const __m512 p2 = _mm512_loadu_ps(in + 32);
+        const __m512 p3 = _mm512_loadu_ps(in + 48);
+
+        _mm512_storeu_ps(out +  0, ApplyMatrix(p0, m0, m1, m2, m3, o, hasOffsets));
+        _mm512_storeu_ps(out + 16, ApplyMatrix(p1, m0, m1, m2, m3, o, hasOffsets));
+        _mm512_storeu_ps(out + 32, ApplyMatrix(p2, m0, m1, m2, m3, o, hasOffsets));
+        _mm512_storeu_ps(out + 48, ApplyMatrix(p3, m0, m1, m2, m3, o, hasOffsets));
+
+        in  += 64;
+        out += 64;
+    }
+
+    // Handle the leftover pixels, up to four pixels at a time.
+    for (; idx < numPixels; idx += 4)
+    {
+        const __mmask16 k = GetMask(4 * std::min(numPixels - idx, 4L));
+
+        const __m512 pix = _mm512_maskz_loadu_ps(k, in);
+        _mm512_mask_storeu_ps(out, k, ApplyMatrix(pix, m0, m1, m2, m3, o, hasOffsets));
+
+        in  += 16;
+        out += 16;
+    }
+}
+
+template<bool hasOffsets>
+void ApplyMatrixPlanar(const float * const * columns, const float * offset,
+                       const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; idx += 16)
+    {
+        const __mmask16 k = GetMask(std::min(numPixels - idx, 16L));
+
+        const __m512 r = _mm512_maskz_loadu_ps(k, inPlanes[0] + idx);
+        const __m512 g = _mm512_maskz_loadu_ps(k, inPlanes[1] + idx);
+        const __m512 b = _mm512_maskz_loadu_ps(k, inPlanes[2] + idx);
+        const __m512 a = _mm512_maskz_loadu_ps(k, inPlanes[3] + idx);
+
+        __m512 res[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            res[c] = hasOffsets
+                ? _mm512_fmadd_ps(r, _mm512_set1_ps(columns[0][c]), _mm512_set1_ps(offset[c]))
+                : _mm512_mul_ps(r, _mm512_set1_ps(columns[0][c]));
+            res[c] = _mm512_fmadd_ps(g, _mm512_set1_ps(columns[1][c]), res[c]);
+            res[c] = _mm512_fmadd_ps(b, _mm512_set1_ps(columns[2][c]), res[c]);
+            res[c] = _mm512_fmadd_ps(a, _mm512_set1_ps(columns[3][c]), res[c]);
+        }
+
+        // Only store once all the input values are read for the in place processing.
+        for (int c = 0; c < 4; ++c)
+        {
+            _mm512_mask_storeu_ps(outPlanes[c] + idx, k, res[c]);
+        }
+    }
+}
+
+template<bool hasOffsets>
+void ApplyScalePacked(const float * scale, const float * offset,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m512 s = _mm512_broadcast_f32x4(_mm_loadu_ps(scale));
+    const __m512 o = hasOffsets ? _mm512_broadcast_f32x4(_mm_loadu_ps(offset))
+                                : _mm512_setzero_ps();
+
+    // Process 16 pixels per iteration, and the leftover pixels using masks.
+    for (long idx = 0; idx < numPixels; idx += 16)
+    {
+        for (long v = 0; v < 4 && idx + 4 * v < numPixels; ++v)
+        {
+            const __mmask16 k = GetMask(4 * std::min(numPixels - idx - 4 * v, 4L));
+
+            const __m512 pix = _mm512_maskz_loadu_ps(k, in + 16 * v);
+            _mm512_mask_storeu_ps(out + 16 * v, k, hasOffsets ? _mm512_fmadd_ps(pix, s, o)
+                                                              : _mm512_mul_ps(pix, s));
+        }
+
+        in  += 64;
+        out += 64;
+    }
+}
+
+template<bool hasOffsets>
+void ApplyScalePlanar(const float * scale, const float * offset,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        const __m512 s = _mm512_set1_ps(scale[c]);
+        const __m512 o = hasOffsets ? _mm512_set1_ps(offset[c]) : _mm512_setzero_ps();
+
+        for (long idx = 0; idx < numPixels; idx += 16)
+        {
+            const __mmask16 k = GetMask(std::min(numPixels - idx, 16L));
+
+            const __m512 pix = _mm512_maskz_loadu_ps(k, in + idx);
+            _mm512_mask_storeu_ps(out + idx, k, hasOffsets ? _mm512_fmadd_ps(pix, s, o)
+                                                           : _mm512_mul_ps(pix, s));
+        }
+    }
+}
+
+} // anonymous namespace
+
+MatrixOpCPUApplyFunc * AVX512GetMatrixApplyFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyMatrixPacked<true> : ApplyMatrixPacked<false>;
+}
+
+MatrixOpCPUApplyPlanarFunc * AVX512GetMatrixApplyPlanarFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyMatrixPlanar<true> : ApplyMatrixPlanar<false>;
+}
+
+ScaleOpCPUApplyFunc * AVX512GetScaleApplyFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyScalePacked<true> : ApplyScalePacked<false>;
+}
+
+ScaleOpCPUApplyPlanarFunc * AVX512GetScaleApplyPlanarFunc(bool hasOffsets)
+{
+    return hasOffsets ? ApplyScalePlanar<true> : ApplyScalePlanar<false>;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_MATRIXOP_CPU_AVX512_H
+#define INCLUDED_OCIO_MATRIXOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// The columns hold the four red, green, blue & alpha multipliers, and the offsets are ignored
+// by the functions not applying offsets.
+typedef void (MatrixOpCPUApplyFunc)(const float * const *, const float *, const void *, void *, long);
+typedef void (MatrixOpCPUApplyPlanarFunc)(const float * const *, const float *,
+                                          const float * const *, float * const *, long);
+
+// The scales hold the four diagonal values of the matrix.
+typedef void (ScaleOpCPUApplyFunc)(const float *, const float *, const void *, void *, long);
+typedef void (ScaleOpCPUApplyPlanarFunc)(const float *, const float *,
+                                         const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+MatrixOpCPUApplyFunc * AVX512GetMatrixApplyFunc(bool hasOffsets);
+MatrixOpCPUApplyPlanarFunc * AVX512GetMatrixApplyPlanarFunc(bool hasOffsets);
+
+ScaleOpCPUApplyFunc * AVX512GetScaleApplyFunc(bool hasOffsets);
+ScaleOpCPUApplyPlanarFunc * AVX512GetScaleApplyPlanarFunc(bool hasOffsets);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_MATRIXOP_CPU_AVX512_H */
@@ -106,6 +106,19 @@ void CreateGpuAllocationNoOp(OpRcPtrVec & ops, const AllocationData & allocation
     ops.push_back( std::make_shared<AllocationNoOp>(allocationData) );
 }
 
+bool GetGpuAllocation(AllocationData & allocation, const ConstOpRcPtr & op)
+{
+    ConstAllocationNoOpRcPtr allocationNoOpRcPtr = DynamicPtrCast<const AllocationNoOp>(op);
+
+    if(!allocationNoOpRcPtr)
+    {
+        return false;
+    }
+
+    allocationNoOpRcPtr->getGpuAllocation(allocation);
+    return true;
+}
+
 
 namespace
 {
@@ -154,22 +167,6 @@ void GetGpuUnsupportedIndexRange(int * startIndex, int * endIndex,
     if(startIndex) *startIndex = start;
     if(endIndex) *endIndex = end;
 }
-
-
-bool GetGpuAllocation(AllocationData & allocation,
-                        const OpRcPtr & op)
-{
-    AllocationNoOpRcPtr allocationNoOpRcPtr =
-        DynamicPtrCast<AllocationNoOp>(op);
-
-    if(!allocationNoOpRcPtr)
-    {
-        return false;
-    }
-
-    allocationNoOpRcPtr->getGpuAllocation(allocation);
-    return true;
-}
 }
 
 OpRcPtrVec Create3DLut(const OpRcPtrVec & ops, unsigned edgelen)
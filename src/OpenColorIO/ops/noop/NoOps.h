@@ -8,6 +8,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "ops/allocation/AllocationOp.h"
 
 #include <vector>
 
@@ -30,6 +31,10 @@ void PartitionGPUOps(OpRcPtrVec & gpuPreOps,
                      OpRcPtrVec & gpuPostOps,
                      const OpRcPtrVec & ops);
 
+// Get the GPU allocation defined by the op (i.e. used by PartitionGPUOps), return false if the op
+// does not define any.
+bool GetGpuAllocation(AllocationData & allocation, const ConstOpRcPtr & op);
+
 void CreateFileNoOp(OpRcPtrVec & ops,
                     const std::string & fname);
 
@@ -3,12 +3,16 @@
 
 
 #include <algorithm>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
 #include "ops/range/RangeOpCPU.h"
+#include "ops/range/RangeOpCPU_AVX2.h"
+#include "ops/range/RangeOpCPU_AVX512.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -20,11 +24,18 @@ public:
     RangeOpCPU(ConstRangeOpDataRcPtr & range);
 
 protected:
+    // Select the fastest packed & planar functions supported by the CPU, if any. Note that both
+    // always come from the same instruction set so the packed and planar processing match.
+    void initApplyFuncs(bool scales, bool clampLower, bool clampUpper);
+
     float m_scale;
     float m_offset;
     float m_lowerBound;
     float m_upperBound;
 
+    RangeOpCPUApplyFunc * m_applyFunc = nullptr;
+    RangeOpCPUApplyPlanarFunc * m_applyPlanarFunc = nullptr;
+
 private:
     RangeOpCPU() = delete;
 };
@@ -35,6 +46,11 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +59,11 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +72,11 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +85,11 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const * inPlanes,
+                     float * const * outPlanes,
+                     long numPixels) const override;
 };
 
 
@@ -75,13 +106,43 @@ RangeOpCPU::RangeOpCPU(ConstRangeOpDataRcPtr & range)
     m_upperBound = (float)range->getMaxOutValue();
 }
 
+void RangeOpCPU::initApplyFuncs(bool scales, bool clampLower, bool clampUpper)
+{
+    std::ignore = scales;
+    std::ignore = clampLower;
+    std::ignore = clampUpper;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applyFunc       = AVX2GetRangeApplyFunc(scales, clampLower, clampUpper);
+        m_applyPlanarFunc = AVX2GetRangeApplyPlanarFunc(scales, clampLower, clampUpper);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applyFunc       = AVX512GetRangeApplyFunc(scales, clampLower, clampUpper);
+        m_applyPlanarFunc = AVX512GetRangeApplyPlanarFunc(scales, clampLower, clampUpper);
+    }
+#endif
+}
+
 RangeScaleMinMaxRenderer::RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
+    initApplyFuncs(true, true, true);
 }
 
 void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, m_lowerBound, m_upperBound, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -102,13 +163,47 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void RangeScaleMinMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                           float * const * outPlanes,
+                                           long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, m_offset, m_lowerBound, m_upperBound,
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = Clamp(in[idx] * m_scale + m_offset, m_lowerBound, m_upperBound);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
+    initApplyFuncs(false, true, true);
 }
 
 void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, m_lowerBound, m_upperBound, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -125,13 +220,47 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void RangeMinMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                      float * const * outPlanes,
+                                      long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, m_offset, m_lowerBound, m_upperBound,
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = Clamp(in[idx], m_lowerBound, m_upperBound);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
+    initApplyFuncs(false, true, false);
 }
 
 void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, m_lowerBound, m_upperBound, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -148,13 +277,47 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMinRenderer::applyPlanar(const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, m_offset, m_lowerBound, m_upperBound,
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = std::max(m_lowerBound, in[idx]);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
+    initApplyFuncs(false, false, true);
 }
 
 void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, m_lowerBound, m_upperBound, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -171,6 +334,33 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMaxRenderer::applyPlanar(const float * const * inPlanes,
+                                   float * const * outPlanes,
+                                   long numPixels) const
+{
+    if (m_applyPlanarFunc)
+    {
+        m_applyPlanarFunc(m_scale, m_offset, m_lowerBound, m_upperBound,
+                          inPlanes, outPlanes, numPixels);
+        CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_upperBound.
+            out[idx] = std::min(m_upperBound, in[idx]);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "RangeOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the max & min instructions return their second argument when the first one is a NaN,
+// so NaNs become the lower bound (or the upper bound when there is no lower bound) as for the
+// scalar renderers.
+template<bool scales, bool clampLower, bool clampUpper>
+inline __m256 ApplyRange(__m256 v, const __m256 & scale, const __m256 & offset,
+                         const __m256 & lower, const __m256 & upper)
+{
+    if (scales)
+    {
+        v = _mm256_fmadd_ps(v, scale, offset);
+    }
+    if (clampLower)
+    {
+        v = _mm256_max_ps(v, lower);
+    }
+    if (clampUpper)
+    {
+        v = _mm256_min_ps(v, upper);
+    }
+    return v;
+}
+
+template<bool scales, bool clampLower, bool clampUpper>
+void ApplyRangePacked(float scale, float offset, float lowerBound, float upperBound,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m256 s  = _mm256_set1_ps(scale);
+    const __m256 o  = _mm256_set1_ps(offset);
+    const __m256 lo = _mm256_set1_ps(lowerBound);
+    const __m256 hi = _mm256_set1_ps(upperBound);
+
+    // Each register holds two pixels and the alpha values are restored after the processing.
+    constexpr int alphaMask = 0x88;
+
+    long idx = 0;
+
+    // Process 8 pixels per iteration.
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        for (int v = 0; v < 4; ++v)
+        {
+            const __m256 pix = _mm256_loadu_ps(in + 8 * v);
+            const __m256 res = ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi);
+            _mm256_storeu_ps(out + 8 * v, _mm256_blend_ps(res, pix, alphaMask));
+        }
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (; idx + 2 <= numPixels; idx += 2)
+    {
+        const __m256 pix = _mm256_loadu_ps(in);
+        const __m256 res = ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi);
+        _mm256_storeu_ps(out, _mm256_blend_ps(res, pix, alphaMask));
+
+        in  += 8;
+        out += 8;
+    }
+
+    if (idx < numPixels)
+    {
+        const __m128 pix = _mm_loadu_ps(in);
+        const __m256 res = ApplyRange<scales, clampLower, clampUpper>(_mm256_castps128_ps256(pix),
+                                                                      s, o, lo, hi);
+        _mm_storeu_ps(out, _mm_blend_ps(_mm256_castps256_ps128(res), pix, alphaMask & 0xF));
+    }
+}
+
+template<bool scales, bool clampLower, bool clampUpper>
+void ApplyRangePlanar(float scale, float offset, float lowerBound, float upperBound,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    const __m256 s  = _mm256_set1_ps(scale);
+    const __m256 o  = _mm256_set1_ps(offset);
+    const __m256 lo = _mm256_set1_ps(lowerBound);
+    const __m256 hi = _mm256_set1_ps(upperBound);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        long idx = 0;
+        for (; idx + 8 <= numPixels; idx += 8)
+        {
+            const __m256 pix = _mm256_loadu_ps(in + idx);
+            _mm256_storeu_ps(out + idx,
+                             ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi));
+        }
+
+        // Handle the leftover values one at a time, using the same instructions.
+        for (; idx < numPixels; ++idx)
+        {
+            const __m256 pix = _mm256_castps128_ps256(_mm_load_ss(in + idx));
+            const __m256 res = ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi);
+            _mm_store_ss(out + idx, _mm256_castps256_ps128(res));
+        }
+    }
+}
+
+} // anonymous namespace
+
+RangeOpCPUApplyFunc * AVX2GetRangeApplyFunc(bool scales, bool clampLower, bool clampUpper)
+{
+    if (scales)
+    {
+        return (clampLower && clampUpper) ? ApplyRangePacked<true, true, true> : nullptr;
+    }
+    if (clampLower)
+    {
+        return clampUpper ? ApplyRangePacked<false, true, true>
+                          : ApplyRangePacked<false, true, false>;
+    }
+    return clampUpper ? ApplyRangePacked<false, false, true> : nullptr;
+}
+
+RangeOpCPUApplyPlanarFunc * AVX2GetRangeApplyPlanarFunc(bool scales,
+                                                        bool clampLower,
+                                                        bool clampUpper)
+{
+    if (scales)
+    {
+        return (clampLower && clampUpper) ? ApplyRangePlanar<true, true, true> : nullptr;
+    }
+    if (clampLower)
+    {
+        return clampUpper ? ApplyRangePlanar<false, true, true>
+                          : ApplyRangePlanar<false, true, false>;
+    }
+    return clampUpper ? ApplyRangePlanar<false, false, true> : nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
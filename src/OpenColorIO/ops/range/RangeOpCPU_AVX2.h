@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_RANGEOP_CPU_AVX2_H
+#define INCLUDED_OCIO_RANGEOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// The arguments are the scale, offset, lower bound & upper bound of the range. Note that the
+// planar functions only process the R, G & B planes as the alpha channel is never modified.
+typedef void (RangeOpCPUApplyFunc)(float, float, float, float, const void *, void *, long);
+typedef void (RangeOpCPUApplyPlanarFunc)(float, float, float, float,
+                                         const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+RangeOpCPUApplyFunc * AVX2GetRangeApplyFunc(bool scales, bool clampLower, bool clampUpper);
+RangeOpCPUApplyPlanarFunc * AVX2GetRangeApplyPlanarFunc(bool scales,
+                                                        bool clampLower,
+                                                        bool clampUpper);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_RANGEOP_CPU_AVX2_H */
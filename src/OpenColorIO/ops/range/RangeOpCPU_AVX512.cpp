@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "RangeOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the max & min instructions return their second argument when the first one is a NaN,
+// so NaNs become the lower bound (or the upper bound when there is no lower bound) as for the
+// scalar renderers.
+template<bool scales, bool clampLower, bool clampUpper>
+inline __m512 ApplyRange(__m512 v, const __m512 & scale, const __m512 & offset,
+                         const __m512 & lower, const __m512 & upper)
+{
+    if (scales)
+    {
+        v = _mm512_fmadd_ps(v, scale, offset);
+    }
+    if (clampLower)
+    {
+        v = _mm512_max_ps(v, lower);
+    }
+    if (clampUpper)
+    {
+        v = _mm512_min_ps(v, upper);
+    }
+    return v;
+}
+
+// Mask of the first numValues values of a register.
+inline __mmask16 GetMask(long numValues)
+{
+    return _mm512_int2mask((1 << numValues) - 1);
+}
+
+template<bool scales, bool clampLower, bool clampUpper>
+void ApplyRangePacked(float scale, float offset, float lowerBound, float upperBound,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m512 s  = _mm512_set1_ps(scale);
+    const __m512 o  = _mm512_set1_ps(offset);
+    const __m512 lo = _mm512_set1_ps(lowerBound);
+    const __m512 hi = _mm512_set1_ps(upperBound);
+
+    // Each register holds four pixels and the alpha values are restored after the processing.
+    const __mmask16 alphaMask = _mm512_int2mask(0x8888);
+
+    // Process 16 pixels per iteration, and the leftover pixels using masks.
+    for (long idx = 0; idx < numPixels; idx += 16)
+    {
+        for (long v = 0; v < 4 && idx + 4 * v < numPixels; ++v)
+        {
+            const __mmask16 k = GetMask(4 * std::min(numPixels - idx - 4 * v, 4L));
+
+            const __m512 pix = _mm512_maskz_loadu_ps(k, in + 16 * v);
+            const __m512 res = ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi);
+            _mm512_mask_storeu_ps(out + 16 * v, k, _mm512_mask_blend_ps(alphaMask, res, pix));
+        }
+
+        in  += 64;
+        out += 64;
+    }
+}
+
+template<bool scales, bool clampLower, bool clampUpper>
+void ApplyRangePlanar(float scale, float offset, float lowerBound, float upperBound,
+                      const float * const * inPlanes, float * const * outPlanes, long numPixels)
+{
+    const __m512 s  = _mm512_set1_ps(scale);
+    const __m512 o  = _mm512_set1_ps(offset);
+    const __m512 lo = _mm512_set1_ps(lowerBound);
+    const __m512 hi = _mm512_set1_ps(upperBound);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; idx += 16)
+        {
+            const __mmask16 k = GetMask(std::min(numPixels - idx, 16L));
+
+            const __m512 pix = _mm512_maskz_loadu_ps(k, in + idx);
+            _mm512_mask_storeu_ps(out + idx, k,
+                                  ApplyRange<scales, clampLower, clampUpper>(pix, s, o, lo, hi));
+        }
+    }
+}
+
+} // anonymous namespace
+
+RangeOpCPUApplyFunc * AVX512GetRangeApplyFunc(bool scales, bool clampLower, bool clampUpper)
+{
+    if (scales)
+    {
+        return (clampLower && clampUpper) ? ApplyRangePacked<true, true, true> : nullptr;
+    }
+    if (clampLower)
+    {
+        return clampUpper ? ApplyRangePacked<false, true, true>
+                          : ApplyRangePacked<false, true, false>;
+    }
+    return clampUpper ? ApplyRangePacked<false, false, true> : nullptr;
+}
+
+RangeOpCPUApplyPlanarFunc * AVX512GetRangeApplyPlanarFunc(bool scales,
+                                                          bool clampLower,
+                                                          bool clampUpper)
+{
+    if (scales)
+    {
+        return (clampLower && clampUpper) ? ApplyRangePlanar<true, true, true> : nullptr;
+    }
+    if (clampLower)
+    {
+        return clampUpper ? ApplyRangePlanar<false, true, true>
+                          : ApplyRangePlanar<false, true, false>;
+    }
+    return clampUpper ? ApplyRangePlanar<false, false, true> : nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_RANGEOP_CPU_AVX512_H
+#define INCLUDED_OCIO_RANGEOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// The arguments are the scale, offset, lower bound & upper bound of the range. Note that the
+// planar functions only process the R, G & B planes as the alpha channel is never modified.
+typedef void (RangeOpCPUApplyFunc)(float, float, float, float, const void *, void *, long);
+typedef void (RangeOpCPUApplyPlanarFunc)(float, float, float, float,
+                                         const float * const *, float * const *, long);
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+RangeOpCPUApplyFunc * AVX512GetRangeApplyFunc(bool scales, bool clampLower, bool clampUpper);
+RangeOpCPUApplyPlanarFunc * AVX512GetRangeApplyPlanarFunc(bool scales,
+                                                          bool clampLower,
+                                                          bool clampUpper);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_RANGEOP_CPU_AVX512_H */
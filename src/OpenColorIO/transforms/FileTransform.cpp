@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string.h>
 #include <iostream>
@@ -14,13 +15,16 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "ConfigUtils.h"
 #include "FileTransform.h"
 #include "Logging.h"
 #include "Mutex.h"
 #include "OCIOZArchive.h"
+#include "OpBuilders.h"
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
 #include "Platform.h"
+#include "ThreadPool.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -594,13 +598,32 @@ void FileFormat::write(const ConstConfigRcPtr & /*config*/,
 namespace
 {
 
+// Get the size of the remaining stream content. It's used as an approximation of the memory
+// used by the LUT read from the stream.
+size_t GetStreamSize(std::istream & stream)
+{
+    const std::streampos start = stream.tellg();
+    if (start < 0)
+    {
+        return 0;
+    }
+
+    stream.seekg(0, std::ios_base::end);
+    const std::streampos end = stream.tellg();
+    stream.seekg(start);
+
+    return end > start ? static_cast<size_t>(end - start) : 0;
+}
+
 void LoadFileUncached(FileFormat * & returnFormat,
                       CachedFileRcPtr & returnCachedFile,
+                      size_t & returnMemorySize,
                       const std::string & filepath,
                       Interpolation interp,
                       const Config& config)
 {
     returnFormat = NULL;
+    returnMemorySize = 0;
 
     {
         std::ostringstream oss;
@@ -647,6 +670,8 @@ void LoadFileUncached(FileFormat * & returnFormat,
                 throw Exception(os.str().c_str());
             }
 
+            const size_t memorySize = GetStreamSize(filestream);
+
             CachedFileRcPtr cachedFile = tryFormat->read(filestream, filepath, interp);
 
             if(IsDebugLoggingEnabled())
@@ -659,6 +684,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = tryFormat;
             returnCachedFile = cachedFile;
+            returnMemorySize = memorySize;
 
             closeLutStream(config, filestream);
 
@@ -725,6 +751,8 @@ void LoadFileUncached(FileFormat * & returnFormat,
                 throw Exception(os.str().c_str());
             }
 
+            const size_t memorySize = GetStreamSize(filestream);
+
             cachedFile = altFormat->read(filestream, filepath, interp);
 
             if(IsDebugLoggingEnabled())
@@ -737,6 +765,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = altFormat;
             returnCachedFile = cachedFile;
+            returnMemorySize = memorySize;
 
             closeLutStream(config, filestream);
 
@@ -802,6 +831,7 @@ struct FileCacheResult
     bool ready = false;
     bool error = false;
     CachedFileRcPtr cachedFile;
+    size_t memorySize = 0;
     std::string exceptionText;
 
     FileCacheResult() = default;
@@ -809,6 +839,16 @@ struct FileCacheResult
 
 typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
 
+struct FileReference
+{
+    std::string m_filepath;
+    Interpolation m_interp;
+};
+
+// When set, BuildFileTransformOps() only collects the files instead of building their ops
+// (refer to PrefetchFileTransforms()).
+thread_local std::vector<FileReference> * g_collectedFiles = nullptr;
+
 } // namespace
 
 
@@ -816,6 +856,21 @@ typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
 template class GenericCache<std::string, FileCacheResultPtr>;
 GenericCache<std::string, FileCacheResultPtr> g_fileCache;
 
+namespace
+{
+
+void LogFileCacheEviction(const std::string & filepath, const FileCacheResultPtr & /*result*/)
+{
+    if (IsDebugLoggingEnabled())
+    {
+        std::ostringstream oss;
+        oss << "Evicting " << filepath << " from the file cache.";
+        LogDebug(oss.str());
+    }
+}
+
+} // namespace
+
 void GetCachedFileAndFormat(FileFormat * & format,
                             CachedFileRcPtr & cachedFile,
                             const std::string & filepath,
@@ -826,40 +881,28 @@ void GetCachedFileAndFormat(FileFormat * & format,
     // the data creation. It was originally done to improve the multi-threaded
     // file lookup.  Refer to PR #309 for details.
 
-    // Load the file cache ptr from the global map
-    FileCacheResultPtr result;
+    // Load the file cache ptr from the global map (i.e. an empty one is created if the file
+    // is not in the cache yet).
+    FileCacheResultPtr result = g_fileCache.findOrInsert(filepath, []()
     {
-        AutoMutex guard(g_fileCache.lock());
-    
-        if (g_fileCache.isEnabled())
-        {
-            // As the entry is a shared pointer instance, having an empty one
-            // means that the entry does not exist in the cache. So, it provides
-            // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
-            {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
-            }
-        }
-        else
-        {
-            result = std::make_shared<FileCacheResult>();
-        }
-    }
+        return std::make_shared<FileCacheResult>();
+    });
 
     // If this file has already been loaded, return the result immediately.
 
+    bool loaded = false;
+
     AutoMutex lock(result->mutex);
     if (!result->ready)
     {
         result->ready = true;
+        loaded = true;
         result->error = false;
 
         try
         {
-            LoadFileUncached(result->format, result->cachedFile, filepath, interp, config);
+            LoadFileUncached(result->format, result->cachedFile, result->memorySize,
+                             filepath, interp, config);
         }
         catch (std::exception & e)
         {
@@ -886,6 +929,13 @@ void GetCachedFileAndFormat(FileFormat * & format,
         cachedFile = result->cachedFile;
     }
 
+    if (loaded)
+    {
+        // The memory size is only known once the file is loaded. Note that it does nothing if
+        // the entry was evicted or the cache cleared in the meantime.
+        g_fileCache.setEntryMemorySize(filepath, result->memorySize);
+    }
+
     if (!format)
     {
         std::ostringstream os;
@@ -905,11 +955,186 @@ void GetCachedFileAndFormat(FileFormat * & format,
     }
 }
 
+namespace
+{
+
+// Collect the FileTransforms of a transform and return true if it also references some config
+// elements (e.g. color spaces or looks) which could use other files.
+bool GetFileTransforms(std::vector<ConstFileTransformRcPtr> & fileTransforms,
+                       const ConstTransformRcPtr & transform)
+{
+    if (ConstGroupTransformRcPtr group = DynamicPtrCast<const GroupTransform>(transform))
+    {
+        bool usesConfig = false;
+        for (int idx = 0; idx < group->getNumTransforms(); ++idx)
+        {
+            usesConfig = GetFileTransforms(fileTransforms, group->getTransform(idx)) || usesConfig;
+        }
+        return usesConfig;
+    }
+    else if (ConstFileTransformRcPtr file = DynamicPtrCast<const FileTransform>(transform))
+    {
+        fileTransforms.push_back(file);
+        return false;
+    }
+
+    return DynamicPtrCast<const ColorSpaceTransform>(transform)
+        || DynamicPtrCast<const DisplayViewTransform>(transform)
+        || DynamicPtrCast<const LookTransform>(transform);
+}
+
+// Resets the collection of the files even if building the ops fails.
+class CollectFilesGuard
+{
+public:
+    explicit CollectFilesGuard(std::vector<FileReference> & files) { g_collectedFiles = &files; }
+    CollectFilesGuard(const CollectFilesGuard &) = delete;
+    CollectFilesGuard & operator=(const CollectFilesGuard &) = delete;
+    ~CollectFilesGuard() { g_collectedFiles = nullptr; }
+};
+
+} // namespace
+
+void PrefetchFileTransforms(const Config & config,
+                            const ConstContextRcPtr & context,
+                            const ConstTransformRcPtr & transform,
+                            TransformDirection dir)
+{
+    // Note that the config I/O proxy is not required to support concurrent reads.
+    if (g_collectedFiles || !g_fileCache.isEnabled() || config.getConfigIOProxy())
+    {
+        return;
+    }
+
+    // Cheaply find the files the transform could use i.e. its own files and, when it references
+    // some config elements, all the config files. There is nothing to prefetch if less than two
+    // of them are not loaded yet.
+    std::vector<ConstFileTransformRcPtr> fileTransforms;
+    const bool usesConfig = GetFileTransforms(fileTransforms, transform);
+
+    std::set<std::string> srcs;
+    for (const auto & fileTransform : fileTransforms)
+    {
+        srcs.insert(fileTransform->getSrc());
+    }
+
+    if (usesConfig)
+    {
+        ConfigUtils::GetFileReferences(srcs, config);
+    }
+
+    size_t numUncached = 0;
+    for (const auto & src : srcs)
+    {
+        if (src.empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            if (!g_fileCache.exists(context->resolveFileLocation(src.c_str())))
+            {
+                ++numUncached;
+            }
+        }
+        catch (const Exception &)
+        {
+            // The error is reported when building the ops.
+        }
+    }
+
+    if (numUncached < 2)
+    {
+        return;
+    }
+
+    std::vector<FileReference> files;
+    if (!usesConfig)
+    {
+        // The files are exactly the ones of the transform.
+        for (const auto & fileTransform : fileTransforms)
+        {
+            try
+            {
+                files.push_back({ context->resolveFileLocation(fileTransform->getSrc()),
+                                  fileTransform->getInterpolation() });
+            }
+            catch (const Exception &)
+            {
+            }
+        }
+    }
+    else
+    {
+        // Find the used files by building the ops without the file ones. That misses the files
+        // only referenced by other files (e.g. the CTF references), and the ones after an error.
+        OpRcPtrVec ops;
+        CollectFilesGuard guard(files);
+        try
+        {
+            BuildOps(ops, config, context, transform, dir);
+        }
+        catch (const Exception &)
+        {
+            // The error is reported when building the ops.
+        }
+    }
+
+    // Skip the files already loaded, or being loaded by another thread.
+    std::vector<FileReference> filesToLoad;
+    for (const auto & file : files)
+    {
+        const bool found = std::find_if(filesToLoad.begin(), filesToLoad.end(),
+                                        [&file](const FileReference & ref)
+                                        {
+                                            return ref.m_filepath == file.m_filepath;
+                                        }) != filesToLoad.end();
+
+        if (!found && !g_fileCache.exists(file.m_filepath))
+        {
+            filesToLoad.push_back(file);
+        }
+    }
+
+    if (filesToLoad.size() < 2)
+    {
+        return;
+    }
+
+    // The per-file mutex of the cache entries makes the loading threads wait for each other
+    // if the same file is concurrently requested.
+    GetThreadPool().parallelFor(long(filesToLoad.size()), 1, 0,
+                                [&](long begin, long end, unsigned)
+    {
+        for (long idx = begin; idx < end; ++idx)
+        {
+            FileFormat * format = nullptr;
+            CachedFileRcPtr cachedFile;
+            try
+            {
+                GetCachedFileAndFormat(format, cachedFile, filesToLoad[idx].m_filepath,
+                                       filesToLoad[idx].m_interp, config);
+            }
+            catch (const Exception &)
+            {
+                // The error is kept by the cache entry.
+            }
+        }
+    });
+}
+
 void ClearFileTransformCaches()
 {
     g_fileCache.clear();
 }
 
+void SetFileTransformCacheLimits(size_t maxEntries, size_t maxMemorySize)
+{
+    g_fileCache.setEvictionCallback(LogFileCacheEviction);
+    g_fileCache.setLimits(maxEntries, maxMemorySize);
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -926,6 +1151,12 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
 
     std::string filepath = context->resolveFileLocation(src.c_str());
 
+    if (g_collectedFiles)
+    {
+        g_collectedFiles->push_back({ filepath, fileTransform.getInterpolation() });
+        return;
+    }
+
     // Verify the recursion is valid, FileNoOp is added for each file.
     for (const OpRcPtr & op : ops)
     {
@@ -19,6 +19,7 @@
 namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
+void SetFileTransformCacheLimits(size_t maxEntries, size_t maxMemorySize);
 
 class CachedFile
 {
@@ -114,6 +115,14 @@ void GetCachedFileAndFormat(FileFormat * & format,
                             Interpolation interp,
                             const Config& config);
 
+// Concurrently load in the file cache the files used by the ops of a transform, so that
+// building the ops does not read them one after the other. The errors are ignored i.e. they are
+// reported when building the ops.
+void PrefetchFileTransforms(const Config & config,
+                            const ConstContextRcPtr & context,
+                            const ConstTransformRcPtr & transform,
+                            TransformDirection dir);
+
 typedef std::map<std::string, FileFormat*> FileFormatMap;
 typedef std::vector<FileFormat*> FileFormatVector;
 typedef std::map<std::string, FileFormatVector> FileFormatVectorMap;
@@ -44,6 +44,8 @@ int main(int argc, const char **argv)
     std::string configFilename;
     // Default value is current directory.
     std::string extractDestination;
+    std::string precompileDir;
+    std::string srcColorSpaces;
 
     bool extract    = false;
     bool list       = false;
@@ -66,13 +68,18 @@ int main(int argc, const char **argv)
                "    # Extract myarchive.ocioz into new directory named ocio_config\n"
                "    ocioarchive --extract myarchive.ocioz --dir ocio_config\n\n"
                "    # List the files inside myarchive.ocioz\n"
-               "    ocioarchive --list myarchive.ocioz\n",
+               "    ocioarchive --list myarchive.ocioz\n\n"
+               "    # Precompile the display/view processors of myconfig/config.ocio into the\n"
+               "    # existing processor cache directory mycache (refer to $OCIO_PROCESSOR_CACHE_DIR)\n"
+               "    ocioarchive --precompile mycache --iconfig myconfig/config.ocio\n",
                "%*", parse_end_args, "",
                "<SEPARATOR>", "Options:",
                "--iconfig %s",  &configFilename,        "Config to archive (takes precedence over $OCIO)",
                "--extract",     &extract,               "Extract an OCIOZ config archive",
                "--dir %s",      &extractDestination,    "Path where to extract the files (folders are created if missing)",
                "--list",        &list,                  "List the files inside an archive without extracting it",
+               "--precompile %s", &precompileDir,       "Precompile the display/view processors of the config into a processor cache directory",
+               "--src %s",      &srcColorSpaces,        "Comma-separated source color spaces to precompile (default is the scene_linear role)",
                "--help",        &help,                  "Display the help and exit",
                "-h",            &help,                  "Display the help and exit",
                NULL
@@ -84,15 +91,83 @@ int main(int argc, const char **argv)
         exit(1);
     }
 
-    if (help || args.size() == 0)
+    if (help || (args.size() == 0 && precompileDir.empty()))
     {
         ap.usage();
         return 0;
     }
 
+    // Precompiling.
+
+    if (!precompileDir.empty())
+    {
+        if (extract || list || args.size() != 0)
+        {
+            std::cerr << "ERROR: The precompile function may not be used with the archive, "
+                         "extract, or list functions." << std::endl;
+            exit(1);
+        }
+
+        try
+        {
+            // The config reads the processor cache directory at creation.
+            OCIO::SetEnvVariable(OCIO::OCIO_PROCESSOR_CACHE_DIR_ENVVAR, precompileDir.c_str());
+
+            OCIO::ConstConfigRcPtr config;
+            if (!configFilename.empty())
+            {
+                config = OCIO::Config::CreateFromFile(configFilename.c_str());
+            }
+            else
+            {
+                config = OCIO::Config::CreateFromEnv();
+            }
+
+            std::vector<std::string> srcNames;
+            if (!srcColorSpaces.empty())
+            {
+                srcNames = StringUtils::Split(srcColorSpaces, ',');
+            }
+            else
+            {
+                srcNames.push_back(OCIO::ROLE_SCENE_LINEAR);
+            }
+
+            size_t numBuilt = 0;
+            size_t numTotal = 0;
+            for (const auto & name : srcNames)
+            {
+                const std::string srcName = StringUtils::Trim(name);
+                if (!config->getColorSpace(srcName.c_str()))
+                {
+                    std::cerr << "ERROR: Unknown source color space: " << srcName << std::endl;
+                    exit(1);
+                }
+
+                size_t numProcessors = 0;
+                numBuilt += config->warmUpProcessors(config->getCurrentContext(), srcName.c_str(),
+                                                     [&numProcessors](size_t, size_t total)
+                                                     {
+                                                         numProcessors = total;
+                                                         return true;
+                                                     });
+                numTotal += numProcessors;
+            }
+
+            // Only the processors using files are saved in the processor cache directory.
+            std::cout << "Built " << numBuilt << " of " << numTotal << " display/view processors, "
+                      << "the ones using LUT files are saved in " << precompileDir << std::endl;
+        }
+        catch (OCIO::Exception & exception)
+        {
+            std::cerr << "ERROR: " << exception.what() << std::endl;
+            exit(1);
+        }
+    }
+
     // Archiving.
 
-    if (!extract && !list)
+    else if (!extract && !list)
     {
         if (args.size() != 1)
         {
@@ -431,12 +431,12 @@ int main(int argc, const char **argv)
             {
                 OCIO::ImageDescRcPtr srcImgDesc = imgInput.getImageDesc();
                 OCIO::ImageDescRcPtr dstImgDesc = imgOutputCPU.getImageDesc();
-                cpuProcessor->apply(*srcImgDesc, *dstImgDesc);
+                cpuProcessor->applyParallel(*srcImgDesc, *dstImgDesc);
             }
             else
             {
                 OCIO::ImageDescRcPtr imgDesc = imgInput.getImageDesc();
-                cpuProcessor->apply(*imgDesc);
+                cpuProcessor->applyParallel(*imgDesc);
             }
 
             if (verbose)
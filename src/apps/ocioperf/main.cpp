@@ -11,6 +11,10 @@
 #include <cmath>
 #include <limits>
 #include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
 
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -109,6 +113,124 @@ private:
     std::vector<std::chrono::duration<float, std::milli>> m_durations;
 };
 
+// Print the statistics of each step of the processing.
+void PrintStatistics(const OCIO::ConstCPUProcessorRcPtr & cpuProcessor)
+{
+    const int numStats = cpuProcessor->getNumStatistics();
+
+    double totalSeconds = 0.;
+    for (int idx = 0; idx < numStats; ++idx)
+    {
+        totalSeconds += cpuProcessor->getStatisticsSeconds(idx);
+    }
+
+    std::cout << std::endl << "Processing steps:" << std::endl;
+
+    for (int idx = 0; idx < numStats; ++idx)
+    {
+        const double seconds = cpuProcessor->getStatisticsSeconds(idx);
+
+        std::ostringstream oss;
+        oss.precision(6);
+        oss << "\t" << cpuProcessor->getStatisticsName(idx) << ":\t" << (seconds * 1000.)
+            << " ms (" << (totalSeconds > 0. ? 100. * seconds / totalSeconds : 0.) << "%), "
+            << cpuProcessor->getStatisticsNumCalls(idx) << " calls, "
+            << cpuProcessor->getStatisticsNumPixels(idx) << " pixels";
+
+        std::cout << oss.str() << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+// Measure the reading of LUT files (i.e. the file parsing and the op creation) without any
+// cache.
+static std::vector<std::string> lutFiles;
+
+static int parse_end_args(int /* argc */, const char *argv[])
+{
+    lutFiles.push_back(argv[0]);
+    return 0;
+}
+
+void ReadLutFiles(unsigned iterations)
+{
+    OCIO::ConfigRcPtr config  = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    for (const auto & lutFile : lutFiles)
+    {
+        OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+        transform->setSrc(lutFile.c_str());
+
+        // Skip the unsupported or invalid files. That also loads the file in the system cache.
+        try
+        {
+            config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+        }
+        catch (const OCIO::Exception & ex)
+        {
+            std::cout << "Skipping '" << lutFile << "': " << ex.what() << std::endl;
+            continue;
+        }
+
+        const std::string explanation = "Read '" + lutFile + "':\t";
+
+        CustomMeasure m(explanation.c_str(), iterations);
+        for (unsigned iter = 0; iter < iterations; ++iter)
+        {
+            OCIO::ClearAllCaches();
+
+            m.resume();
+            config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+            m.pause();
+        }
+    }
+}
+
+// Measure the creation of the CPU processor inverting a 3D LUT of the given grid size. The
+// default optimizations replace the inverse 3D LUT with a forward one (i.e. the 'fast' inverse)
+// which is the slow part.
+void InvertLut3D(unsigned gridSize, unsigned iterations)
+{
+    OCIO::ConfigRcPtr config  = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    // A smooth monotonic LUT with some crosstalk between the channels.
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    const float step = 1.0f / float(gridSize - 1);
+    for (unsigned r = 0; r < gridSize; ++r)
+    {
+        for (unsigned g = 0; g < gridSize; ++g)
+        {
+            for (unsigned b = 0; b < gridSize; ++b)
+            {
+                const float rv = std::pow(r * step, 0.8f);
+                const float gv = std::pow(g * step, 0.9f);
+                const float bv = std::pow(b * step, 1.1f);
+                lut->setValue(r, g, b, 0.8f * rv + 0.1f * gv + 0.1f * bv,
+                                       0.1f * rv + 0.8f * gv + 0.1f * bv,
+                                       0.1f * rv + 0.1f * gv + 0.8f * bv);
+            }
+        }
+    }
+
+    const std::string explanation
+        = "Create the inverse " + std::to_string(gridSize) + "^3 LUT CPU processor:\t";
+
+    CustomMeasure m(explanation.c_str(), iterations);
+    for (unsigned iter = 0; iter < iterations; ++iter)
+    {
+        OCIO::ClearAllCaches();
+
+        m.resume();
+        OCIO::ConstProcessorRcPtr processor
+            = config->getProcessor(lut, OCIO::TRANSFORM_DIR_INVERSE);
+        processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_DEFAULT);
+        m.pause();
+    }
+}
+
 // Process the complete image line by line.
 void ProcessLines(CustomMeasure & m,
                   OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
@@ -177,15 +299,25 @@ int main(int argc, const char **argv)
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
     unsigned iterations = 50;
+    unsigned numThreads = 1;
+    int chunkSize = 0;
+    bool chunkSweep = false;
+    bool randomImage = false;
     bool nocache = false, nooptim = false;
+    bool compactLuts = false;
 
     bool useColorspaces = false;
     bool useDisplayview = false;
     bool useInvertview  = false;
 
+    bool readLuts = false;
+    unsigned invLutSize = 0;
+
     ArgParse ap;
     ap.options("ocioperf -- apply and measure a color transformation processing\n\n"
-               "usage: ocioperf [options] --transform /path/to/file.clf\n\n",
+               "usage: ocioperf [options] --transform /path/to/file.clf\n"
+               "       ocioperf [options] --readluts /path/to/files/*\n\n",
+               "%*", parse_end_args, "",
                "--h",                       &help,              
                                             "Display the help and exit",
                "--help",                    &help,              
@@ -213,6 +345,26 @@ int main(int argc, const char **argv)
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--compactluts",             &compactLuts,
+                                            "Store the 3D LUTs of the CPU processor with 16-bit entries "\
+                                            "(i.e. OPTIMIZATION_LUT_COMPACT_STORAGE). Default is false",
+               "--threads %d",              &numThreads,
+                                            "Provide the number of threads processing the complete image "\
+                                            "(0 means one per hardware thread). Default is 1",
+               "--chunksize %d",            &chunkSize,
+                                            "Provide the maximum number of pixels of a line processed at once "\
+                                            "(0 means derived from the cache size). Default is 0",
+               "--chunksweep",              &chunkSweep,
+                                            "Measure the complete image processing for a range of chunk sizes",
+               "--random",                  &randomImage,
+                                            "Process an image of random colors (i.e. without any coherence "\
+                                            "between neighboring pixels). Default is false",
+               "--readluts",                &readLuts,
+                                            "Only measure the reading of the LUT files listed after "\
+                                            "the options (e.g. a LUT corpus) and exit",
+               "--invlut3d %d",             &invLutSize,
+                                            "Only measure the creation of the processor inverting a "\
+                                            "3D LUT of the given size (e.g. 65) and exit",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -228,6 +380,12 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (chunkSize < 0)
+    {
+        std::cerr << "ERROR: Invalid chunk size: " << chunkSize << std::endl;
+        return 1;
+    }
+
     if (verbose)
     {
         std::cout << std::endl;
@@ -253,6 +411,36 @@ int main(int argc, const char **argv)
         }
     }
 
+    if (invLutSize > 0)
+    {
+        if (invLutSize < 2 || invLutSize > 129)
+        {
+            std::cerr << "ERROR: Invalid 3D LUT size: " << invLutSize << std::endl;
+            return 1;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Inversion statistics:" << std::endl << std::endl;
+
+        InvertLut3D(invLutSize, iterations);
+        return 0;
+    }
+
+    if (readLuts)
+    {
+        if (lutFiles.empty())
+        {
+            std::cerr << "ERROR: Missing the LUT files to read." << std::endl;
+            return 1;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Reading statistics:" << std::endl << std::endl;
+
+        ReadLutFiles(iterations);
+        return 0;
+    }
+
     if (!transformFile.empty())
     {
         std::cout << std::endl;
@@ -421,8 +609,12 @@ int main(int argc, const char **argv)
             throw OCIO::Exception("Missing color transformation description.");
         }
 
-        const OCIO::OptimizationFlags optimFlags
+        OCIO::OptimizationFlags optimFlags
             = nooptim ? OCIO::OPTIMIZATION_NONE : OCIO::OPTIMIZATION_DEFAULT;
+        if (compactLuts)
+        {
+            optimFlags = OCIO::OptimizationFlags(optimFlags | OCIO::OPTIMIZATION_LUT_COMPACT_STORAGE);
+        }
 
         auto GetBitDepthFromString = [](const std::string & str) -> OCIO::BitDepth 
         {
@@ -512,6 +704,14 @@ int main(int argc, const char **argv)
             }
         }
 
+        if (compactLuts)
+        {
+            std::cout << "Max error of the compact 3D LUTs:\t"
+                      << cpuProcessor->getCompactLutMaxError() << std::endl;
+        }
+
+        OCIO::SetCPUProcessorChunkSize(chunkSize);
+
         std::cout << std::endl << std::endl;
         std::cout << "Image processing statistics:" << std::endl << std::endl;
 
@@ -531,6 +731,13 @@ int main(int argc, const char **argv)
         // that would result in more cache hits than a typical image.  Also, want to step through a 
         // wide range of colors, including outside [0,1], in case some algorithms are faster or
         // slower for certain colors.
+        //
+        // The random image is the worst case for the algorithms using tables (e.g. the LUTs) as
+        // consecutive pixels read distant table entries.  The seed is fixed so that all the runs
+        // process the same image.
+
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
 
         static constexpr size_t length   = 201;
         static constexpr float stepValue = 1.0f / ((float)length - 1.0f);
@@ -551,9 +758,18 @@ int main(int argc, const char **argv)
 
             for (size_t idx = 0; idx < maxElts; ++idx)
             {
-                img_f32_ref[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
-                img_f32_ref[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
-                img_f32_ref[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
+                if (randomImage)
+                {
+                    img_f32_ref[numChannels * idx + 0] = adjustValue( distribution(generator) );
+                    img_f32_ref[numChannels * idx + 1] = adjustValue( distribution(generator) );
+                    img_f32_ref[numChannels * idx + 2] = adjustValue( distribution(generator) );
+                }
+                else
+                {
+                    img_f32_ref[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
+                    img_f32_ref[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
+                    img_f32_ref[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
+                }
 
                 img_f32_ref[numChannels * idx + 3] = adjustValue( float(idx) / maxElts );
             }
@@ -570,9 +786,18 @@ int main(int argc, const char **argv)
 
             for (size_t idx = 0; idx < maxElts; ++idx)
             {
-                img_ui16_ref[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
-                img_ui16_ref[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
-                img_ui16_ref[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
+                if (randomImage)
+                {
+                    img_ui16_ref[numChannels * idx + 0] = adjustValue( distribution(generator) );
+                    img_ui16_ref[numChannels * idx + 1] = adjustValue( distribution(generator) );
+                    img_ui16_ref[numChannels * idx + 2] = adjustValue( distribution(generator) );
+                }
+                else
+                {
+                    img_ui16_ref[numChannels * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
+                    img_ui16_ref[numChannels * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
+                    img_ui16_ref[numChannels * idx + 2] = adjustValue( (idx % length) * stepValue );
+                }
 
                 img_ui16_ref[numChannels * idx + 3] = adjustValue( float(idx) / maxElts );
             }
@@ -603,7 +828,7 @@ int main(int argc, const char **argv)
 
                     // Apply the color transformation.
                     m.resume();
-                    cpuProcessor->apply(imgDesc);
+                    cpuProcessor->applyParallel(imgDesc, numThreads);
                     m.pause();
                 }
             }
@@ -645,14 +870,30 @@ int main(int argc, const char **argv)
                                                                   outBitDepth,
                                                                   optimFlags);
 
-                CustomMeasure m("Process the complete image (two buffers):\t\t\t", iterations);
+                {
+                    CustomMeasure m("Process the complete image (two buffers):\t\t\t", iterations);
 
-                for(unsigned iter=0; iter<iterations; ++iter)
+                    for(unsigned iter=0; iter<iterations; ++iter)
+                    {
+                        // Apply the color transformation.
+                        m.resume();
+                        cpu->applyParallel(inImgDesc, outImgDesc, numThreads);
+                        m.pause();
+                    }
+                }
+
+                if (verbose)
                 {
-                    // Apply the color transformation.
-                    m.resume();
-                    cpu->apply(inImgDesc, outImgDesc);
-                    m.pause();
+                    // One more processing to collect the per-op statistics, which are not
+                    // enabled during the measures as they change the processing.
+                    const bool statisticsEnabled = cpu->isStatisticsEnabled();
+
+                    cpu->resetStatistics();
+                    cpu->setStatisticsEnabled(true);
+                    cpu->applyParallel(inImgDesc, outImgDesc, numThreads);
+                    cpu->setStatisticsEnabled(statisticsEnabled);
+
+                    PrintStatistics(cpu);
                 }
             }
         }
@@ -701,6 +942,81 @@ int main(int argc, const char **argv)
             }
         }
 
+        if (chunkSweep)
+        {
+            // Process the complete image with input and output buffers using several chunk sizes
+            // to find where the throughput stops improving.
+
+            std::vector<float>    inImg_f32  = img_f32_ref;
+            std::vector<uint16_t> inImg_ui16 = img_ui16_ref;
+
+            OCIO::PackedImageDesc inImgDesc(inBitDepth == OCIO::BIT_DEPTH_F32
+                                                ? (void*)&inImg_f32[0] : (void*)&inImg_ui16[0],
+                                            width,
+                                            height,
+                                            numChannels,
+                                            inBitDepth,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride,
+                                            OCIO::AutoStride);
+
+            std::vector<float> outImg_f32(outBitDepth == OCIO::BIT_DEPTH_F32 ? maxElts * numChannels : 0);
+            std::vector<uint16_t> outImg_ui16(outBitDepth == OCIO::BIT_DEPTH_UINT16 ? maxElts * numChannels : 0);
+
+            OCIO::PackedImageDesc outImgDesc(outBitDepth == OCIO::BIT_DEPTH_F32
+                                                ? (void*)&outImg_f32[0] : (void*)&outImg_ui16[0],
+                                             width,
+                                             height,
+                                             numChannels,
+                                             outBitDepth,
+                                             OCIO::AutoStride,
+                                             OCIO::AutoStride,
+                                             OCIO::AutoStride);
+
+            auto cpu = optProcessor->getOptimizedCPUProcessor(inBitDepth,
+                                                              outBitDepth,
+                                                              optimFlags);
+
+            std::cout << std::endl;
+
+            // Powers of two up to the image width, and then the default chunk size.
+            std::vector<long> chunkSizes;
+            for (long size = 64; size < long(width); size *= 2)
+            {
+                chunkSizes.push_back(size);
+            }
+            chunkSizes.push_back(long(width));
+            chunkSizes.push_back(0);
+
+            for (const long size : chunkSizes)
+            {
+                OCIO::SetCPUProcessorChunkSize(size);
+
+                std::ostringstream oss;
+                oss << "Process the complete image (two buffers) with chunks of ";
+                if (size > 0)
+                {
+                    oss << size << " pixels:\t";
+                }
+                else
+                {
+                    oss << "default size:\t";
+                }
+
+                CustomMeasure m(oss.str().c_str(), iterations);
+
+                for(unsigned iter=0; iter<iterations; ++iter)
+                {
+                    // Apply the color transformation.
+                    m.resume();
+                    cpu->applyParallel(inImgDesc, outImgDesc, numThreads);
+                    m.pause();
+                }
+            }
+
+            OCIO::SetCPUProcessorChunkSize(chunkSize);
+        }
+
         std::cout << std::endl << std::endl;
 
     }
@@ -43,6 +43,8 @@ void bindPyCPUProcessor(py::module & m)
              DOC(CPUProcessor, hasDynamicProperty))
         .def("isDynamic", &CPUProcessor::isDynamic,
              DOC(CPUProcessor, isDynamic))
+        .def("getCompactLutMaxError", &CPUProcessor::getCompactLutMaxError,
+             DOC(CPUProcessor, getCompactLutMaxError))
 
         .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc) 
             {
@@ -90,6 +92,43 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     pointer. The dedicated packed ``apply*`` methods utilize 
     ``ImageDesc`` on the C++ side so avoid the copy.
 
+)doc")
+        .def("applyParallel", [](CPUProcessorRcPtr & self, 
+                                 PyImageDesc & imgDesc, 
+                                 unsigned numThreads) 
+            {
+                self->applyParallel((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a = 0,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Same as ``apply`` but the image is split in bands of lines processed 
+concurrently by an internal pool of threads. The result is identical to 
+``apply``. A ``numThreads`` of 0 means one thread per hardware thread.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("applyParallel", [](CPUProcessorRcPtr & self, 
+                                 PyImageDesc & srcImgDesc, 
+                                 PyImageDesc & dstImgDesc,
+                                 unsigned numThreads)
+            {
+                self->applyParallel((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a = 0,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Same as ``apply`` but the image is split in bands of lines processed 
+concurrently by an internal pool of threads. The result is identical to 
+``apply``. A ``numThreads`` of 0 means one thread per hardware thread.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
             {
@@ -240,7 +279,26 @@ float values is returned, leaving the input list unchanged.
     List values are copied on input and output, where an array is 
     modified in place.
 
-)doc");
+)doc")
+
+        .def("setStatisticsEnabled", &CPUProcessor::setStatisticsEnabled, "enabled"_a,
+             DOC(CPUProcessor, setStatisticsEnabled))
+        .def("isStatisticsEnabled", &CPUProcessor::isStatisticsEnabled,
+             DOC(CPUProcessor, isStatisticsEnabled))
+        .def("resetStatistics", &CPUProcessor::resetStatistics,
+             DOC(CPUProcessor, resetStatistics))
+        .def("getNumStatistics", &CPUProcessor::getNumStatistics,
+             DOC(CPUProcessor, getNumStatistics))
+        .def("getStatisticsName", &CPUProcessor::getStatisticsName, "index"_a,
+             DOC(CPUProcessor, getStatisticsName))
+        .def("getStatisticsSeconds", &CPUProcessor::getStatisticsSeconds, "index"_a,
+             DOC(CPUProcessor, getStatisticsSeconds))
+        .def("getStatisticsNumCalls", &CPUProcessor::getStatisticsNumCalls, "index"_a,
+             DOC(CPUProcessor, getStatisticsNumCalls))
+        .def("getStatisticsNumPixels", &CPUProcessor::getStatisticsNumPixels, "index"_a,
+             DOC(CPUProcessor, getStatisticsNumPixels))
+        .def("getStatisticsAsJSON", &CPUProcessor::getStatisticsAsJSON,
+             DOC(CPUProcessor, getStatisticsAsJSON));
 }
 
 } // namespace OCIO_NAMESPACE
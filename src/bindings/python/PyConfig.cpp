@@ -82,6 +82,10 @@ void bindPyConfig(py::module & m)
         py::class_<Config, ConfigRcPtr>(
             m.attr("Config"));
 
+    auto clsDisplayViewProcessorDesc = 
+        py::class_<DisplayViewProcessorDesc>(
+            m.attr("DisplayViewProcessorDesc"));
+
     auto clsEnvironmentVarNameIterator = 
         py::class_<EnvironmentVarNameIterator>(
             clsConfig, "EnvironmentVarNameIterator");
@@ -174,6 +178,17 @@ void bindPyConfig(py::module & m)
         py::class_<ActiveNamedTransformIterator>(
             clsConfig, "ActiveNamedTransformIterator");
 
+    clsDisplayViewProcessorDesc
+        .def(py::init<>())
+        .def_readwrite("srcColorSpace", &DisplayViewProcessorDesc::m_srcColorSpace, 
+                       DOC(DisplayViewProcessorDesc, m_srcColorSpace))
+        .def_readwrite("display", &DisplayViewProcessorDesc::m_display, 
+                       DOC(DisplayViewProcessorDesc, m_display))
+        .def_readwrite("view", &DisplayViewProcessorDesc::m_view, 
+                       DOC(DisplayViewProcessorDesc, m_view))
+        .def_readwrite("looks", &DisplayViewProcessorDesc::m_looks, 
+                       DOC(DisplayViewProcessorDesc, m_looks));
+
     clsConfig
         .def(py::init(&Config::Create), 
              DOC(Config, Create))
@@ -639,6 +654,18 @@ void bindPyConfig(py::module & m)
                 return py::make_tuple(csName, ruleIndex);
             }, "filePath"_a, 
             DOC(Config, getColorSpaceFromFilepath))
+        .def("getColorSpacesFromFilepaths",
+            [](ConfigRcPtr & self, const std::vector<std::string> & filePaths)
+            {
+                std::vector<std::string> colorSpaces;
+                std::vector<size_t> ruleIndices;
+                {
+                    py::gil_scoped_release release;
+                    self->getColorSpacesFromFilepaths(filePaths, colorSpaces, ruleIndices);
+                }
+                return py::make_tuple(colorSpaces, ruleIndices);
+            }, "filePaths"_a, 
+            DOC(Config, getColorSpacesFromFilepaths))
         .def("filepathOnlyMatchesDefaultRule", &Config::filepathOnlyMatchesDefaultRule, 
              "filePath"_a, 
              DOC(Config, filepathOnlyMatchesDefaultRule))
@@ -730,6 +757,23 @@ void bindPyConfig(py::module & m)
              &Config::getProcessor, 
              "context"_a, "transform"_a, "direction"_a, 
              DOC(Config, getProcessor, 13))
+        // The callback could be called from any thread so the GIL must be released.
+        .def("warmUpProcessors", 
+             (size_t (Config::*)(const ConstContextRcPtr &, 
+                                 const DisplayViewProcessorDescVec &,
+                                 const ProcessorWarmUpCallback &) const) 
+             &Config::warmUpProcessors, 
+             "context"_a, "processors"_a, "callback"_a = ProcessorWarmUpCallback(),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(Config, warmUpProcessors))
+        .def("warmUpProcessors", 
+             (size_t (Config::*)(const ConstContextRcPtr &, 
+                                 const char *,
+                                 const ProcessorWarmUpCallback &) const) 
+             &Config::warmUpProcessors, 
+             "context"_a, "srcColorSpaceName"_a, "callback"_a = ProcessorWarmUpCallback(),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(Config, warmUpProcessors, 2))
         .def_static("GetProcessorToBuiltinColorSpace", [](const ConstConfigRcPtr & srcConfig,
                                                           const char * srcColorSpaceName,
                                                           const char * builtinColorSpaceName)
@@ -886,6 +930,9 @@ void bindPyConfig(py::module & m)
                     DOC(Config, GetProcessorFromConfigs, 8))
         .def("setProcessorCacheFlags", &Config::setProcessorCacheFlags, "flags"_a, 
              DOC(Config, setProcessorCacheFlags))
+        .def("setProcessorCacheLimits", &Config::setProcessorCacheLimits,
+             "maxEntries"_a, "maxMemorySize"_a,
+             DOC(Config, setProcessorCacheLimits))
         .def("clearProcessorCache", &Config::clearProcessorCache, 
              DOC(Config, setProcessorCacheFlags))
 
@@ -40,6 +40,8 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("SetFileCacheLimits", &SetFileCacheLimits, "maxEntries"_a, "maxMemorySize"_a,
+          DOC(PyOpenColorIO, SetFileCacheLimits));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
@@ -58,6 +60,10 @@ PYBIND11_MODULE(PyOpenColorIO, m)
           DOC(PyOpenColorIO, SetComputeHashFunction));
     m.def("ResetComputeHashFunction", &ResetComputeHashFunction,
           DOC(PyOpenColorIO, ResetComputeHashFunction));
+    m.def("GetCPUProcessorChunkSize", &GetCPUProcessorChunkSize,
+          DOC(PyOpenColorIO, GetCPUProcessorChunkSize));
+    m.def("SetCPUProcessorChunkSize", &SetCPUProcessorChunkSize, "numPixels"_a,
+          DOC(PyOpenColorIO, SetCPUProcessorChunkSize));
     m.def("GetEnvVariable", &GetEnvVariable, "name"_a,
           DOC(PyOpenColorIO, GetEnvVariable));
     m.def("SetEnvVariable", &SetEnvVariable, "name"_a, "value"_a,
@@ -34,6 +34,10 @@ void bindPyTypes(py::module & m)
         m, "Config",
         DOC(Config));
 
+    py::class_<DisplayViewProcessorDesc>(
+        m, "DisplayViewProcessorDesc",
+        DOC(DisplayViewProcessorDesc));
+
     py::class_<Context, ContextRcPtr /* holder */>(
         m, "Context", 
         DOC(Context));
@@ -737,6 +741,8 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_LUT_COMPACT_STORAGE", OPTIMIZATION_LUT_COMPACT_STORAGE, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_LUT_COMPACT_STORAGE))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -852,6 +858,9 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
+    m.attr("OCIO_CPU_STATISTICS_ENVVAR") = OCIO_CPU_STATISTICS_ENVVAR;
+    m.attr("OCIO_PROCESSOR_CACHE_DIR_ENVVAR") = OCIO_PROCESSOR_CACHE_DIR_ENVVAR;
+    m.attr("OCIO_LAZY_CONFIG_LOADING_ENVVAR") = OCIO_LAZY_CONFIG_LOADING_ENVVAR;
 
     // Roles
     m.attr("ROLE_DEFAULT") = ROLE_DEFAULT;
@@ -10,6 +10,7 @@
 #define really_inline inline __attribute__((always_inline))
 #endif
 
+#include <cstdint>
 #include <cstdlib>
 #include <locale>
 #include <system_error>
@@ -87,8 +88,118 @@ really_inline from_chars_result from_chars(const char *first, const char *last,
     }
 }
 
+// Fast path for the plain decimal numbers (e.g. '-0.0123' or '1.5e-3') having at most 7 or 8
+// significant digits which are the vast majority of the LUT file values. The value is computed
+// with a single float operation on exact operands so it is correctly rounded i.e. it gives the
+// same result as strtof. It returns false for all the other cases (e.g. leading whitespaces, too
+// many digits, hexadecimal, inf or nan) to let strtof handle them.
+really_inline bool from_chars_fast(const char *first, const char *last, float &value,
+                                   const char *&ptr) noexcept
+{
+    static constexpr float powersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                             1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    static constexpr int maxExponent = 10;
+    static constexpr uint32_t maxMantissa = 1u << 24;
+
+    const char *p = first;
+
+    const bool negative = (p != last && *p == '-');
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        ++p;
+    }
+
+    uint32_t mantissa = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+
+    for (; p != last && *p >= '0' && *p <= '9'; ++p)
+    {
+        mantissa = mantissa * 10 + static_cast<uint32_t>(*p - '0');
+        if (mantissa > maxMantissa)
+        {
+            return false;
+        }
+        hasDigits = true;
+    }
+
+    if (p != last && *p == '.')
+    {
+        for (++p; p != last && *p >= '0' && *p <= '9'; ++p)
+        {
+            mantissa = mantissa * 10 + static_cast<uint32_t>(*p - '0');
+            if (mantissa > maxMantissa)
+            {
+                return false;
+            }
+            --exponent;
+            hasDigits = true;
+        }
+    }
+
+    if (!hasDigits)
+    {
+        return false;
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E'))
+    {
+        const char *e = p + 1;
+
+        const bool negativeExp = (e != last && *e == '-');
+        if (e != last && (*e == '-' || *e == '+'))
+        {
+            ++e;
+        }
+
+        // Like strtof, an incomplete exponent is not part of the number.
+        if (e != last && *e >= '0' && *e <= '9')
+        {
+            int exp = 0;
+            for (; e != last && *e >= '0' && *e <= '9'; ++e)
+            {
+                exp = exp * 10 + (*e - '0');
+                if (exp > 2 * maxExponent)
+                {
+                    return false;
+                }
+            }
+
+            exponent += negativeExp ? -exp : exp;
+            p = e;
+        }
+    }
+    else if (p != last && (*p == 'x' || *p == 'X'))
+    {
+        // Hexadecimal number.
+        return false;
+    }
+
+    if (exponent < -maxExponent || exponent > maxExponent)
+    {
+        return false;
+    }
+
+    float val = static_cast<float>(mantissa);
+    val = exponent < 0 ? val / powersOfTen[-exponent] : val * powersOfTen[exponent];
+
+    value = negative ? -val : val;
+    ptr = p;
+
+    return true;
+}
+
 really_inline from_chars_result from_chars(const char *first, const char *last, float &value) noexcept
 {
+    if (first && last && first != last)
+    {
+        const char *ptr = nullptr;
+        if (from_chars_fast(first, last, value, ptr))
+        {
+            return {ptr, {}};
+        }
+    }
+
     errno = 0;
     if (!first || !last || first == last)
     {
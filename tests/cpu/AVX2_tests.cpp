@@ -5,6 +5,9 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX2
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -458,4 +461,128 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+namespace
+{
+
+// Error of a value in ULPs of max(|expected|, minExpected) where the expected value is the
+// double precision libm result, i.e. the error is relative for the values larger than minExpected
+// and absolute for the smaller ones.
+double GetULPError(float actual, double expected, double minExpected)
+{
+    int exponent = 0;
+    std::frexp(std::max(std::fabs(expected), minExpected), &exponent);
+    return std::fabs(actual - expected) / std::ldexp(1.0, exponent - 24);
+}
+
+std::string GetErrorMessage(const char * fct, float x, float actual, double expected)
+{
+    std::ostringstream oss;
+    oss.precision(9);
+    oss << fct << "(" << x << ") = " << actual << " instead of " << expected;
+    return oss.str();
+}
+
+// Stride to sweep the float range using the bit representation of the values. As an odd number,
+// all the mantissa patterns are visited.
+constexpr unsigned FLOAT_SWEEP_STRIDE = 4099;
+
+float Log2(float x)
+{
+    return _mm256_cvtss_f32(OCIO::avx2Log2(_mm256_set1_ps(x)));
+}
+
+float Exp2(float x)
+{
+    return _mm256_cvtss_f32(OCIO::avx2Exp2(_mm256_set1_ps(x)));
+}
+
+float Power(float x, float exp)
+{
+    return _mm256_cvtss_f32(OCIO::avx2Power(_mm256_set1_ps(x), _mm256_set1_ps(exp)));
+}
+
+} // anon.
+
+// The fast log2, exp2 & power functions have the accuracy of the SSE2 versions used by the
+// OPTIMIZATION_FAST_LOG_EXP_POW renderers, the validation sweeps the full float range.
+
+DEFINE_SIMD_TEST(log2_ulp_test)
+{
+    // The absolute error is about 15 bits when the result is close to zero.
+    constexpr double maxULPError = 128.;
+
+    for (unsigned i = OCIO::FloatAsInt(std::numeric_limits<float>::min());
+         i < OCIO::FloatAsInt(std::numeric_limits<float>::infinity()); i += FLOAT_SWEEP_STRIDE)
+    {
+        const float x = OCIO::IntAsFloat(i);
+        const float actual = Log2(x);
+        const double expected = std::log2((double)x);
+
+        OCIO_CHECK_ASSERT_MESSAGE(GetULPError(actual, expected, 1.0) <= maxULPError,
+                                  GetErrorMessage("log2", x, actual, expected));
+    }
+}
+
+DEFINE_SIMD_TEST(exp2_ulp_test)
+{
+    constexpr double maxULPError = 50.;
+
+    // Sweep the positive, then the negative values.
+    for (const unsigned sign : { 0x00000000u, 0x80000000u })
+    {
+        for (unsigned i = 0; i < OCIO::FloatAsInt(128.0f); i += FLOAT_SWEEP_STRIDE)
+        {
+            const float x = OCIO::IntAsFloat(sign | i);
+            if (x <= -126.0f)
+            {
+                break;
+            }
+
+            const float actual = Exp2(x);
+            const double expected = std::exp2((double)x);
+
+            OCIO_CHECK_ASSERT_MESSAGE(GetULPError(actual, expected, 0.) <= maxULPError,
+                                      GetErrorMessage("exp2", x, actual, expected));
+        }
+    }
+
+    // The results outside the range of the normal floats are flushed to zero or infinity.
+    OCIO_CHECK_EQUAL(Exp2(-126.5f), 0.0f);
+    OCIO_CHECK_EQUAL(Exp2(-std::numeric_limits<float>::infinity()), 0.0f);
+    OCIO_CHECK_EQUAL(Exp2(128.0f), std::numeric_limits<float>::infinity());
+    OCIO_CHECK_EQUAL(Exp2(std::numeric_limits<float>::max()), std::numeric_limits<float>::infinity());
+}
+
+DEFINE_SIMD_TEST(power_ulp_test)
+{
+    // The error grows with the magnitude of exp * log2(x), the bound holds for the typical
+    // gamma & contrast values.
+    const double maxRelError = std::ldexp(1.0, -14);
+
+    for (const float exp : { 0.45f, 1.0f / 2.4f, 2.2f, 2.6f })
+    {
+        for (unsigned i = OCIO::FloatAsInt(std::numeric_limits<float>::min());
+             i < OCIO::FloatAsInt(std::numeric_limits<float>::infinity()); i += FLOAT_SWEEP_STRIDE)
+        {
+            const float x = OCIO::IntAsFloat(i);
+            const double expected = std::pow((double)x, (double)exp);
+            if (expected < std::numeric_limits<float>::min()
+                || expected > std::numeric_limits<float>::max())
+            {
+                continue;
+            }
+
+            const float actual = Power(x, exp);
+
+            OCIO_CHECK_ASSERT_MESSAGE(std::fabs(actual - expected) <= maxRelError * expected,
+                                      GetErrorMessage("pow", x, actual, expected));
+        }
+    }
+
+    // The negative values, zero & NaN are mapped to zero.
+    OCIO_CHECK_EQUAL(Power(-0.5f, 2.2f), 0.0f);
+    OCIO_CHECK_EQUAL(Power(0.0f, 2.2f), 0.0f);
+    OCIO_CHECK_EQUAL(Power(std::numeric_limits<float>::quiet_NaN(), 2.2f), 0.0f);
+}
+
 #endif // OCIO_USE_AVX
\ No newline at end of file
@@ -4,8 +4,12 @@
 
 #include "CPUProcessor.cpp"
 
+#include "MathUtils.h"
+#include "ops/log/LogOp.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/range/RangeOp.h"
 #include "ScanlineHelper.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
@@ -2908,3 +2912,773 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+OCIO_ADD_TEST(CPUProcessor, apply_parallel)
+{
+    // The unit test validates that the multithreaded processing gives exactly the same results
+    // than the single-threaded one, for the in place processing as well as for different input
+    // and output buffers.
+
+    constexpr long width     = 517;
+    constexpr long height    = 263;
+    constexpr long nChannels = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(value4);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    std::vector<float> inBuf(width * height * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx % 1021) / 1020.0f;
+    }
+
+    // Packed RGBA F32 processed in place.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        std::vector<float> serialBuf = inBuf;
+        OCIO::PackedImageDesc serialDesc(&serialBuf[0], width, height, nChannels);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(serialDesc));
+
+        for (unsigned numThreads : { 0U, 1U, 2U, 3U, 16U })
+        {
+            std::vector<float> parallelBuf = inBuf;
+            OCIO::PackedImageDesc parallelDesc(&parallelBuf[0], width, height, nChannels);
+            OCIO_CHECK_NO_THROW(cpuProcessor->applyParallel(parallelDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(parallelBuf == serialBuf);
+        }
+    }
+
+    // Packed RGBA F32 to planar UINT16.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                  OCIO::BIT_DEPTH_UINT16,
+                                                  OCIO::OPTIMIZATION_DEFAULT);
+
+        const OCIO::PackedImageDesc srcImgDesc(&inBuf[0], width, height, nChannels);
+
+        std::vector<std::vector<uint16_t>> serialPlanes(nChannels,
+                                                        std::vector<uint16_t>(width * height));
+        OCIO::PlanarImageDesc serialDesc(&serialPlanes[0][0], &serialPlanes[1][0],
+                                         &serialPlanes[2][0], &serialPlanes[3][0],
+                                         width, height,
+                                         OCIO::BIT_DEPTH_UINT16,
+                                         OCIO::AutoStride,
+                                         OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, serialDesc));
+
+        for (unsigned numThreads : { 0U, 1U, 2U, 3U, 16U })
+        {
+            std::vector<std::vector<uint16_t>> parallelPlanes(nChannels,
+                                                              std::vector<uint16_t>(width * height));
+            OCIO::PlanarImageDesc parallelDesc(&parallelPlanes[0][0], &parallelPlanes[1][0],
+                                               &parallelPlanes[2][0], &parallelPlanes[3][0],
+                                               width, height,
+                                               OCIO::BIT_DEPTH_UINT16,
+                                               OCIO::AutoStride,
+                                               OCIO::AutoStride);
+            OCIO_CHECK_NO_THROW(cpuProcessor->applyParallel(srcImgDesc, parallelDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(parallelPlanes == serialPlanes);
+        }
+    }
+
+    // Errors are reported to the caller.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        std::vector<float> outBuf(inBuf.size());
+        const OCIO::PackedImageDesc srcImgDesc(&inBuf[0], width, height, nChannels);
+        OCIO::PackedImageDesc dstImgDesc(&outBuf[0], width, height - 1, nChannels);
+
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->applyParallel(srcImgDesc, dstImgDesc),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, fused_ops)
+{
+    // The unit test validates that the fused processing of a chain of ops gives exactly the same
+    // results than applying each op over the complete buffer.
+
+    OCIO::OpRcPtrVec ops;
+
+    constexpr double m44[16] = { 1.1, 0.2, 0.3, 0.0,
+                                 0.1, 0.9, 0.2, 0.0,
+                                 0.0, 0.1, 1.2, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    constexpr double offset4[4] = { 0.01, 0.02, 0.03, 0.0 };
+    OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateLogOp(ops, 2.0, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, -8., 2., 0., 1., OCIO::TRANSFORM_DIR_FORWARD);
+
+    OCIO_REQUIRE_EQUAL(ops.size(), 3);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO::ConstOpCPURcPtrVec cpuOps;
+    for (const auto & op : ops)
+    {
+        cpuOps.push_back(op->getCPUOp(false));
+    }
+
+    OCIO::ConstOpCPURcPtrVec fusedOps = cpuOps;
+    OCIO::FuseCPUOps(fusedOps);
+    OCIO_REQUIRE_EQUAL(fusedOps.size(), 1);
+
+    // Use a number of pixels which is not a multiple of the block size.
+    constexpr long numPixels = 3 * OCIO::FUSED_OPS_BLOCK_SIZE + 17;
+
+    std::vector<float> inBuf(4 * numPixels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx % 257) / 128.0f;
+    }
+
+    std::vector<float> refBuf = inBuf;
+    for (const auto & cpuOp : cpuOps)
+    {
+        cpuOp->apply(&refBuf[0], &refBuf[0], numPixels);
+    }
+
+    // In place processing.
+    std::vector<float> fusedBuf = inBuf;
+    fusedOps[0]->apply(&fusedBuf[0], &fusedBuf[0], numPixels);
+    OCIO_CHECK_ASSERT(fusedBuf == refBuf);
+
+    // Different input and output buffers.
+    std::vector<float> outBuf(inBuf.size(), -1.0f);
+    fusedOps[0]->apply(&inBuf[0], &outBuf[0], numPixels);
+    OCIO_CHECK_ASSERT(outBuf == refBuf);
+
+    // One single op is left unchanged.
+    OCIO::ConstOpCPURcPtrVec singleOp{ cpuOps[0] };
+    OCIO::FuseCPUOps(singleOp);
+    OCIO_REQUIRE_EQUAL(singleOp.size(), 1);
+    OCIO_CHECK_ASSERT(singleOp[0] == cpuOps[0]);
+}
+
+OCIO_ADD_TEST(CPUProcessor, chunk_size)
+{
+    // The unit test validates that processing the image lines by chunks of pixels gives exactly
+    // the same results than processing the complete lines.
+
+    constexpr long width     = 517;
+    constexpr long height    = 7;
+    constexpr long nChannels = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(value4);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuF32 = processor->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr cpuUI16
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                              OCIO::BIT_DEPTH_UINT16,
+                                              OCIO::OPTIMIZATION_DEFAULT);
+
+    std::vector<float> inBuf(width * height * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx % 1021) / 1020.0f;
+    }
+
+    // Process the packed RGBA F32 buffer in place, and to planar UINT16 buffers.
+    auto process = [&](std::vector<float> & inPlaceBuf, std::vector<uint16_t> & planarBuf)
+    {
+        inPlaceBuf = inBuf;
+        OCIO::PackedImageDesc inPlaceDesc(&inPlaceBuf[0], width, height, nChannels);
+        OCIO_CHECK_NO_THROW(cpuF32->apply(inPlaceDesc));
+
+        planarBuf.assign(width * height * nChannels, 0);
+        const OCIO::PackedImageDesc srcDesc(&inBuf[0], width, height, nChannels);
+        OCIO::PlanarImageDesc dstDesc(&planarBuf[0],
+                                      &planarBuf[width * height],
+                                      &planarBuf[2 * width * height],
+                                      &planarBuf[3 * width * height],
+                                      width, height,
+                                      OCIO::BIT_DEPTH_UINT16,
+                                      OCIO::AutoStride,
+                                      OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpuUI16->apply(srcDesc, dstDesc));
+    };
+
+    OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), 0);
+
+    std::vector<float> refInPlaceBuf;
+    std::vector<uint16_t> refPlanarBuf;
+    OCIO::SetCPUProcessorChunkSize(width);
+    process(refInPlaceBuf, refPlanarBuf);
+
+    for (long chunkSize : { 1L, 3L, 64L, 500L, 1000L, 0L })
+    {
+        OCIO::SetCPUProcessorChunkSize(chunkSize);
+        OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), chunkSize);
+
+        if (chunkSize > 0)
+        {
+            OCIO_CHECK_EQUAL(OCIO::GetChunkSize(width), std::min(chunkSize, width));
+        }
+        else
+        {
+            OCIO_CHECK_ASSERT(OCIO::GetChunkSize(width) >= 1);
+            OCIO_CHECK_ASSERT(OCIO::GetChunkSize(width) <= width);
+        }
+
+        std::vector<float> inPlaceBuf;
+        std::vector<uint16_t> planarBuf;
+        process(inPlaceBuf, planarBuf);
+
+        OCIO_CHECK_ASSERT(inPlaceBuf == refInPlaceBuf);
+        OCIO_CHECK_ASSERT(planarBuf == refPlanarBuf);
+    }
+
+    OCIO_CHECK_THROW_WHAT(OCIO::SetCPUProcessorChunkSize(-1),
+                          OCIO::Exception,
+                          "Invalid CPU processor chunk size.");
+    OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), 0);
+}
+
+OCIO_ADD_TEST(CPUProcessor, planar_processing)
+{
+    // The unit test validates that the planar F32 images processed without any packing give
+    // exactly the same results than the packed images.
+
+    constexpr long width  = 67;
+    constexpr long height = 5;
+    constexpr long numPixels = width * height;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 1.1, 0.2, 0.3, 0.1,
+                                 0.1, 0.9, 0.2, 0.0,
+                                 0.0, 0.1, 1.2, 0.0,
+                                 0.2, 0.0, 0.0, 0.9 };
+    constexpr double offset4[4] = { 0.01, -0.02, 0.03, 0.05 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.);
+    range->setMaxInValue(1.);
+    range->setMinOutValue(0.1);
+    range->setMaxOutValue(0.9);
+    group->appendTransform(range);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = processor->getDefaultCPUProcessor());
+
+    std::vector<float> inBuf(numPixels * 4);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx % 211) / 150.0f - 0.2f;
+    }
+
+    // Split a packed RGBA buffer in four planes.
+    auto toPlanar = [](const std::vector<float> & packed)
+    {
+        std::vector<float> planar(packed.size());
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                planar[c * numPixels + idx] = packed[4 * idx + c];
+            }
+        }
+        return planar;
+    };
+
+    auto checkProcessor = [&](const OCIO::ConstCPUProcessorRcPtr & cpuProc)
+    {
+        // Reference packed results.
+        std::vector<float> refRGBA = inBuf;
+        OCIO::PackedImageDesc refRGBADesc(&refRGBA[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProc->apply(refRGBADesc));
+
+        std::vector<float> refRGB(numPixels * 3);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long c = 0; c < 3; ++c)
+            {
+                refRGB[3 * idx + c] = inBuf[4 * idx + c];
+            }
+        }
+        OCIO::PackedImageDesc refRGBDesc(&refRGB[0], width, height, 3);
+        OCIO_CHECK_NO_THROW(cpuProc->apply(refRGBDesc));
+
+        const std::vector<float> inPlanar  = toPlanar(inBuf);
+        const std::vector<float> refPlanar = toPlanar(refRGBA);
+
+        // In place processing, with alpha.
+        {
+            std::vector<float> buf = inPlanar;
+            OCIO::PlanarImageDesc desc(&buf[0], &buf[numPixels],
+                                       &buf[2 * numPixels], &buf[3 * numPixels],
+                                       width, height);
+            OCIO_CHECK_NO_THROW(cpuProc->apply(desc));
+            OCIO_CHECK_ASSERT(buf == refPlanar);
+        }
+
+        // Different source and destination images, with alpha.
+        {
+            std::vector<float> src = inPlanar;
+            std::vector<float> dst(src.size(), -1.0f);
+            OCIO::PlanarImageDesc srcDesc(&src[0], &src[numPixels],
+                                          &src[2 * numPixels], &src[3 * numPixels],
+                                          width, height);
+            OCIO::PlanarImageDesc dstDesc(&dst[0], &dst[numPixels],
+                                          &dst[2 * numPixels], &dst[3 * numPixels],
+                                          width, height);
+            OCIO_CHECK_NO_THROW(cpuProc->apply(srcDesc, dstDesc));
+            OCIO_CHECK_ASSERT(dst == refPlanar);
+            OCIO_CHECK_ASSERT(src == inPlanar);
+
+            dst.assign(src.size(), -1.0f);
+            OCIO_CHECK_NO_THROW(cpuProc->applyParallel(srcDesc, dstDesc, 3));
+            OCIO_CHECK_ASSERT(dst == refPlanar);
+        }
+
+        // In place processing, without alpha.
+        {
+            std::vector<float> buf(inPlanar.begin(), inPlanar.begin() + 3 * numPixels);
+            OCIO::PlanarImageDesc desc(&buf[0], &buf[numPixels], &buf[2 * numPixels], nullptr,
+                                       width, height);
+            OCIO_CHECK_NO_THROW(cpuProc->applyParallel(desc, 2));
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                for (long c = 0; c < 3; ++c)
+                {
+                    OCIO_CHECK_EQUAL(buf[c * numPixels + idx], refRGB[3 * idx + c]);
+                }
+            }
+        }
+    };
+
+    // Matrix & Range ops are processed without any packing.
+    checkProcessor(cpu);
+    OCIO::ConstCPUProcessorRcPtr planarCpu = cpu;
+
+    // The exponent op (i.e. a gamma op) is also processed without any packing.
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(value4);
+    group->appendTransform(exponent);
+
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+    OCIO_CHECK_NO_THROW(cpu = processor->getDefaultCPUProcessor());
+    checkProcessor(cpu);
+
+    // The 3D LUT op does not support the planar processing so it processes packed blocks of
+    // pixels between the planar ops.
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(2);
+    for (unsigned long r = 0; r < 2; ++r)
+    {
+        for (unsigned long g = 0; g < 2; ++g)
+        {
+            for (unsigned long b = 0; b < 2; ++b)
+            {
+                lut->setValue(r, g, b, 0.9f * r + 0.05f, 0.8f * g + 0.1f * b, 0.7f * b + 0.2f * r);
+            }
+        }
+    }
+    group->appendTransform(lut);
+    group->appendTransform(range);
+
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+    OCIO_CHECK_NO_THROW(cpu = processor->getDefaultCPUProcessor());
+    checkProcessor(cpu);
+
+    // Mismatching image dimensions are still detected.
+    std::vector<float> src(numPixels * 4), dst(numPixels * 4);
+    OCIO::PlanarImageDesc srcDesc(&src[0], &src[numPixels], &src[2 * numPixels],
+                                  &src[3 * numPixels], width, height);
+    OCIO::PlanarImageDesc dstDesc(&dst[0], &dst[numPixels], &dst[2 * numPixels],
+                                  &dst[3 * numPixels], width - 1, height);
+    OCIO_CHECK_THROW_WHAT(planarCpu->apply(srcDesc, dstDesc),
+                          OCIO::Exception,
+                          "Dimension inconsistency between source and destination image buffers.");
+}
+
+namespace
+{
+
+void ValidateHalfFloatCasts(BitDepthCastApplyFunc * halfToFloat,
+                            BitDepthCastApplyFunc * floatToHalf,
+                            unsigned line)
+{
+    OCIO_REQUIRE_ASSERT(halfToFloat);
+    OCIO_REQUIRE_ASSERT(floatToHalf);
+
+    // All the half values, plus a few pixels to exercise the leftover pixels.
+    constexpr long numPixels = 65536 / 4 + 3;
+
+    std::vector<half> halfs(numPixels * 4);
+    for (size_t idx = 0; idx < halfs.size(); ++idx)
+    {
+        halfs[idx].setBits(uint16_t(idx % 65536));
+    }
+
+    std::vector<float> floats(numPixels * 4, -1.0f);
+    halfToFloat(&halfs[0], &floats[0], numPixels);
+
+    for (size_t idx = 0; idx < halfs.size(); ++idx)
+    {
+        const float ref = float(halfs[idx]);
+        if (OCIO::IsNan(ref))
+        {
+            OCIO_CHECK_ASSERT_FROM(OCIO::IsNan(floats[idx]), line);
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL_FROM(floats[idx], ref, line);
+        }
+    }
+
+    // Sweep the float values, including the ones outside of the half range and the
+    // ones needing rounding.
+    std::vector<float> values;
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += 4099)
+    {
+        values.push_back(OCIO::IntAsFloat(uint32_t(bits)));
+    }
+    values.resize((values.size() / 4 + 1) * 4, 0.5f);
+
+    const long numValuePixels = long(values.size() / 4);
+    std::vector<half> res(values.size());
+    floatToHalf(&values[0], &res[0], numValuePixels);
+
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        const half ref(values[idx]);
+        if (ref.isNan())
+        {
+            OCIO_CHECK_ASSERT_FROM(res[idx].isNan(), line);
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL_FROM(res[idx].bits(), ref.bits(), line);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, avx_half_casts)
+{
+#if OCIO_USE_AVX && OCIO_USE_F16C
+    if (!OCIO::CPUInfo::instance().hasAVX() || !OCIO::CPUInfo::instance().hasF16C())
+    {
+        throw SkipException();
+    }
+
+    OCIO_CHECK_ASSERT(!OCIO::AVXGetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_UINT8,
+                                                         OCIO::BIT_DEPTH_F32));
+
+    ValidateHalfFloatCasts(OCIO::AVXGetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_F16,
+                                                             OCIO::BIT_DEPTH_F32),
+                           OCIO::AVXGetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_F32,
+                                                             OCIO::BIT_DEPTH_F16),
+                           __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(CPUProcessor, avx512_half_casts)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    OCIO_CHECK_ASSERT(!OCIO::AVX512GetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_F16,
+                                                            OCIO::BIT_DEPTH_F16));
+
+    ValidateHalfFloatCasts(OCIO::AVX512GetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_F16,
+                                                                OCIO::BIT_DEPTH_F32),
+                           OCIO::AVX512GetBitDepthCastApplyFunc(OCIO::BIT_DEPTH_F32,
+                                                                OCIO::BIT_DEPTH_F16),
+                           __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(CPUProcessor, statistics)
+{
+    constexpr long width     = 301;
+    constexpr long height    = 97;
+    constexpr long nChannels = 4;
+    constexpr long numPixels = width * height;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double value4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(value4);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                                  OCIO::BIT_DEPTH_UINT16,
+                                                                  OCIO::OPTIMIZATION_NONE));
+
+    // Disabled by default but the steps are already known.
+
+    OCIO_CHECK_ASSERT(!cpu->isStatisticsEnabled());
+
+    OCIO_REQUIRE_EQUAL(cpu->getNumStatistics(), 4);
+    OCIO_CHECK_EQUAL(cpu->getStatisticsName(0), std::string("Pack from 8ui"));
+    OCIO_CHECK_EQUAL(cpu->getStatisticsName(1), std::string("<MatrixOffsetOp>"));
+    OCIO_CHECK_EQUAL(cpu->getStatisticsName(2), std::string("<GammaOp>"));
+    OCIO_CHECK_EQUAL(cpu->getStatisticsName(3), std::string("Unpack to 16ui"));
+
+    OCIO_CHECK_THROW_WHAT(cpu->getStatisticsName(4), OCIO::Exception,
+                          "CPUProcessor statistics index 4 is invalid, there are 4 processing "
+                          "steps.");
+    OCIO_CHECK_THROW_WHAT(cpu->getStatisticsSeconds(-1), OCIO::Exception,
+                          "CPUProcessor statistics index -1 is invalid");
+
+    std::vector<uint8_t> inBuf(numPixels * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = uint8_t(idx % 251);
+    }
+
+    OCIO::PackedImageDesc inDesc(&inBuf[0], width, height, nChannels, OCIO::BIT_DEPTH_UINT8,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+    std::vector<uint16_t> refBuf(numPixels * nChannels);
+    OCIO::PackedImageDesc refDesc(&refBuf[0], width, height, nChannels, OCIO::BIT_DEPTH_UINT16,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(inDesc, refDesc));
+
+    for (int idx = 0; idx < cpu->getNumStatistics(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumCalls(idx), 0);
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumPixels(idx), 0);
+    }
+
+    // Enabling the statistics does not change the results.
+
+    cpu->setStatisticsEnabled(true);
+    OCIO_CHECK_ASSERT(cpu->isStatisticsEnabled());
+
+    std::vector<uint16_t> outBuf(numPixels * nChannels);
+    OCIO::PackedImageDesc outDesc(&outBuf[0], width, height, nChannels, OCIO::BIT_DEPTH_UINT16,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+    OCIO_CHECK_ASSERT(outBuf == refBuf);
+
+    OCIO_REQUIRE_EQUAL(cpu->getNumStatistics(), 4);
+    for (int idx = 0; idx < cpu->getNumStatistics(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumPixels(idx), numPixels);
+        OCIO_CHECK_ASSERT(cpu->getStatisticsNumCalls(idx) >= height);
+        OCIO_CHECK_ASSERT(cpu->getStatisticsSeconds(idx) >= 0.);
+    }
+
+    // The statistics of all the threads are accumulated.
+
+    std::fill(outBuf.begin(), outBuf.end(), uint16_t(0));
+    OCIO_CHECK_NO_THROW(cpu->applyParallel(inDesc, outDesc, 4));
+    OCIO_CHECK_ASSERT(outBuf == refBuf);
+
+    for (int idx = 0; idx < cpu->getNumStatistics(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumPixels(idx), 2 * numPixels);
+    }
+
+    const std::string json = cpu->getStatisticsAsJSON();
+    OCIO_CHECK_EQUAL(json.front(), '[');
+    OCIO_CHECK_EQUAL(json.back(), ']');
+    OCIO_CHECK_NE(json.find("\"name\": \"Pack from 8ui\""), std::string::npos);
+    OCIO_CHECK_NE(json.find("\"pixels\": " + std::to_string(2 * numPixels)), std::string::npos);
+
+    cpu->resetStatistics();
+    for (int idx = 0; idx < cpu->getNumStatistics(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumCalls(idx), 0);
+        OCIO_CHECK_EQUAL(cpu->getStatisticsNumPixels(idx), 0);
+        OCIO_CHECK_EQUAL(cpu->getStatisticsSeconds(idx), 0.);
+    }
+
+    // Disabling the statistics stops the recording.
+
+    cpu->setStatisticsEnabled(false);
+    OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+    OCIO_CHECK_ASSERT(outBuf == refBuf);
+    OCIO_CHECK_EQUAL(cpu->getStatisticsNumPixels(0), 0);
+
+    // Planar F32 images are processed without packing, the input & output bit-depth ops are then
+    // the packing & unpacking steps.
+
+    OCIO::ConstProcessorRcPtr matrixProcessor;
+    OCIO_CHECK_NO_THROW(matrixProcessor = config->getProcessor(matrix));
+
+    OCIO::ConstCPUProcessorRcPtr planarCpu;
+    OCIO_CHECK_NO_THROW(planarCpu
+        = matrixProcessor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_NONE));
+    planarCpu->setStatisticsEnabled(true);
+
+    std::vector<float> planes(numPixels * 4, 0.5f);
+    OCIO::PlanarImageDesc planarDesc(&planes[0], &planes[numPixels], &planes[2 * numPixels],
+                                     &planes[3 * numPixels], width, height);
+    OCIO_CHECK_NO_THROW(planarCpu->apply(planarDesc));
+
+    OCIO_REQUIRE_EQUAL(planarCpu->getNumStatistics(), 2);
+    OCIO_CHECK_EQUAL(planarCpu->getStatisticsName(0), std::string("Pack from 32f"));
+    OCIO_CHECK_EQUAL(planarCpu->getStatisticsNumPixels(0), numPixels);
+    OCIO_CHECK_EQUAL(planarCpu->getStatisticsName(1), std::string("Unpack to 32f"));
+    OCIO_CHECK_EQUAL(planarCpu->getStatisticsNumPixels(1), numPixels);
+
+    planarCpu->setStatisticsEnabled(false);
+
+    // The env. variable enables the statistics of the new CPU processors.
+
+    OCIO::SetEnvVariable(OCIO::OCIO_CPU_STATISTICS_ENVVAR, "1");
+
+    OCIO::ConstCPUProcessorRcPtr envCpu;
+    OCIO_CHECK_NO_THROW(envCpu = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                                     OCIO::BIT_DEPTH_UINT16,
+                                                                     OCIO::OPTIMIZATION_NONE));
+    OCIO::UnsetEnvVariable(OCIO::OCIO_CPU_STATISTICS_ENVVAR);
+
+    OCIO_CHECK_ASSERT(envCpu->isStatisticsEnabled());
+}
+
+OCIO_ADD_TEST(CPUProcessor, compact_lut_storage)
+{
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(33);
+    lut->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    for (unsigned long r = 0; r < 33; ++r)
+    {
+        for (unsigned long g = 0; g < 33; ++g)
+        {
+            for (unsigned long b = 0; b < 33; ++b)
+            {
+                lut->setValue(r, g, b, std::pow(r / 32.f, 1.5f),
+                                       std::pow(g / 32.f, 1.5f),
+                                       std::pow(b / 32.f, 1.5f));
+            }
+        }
+    }
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(lut);
+
+    // The compact storage is not part of OPTIMIZATION_ALL.
+    OCIO::ConstCPUProcessorRcPtr ref
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                              OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_ALL);
+    OCIO_CHECK_EQUAL(ref->getCompactLutMaxError(), 0.f);
+
+    OCIO::ConstCPUProcessorRcPtr compact
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                              OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_LUT_COMPACT_STORAGE);
+
+    // All the LUT values are in [0, 1] so they are stored as normalized integers.
+    const float maxError = compact->getCompactLutMaxError();
+    OCIO_CHECK_ASSERT(maxError > 0.f);
+    OCIO_CHECK_ASSERT(maxError <= 0.5f / 65535.f);
+
+    constexpr long numPixels = 1000;
+    std::vector<float> pixels(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = float(idx % 10) / 9.f;
+        pixels[4 * idx + 1] = float((idx / 10) % 10) / 9.f;
+        pixels[4 * idx + 2] = float(idx / 100) / 9.f;
+        pixels[4 * idx + 3] = 1.f;
+    }
+    std::vector<float> refPixels(pixels);
+
+    OCIO::PackedImageDesc desc(&pixels[0], numPixels, 1, 4);
+    OCIO_CHECK_NO_THROW(compact->apply(desc));
+    OCIO::PackedImageDesc refDesc(&refPixels[0], numPixels, 1, 4);
+    OCIO_CHECK_NO_THROW(ref->apply(refDesc));
+
+    for (size_t idx = 0; idx < pixels.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(pixels[idx], refPixels[idx], maxError + 1e-6f);
+    }
+
+    // The CPU ops do not keep a reference to the LUT so its float array is released with the
+    // ops (i.e. with the processor).
+
+    OCIO::OpRcPtrVec ops;
+    {
+        OCIO::Lut3DOpDataRcPtr lutData
+            = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 33);
+        OCIO::CreateLut3DOp(ops, lutData, OCIO::TRANSFORM_DIR_FORWARD);
+    }
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    std::weak_ptr<const OCIO::OpData> lutData
+        = std::const_pointer_cast<const OCIO::Op>(ops[0])->data();
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp, outBitDepthOp;
+    OCIO::ConstOpCPURcPtrVec cpuOps;
+    std::vector<std::string> cpuOpNames;
+    float engineMaxError = -1.f;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_LUT_COMPACT_STORAGE,
+                                              inBitDepthOp, cpuOps, outBitDepthOp, cpuOpNames,
+                                              engineMaxError));
+    OCIO_CHECK_ASSERT(engineMaxError >= 0.f);
+
+    ops.clear();
+    OCIO_CHECK_ASSERT(lutData.expired());
+    OCIO_REQUIRE_ASSERT(inBitDepthOp);
+}
@@ -2,6 +2,11 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
@@ -56,13 +61,17 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO_CHECK_ASSERT(cache.isEnabled());
 
         {
-            OCIO::AutoMutex m(cache.lock());
-
             DataRcPtr entry1 = std::make_shared<Data>();
-            cache["entry1"] = entry1;
+            OCIO_CHECK_EQUAL(cache.findOrInsert("entry1", [entry1]() { return entry1; }), entry1);
 
             OCIO_CHECK_ASSERT(cache.exists("entry1"));
-            OCIO_CHECK_EQUAL(cache["entry1"], entry1);
+
+            DataRcPtr entry;
+            OCIO_CHECK_ASSERT(cache.find("entry1", entry));
+            OCIO_CHECK_EQUAL(entry, entry1);
+
+            // The existing entry is returned.
+            OCIO_CHECK_EQUAL(cache.findOrInsert("entry1", []() { return DataRcPtr(); }), entry1);
         }
 
         // Some faulty checks.
@@ -81,11 +90,9 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO::GenericCache<std::string, DataRcPtr> cache;
         OCIO_CHECK_ASSERT(!cache.isEnabled());
 
-        // The lock control is useless here but useful as a good example to copy & paste.
-        OCIO::AutoMutex m(cache.lock());
-
+        // The new entry is still returned but not cached.
         DataRcPtr entry1 = std::make_shared<Data>();
-        cache["entry1"] = entry1;
+        OCIO_CHECK_EQUAL(cache.findOrInsert("entry1", [entry1]() { return entry1; }), entry1);
 
         OCIO_CHECK_ASSERT(!cache.exists("entry1"));
     }
@@ -97,11 +104,8 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO::GenericCache<std::string, DataRcPtr> cache;
         OCIO_CHECK_ASSERT(cache.isEnabled());
 
-        // The lock control is useless here but useful as a good example to copy & paste.
-        OCIO::AutoMutex m(cache.lock());
-
         DataRcPtr entry1 = std::make_shared<Data>();
-        cache["entry1"] = entry1;
+        cache.findOrInsert("entry1", [entry1]() { return entry1; });
 
         OCIO_CHECK_ASSERT(cache.exists("entry1"));
     }
@@ -122,7 +126,7 @@ OCIO_ADD_TEST(Caching, processor_cache)
         OCIO_CHECK_ASSERT(cache.isEnabled());
 
         DataRcPtr entry1 = std::make_shared<Data>();
-        cache["entry1"] = entry1;
+        cache.findOrInsert("entry1", [entry1]() { return entry1; });
 
         cache.enable(false);
 
@@ -244,4 +248,364 @@ OCIO_ADD_TEST(Caching, processor_cache)
             OCIO_CHECK_EQUAL(procA, procB); 
         }
     }
-}
\ No newline at end of file
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_limits)
+{
+    // A unit test to check the least recently used eviction of the GenericCache class.
+
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+    OCIO_CHECK_EQUAL(cache.getMaxEntries(), 0);
+    OCIO_CHECK_EQUAL(cache.getMaxMemorySize(), 0);
+
+    std::vector<std::string> evicted;
+    cache.setEvictionCallback([&evicted](const std::string & key, const DataRcPtr & entry)
+    {
+        OCIO_CHECK_ASSERT(entry);
+        evicted.push_back(key);
+    });
+
+    auto addEntry = [&cache](const std::string & key, size_t memorySize)
+    {
+        cache.findOrInsert(key, []() { return std::make_shared<Data>(); });
+        cache.setEntryMemorySize(key, memorySize);
+    };
+
+    // By default, the cache is unbounded.
+    for (int idx = 0; idx < 10; ++idx)
+    {
+        addEntry("entry" + std::to_string(idx), 100);
+    }
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 10);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 0);
+    OCIO_CHECK_ASSERT(evicted.empty());
+
+    // Bounding the cache evicts the extra entries.
+    cache.setLimits(4, 0);
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 4);
+    OCIO_CHECK_EQUAL(evicted.size(), 6);
+    evicted.clear();
+
+    cache.clear();
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 0);
+    OCIO_CHECK_ASSERT(evicted.empty());
+
+    // Check the least recently used eviction with a maximum number of entries.
+    addEntry("entry1", 100);
+    addEntry("entry2", 100);
+    addEntry("entry3", 100);
+    addEntry("entry4", 100);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 400);
+
+    {
+        // Accessing an entry makes it the most recently used one.
+        DataRcPtr entry;
+        OCIO_CHECK_ASSERT(cache.find("entry1", entry));
+        OCIO_CHECK_ASSERT(entry);
+    }
+
+    addEntry("entry5", 100);
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 4);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 400);
+    OCIO_REQUIRE_EQUAL(evicted.size(), 1);
+    OCIO_CHECK_EQUAL(evicted[0], "entry2");
+    OCIO_CHECK_ASSERT(cache.exists("entry1"));
+    OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+    evicted.clear();
+
+    // Check the eviction with a memory budget.
+    cache.setLimits(0, 500);
+    OCIO_CHECK_ASSERT(evicted.empty());
+
+    addEntry("entry6", 250);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 450);
+    OCIO_REQUIRE_EQUAL(evicted.size(), 2);
+    OCIO_CHECK_EQUAL(evicted[0], "entry3");
+    OCIO_CHECK_EQUAL(evicted[1], "entry4");
+    evicted.clear();
+
+    // An entry larger than the budget is kept but evicts all the other ones.
+    addEntry("entry7", 1000);
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 1);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 1000);
+    OCIO_CHECK_EQUAL(evicted.size(), 3);
+    OCIO_CHECK_ASSERT(cache.exists("entry7"));
+    evicted.clear();
+
+    // Removing the limits restores the unbounded behavior.
+    cache.setLimits(0, 0);
+    for (int idx = 0; idx < 10; ++idx)
+    {
+        addEntry("entry" + std::to_string(idx), 1000);
+    }
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 10);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 0);
+    OCIO_CHECK_ASSERT(evicted.empty());
+
+    // No eviction when the cache is disabled.
+    cache.setLimits(2, 0);
+    evicted.clear();
+    cache.enable(false);
+    addEntry("entry100", 100);
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 2);
+    OCIO_CHECK_ASSERT(evicted.empty());
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_concurrency)
+{
+    // A unit test to check the concurrent accesses to the GenericCache class.
+
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+    cache.setLimits(48, 0);
+
+    constexpr int numThreads = 8;
+    constexpr int numKeys    = 64;
+
+    std::atomic<int> numCreations{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&cache, &numCreations, t]()
+        {
+            for (int iter = 0; iter < 1000; ++iter)
+            {
+                const std::string key = "entry" + std::to_string((iter * 7 + t) % numKeys);
+
+                DataRcPtr entry = cache.findOrInsert(key, [&numCreations]()
+                {
+                    ++numCreations;
+                    return std::make_shared<Data>();
+                });
+
+                OCIO_CHECK_ASSERT(entry);
+                cache.setEntryMemorySize(key, 10);
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 48);
+    OCIO_CHECK_EQUAL(cache.getMemorySize(), 480);
+    OCIO_CHECK_ASSERT(numCreations >= numKeys);
+
+    size_t numVisited = 0;
+    cache.forEach([&numVisited](const std::string &, const DataRcPtr & entry)
+    {
+        OCIO_CHECK_ASSERT(entry);
+        ++numVisited;
+    });
+    OCIO_CHECK_EQUAL(numVisited, 48);
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_creation_without_lock)
+{
+    // The entries are created without holding the lock of their shard.
+
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+    // The creation of an entry could request other entries, some of them in the same shard.
+    constexpr int numKeys = 64;
+    for (int idx = 0; idx < numKeys; ++idx)
+    {
+        const std::string key = "outer" + std::to_string(idx);
+
+        DataRcPtr entry = cache.findOrInsert(key, [&cache, &key, idx]()
+        {
+            // The entry being created does not exist yet.
+            OCIO_CHECK_ASSERT(!cache.exists(key));
+
+            return cache.findOrInsert("inner" + std::to_string(idx),
+                                      []() { return std::make_shared<Data>(); });
+        });
+
+        OCIO_CHECK_ASSERT(entry);
+        OCIO_CHECK_ASSERT(cache.exists(key));
+    }
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 2 * numKeys);
+
+    // The concurrent requests of an entry being created wait for it, while the other entries
+    // remain available.
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::atomic<int> numCreations{ 0 };
+    auto createSlow = [&numCreations, released]()
+    {
+        ++numCreations;
+        released.wait();
+        return std::make_shared<Data>();
+    };
+
+    constexpr int numThreads = 4;
+    std::vector<DataRcPtr> entries(numThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&cache, &entries, &createSlow, t]()
+        {
+            entries[t] = cache.findOrInsert("slow", createSlow);
+        });
+    }
+
+    for (int idx = 0; idx < numKeys; ++idx)
+    {
+        DataRcPtr entry;
+        OCIO_CHECK_ASSERT(cache.find("inner" + std::to_string(idx), entry));
+    }
+    OCIO_CHECK_ASSERT(!cache.exists("slow"));
+
+    release.set_value();
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(numCreations, 1);
+    OCIO_CHECK_ASSERT(entries[0]);
+    for (const auto & entry : entries)
+    {
+        OCIO_CHECK_EQUAL(entry, entries[0]);
+    }
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 2 * numKeys + 1);
+
+    // A failed creation does not leave any entry.
+
+    OCIO_CHECK_THROW_WHAT(cache.findOrInsert("failed", []() -> DataRcPtr
+                                             {
+                                                 throw OCIO::Exception("Creation failure.");
+                                             }),
+                          OCIO::Exception,
+                          "Creation failure.");
+    OCIO_CHECK_ASSERT(!cache.exists("failed"));
+    OCIO_CHECK_EQUAL(cache.getNumEntries(), 2 * numKeys + 1);
+
+    DataRcPtr entry = cache.findOrInsert("failed", []() { return std::make_shared<Data>(); });
+    OCIO_CHECK_ASSERT(entry);
+    OCIO_CHECK_ASSERT(cache.exists("failed"));
+}
+
+OCIO_ADD_TEST(Caching, processor_cache_limits)
+{
+    // A unit test to check the limits of the config processor cache.
+
+    // The cache fallback reuses the processors which are still in use even if evicted.
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_DISABLE_CACHE_FALLBACK, "1");
+
+    OCIO::ConfigRcPtr cfg = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    // Note that the 'raw' color space is a data one i.e. all its processors are no-ops, and are
+    // then shared by the cache fallback.
+    OCIO::ColorSpaceRcPtr cs1 = OCIO::ColorSpace::Create();
+    cs1->setName("cs1");
+    cfg->addColorSpace(cs1);
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("cs2");
+    OCIO::MatrixTransformRcPtr mat = OCIO::MatrixTransform::Create();
+    const double offset[4] = { 0.1, 0.2, 0.3, 0. };
+    mat->setOffset(offset);
+    cs->setTransform(mat, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    cfg->addColorSpace(cs);
+
+    OCIO::ConstProcessorRcPtr procA = cfg->getProcessor("cs1", "cs2");
+    OCIO::ConstProcessorRcPtr procB = cfg->getProcessor("cs2", "cs1");
+    OCIO_CHECK_EQUAL(procA, cfg->getProcessor("cs1", "cs2"));
+    OCIO_CHECK_EQUAL(procB, cfg->getProcessor("cs2", "cs1"));
+
+    // Only keep the most recently used processor.
+    cfg->setProcessorCacheLimits(1, 0);
+    procA = cfg->getProcessor("cs1", "cs2");
+    OCIO_CHECK_EQUAL(procA, cfg->getProcessor("cs1", "cs2"));
+
+    procB = cfg->getProcessor("cs2", "cs1");
+    OCIO_CHECK_EQUAL(procB, cfg->getProcessor("cs2", "cs1"));
+    OCIO_CHECK_NE(procA, cfg->getProcessor("cs1", "cs2"));
+    OCIO_CHECK_NE(procB, cfg->getProcessor("cs2", "cs1"));
+
+    // The limits are part of the config copies.
+    OCIO::ConfigRcPtr cfg2 = cfg->createEditableCopy();
+    OCIO::ConstProcessorRcPtr procC = cfg2->getProcessor("cs1", "cs2");
+    OCIO_CHECK_EQUAL(procC, cfg2->getProcessor("cs1", "cs2"));
+    cfg2->getProcessor("cs2", "cs1");
+    OCIO_CHECK_NE(procC, cfg2->getProcessor("cs1", "cs2"));
+
+    // No more limits.
+    cfg->setProcessorCacheLimits(0, 0);
+    procA = cfg->getProcessor("cs1", "cs2");
+    procB = cfg->getProcessor("cs2", "cs1");
+    OCIO_CHECK_EQUAL(procA, cfg->getProcessor("cs1", "cs2"));
+    OCIO_CHECK_EQUAL(procB, cfg->getProcessor("cs2", "cs1"));
+}
+
+OCIO_ADD_TEST(Caching, processor_cache_concurrency)
+{
+    // A unit test to check the concurrent processor requests to the config processor cache.
+
+    OCIO::ConfigRcPtr cfg = OCIO::Config::CreateRaw()->createEditableCopy();
+    cfg->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    OCIO::ColorSpaceRcPtr cs1 = OCIO::ColorSpace::Create();
+    cs1->setName("cs1");
+    cfg->addColorSpace(cs1);
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("cs2");
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("$LUT");
+    cs->setTransform(file, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    cfg->addColorSpace(cs);
+
+    OCIO::ContextRcPtr context = cfg->getCurrentContext()->createEditableCopy();
+    context->setStringVar("LUT", "lut1d_green.ctf");
+
+    // All the concurrent requests get the same processor instance.
+
+    constexpr int numThreads = 8;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(numThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&cfg, &context, &processors, t]()
+        {
+            processors[t] = cfg->getProcessor(context, "cs1", "cs2");
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_REQUIRE_ASSERT(processors[0]);
+    for (const auto & processor : processors)
+    {
+        OCIO_CHECK_EQUAL(processor, processors[0]);
+    }
+
+    // A different request creating an identical processor reuses the existing one.
+
+    OCIO::ContextRcPtr context2 = context->createEditableCopy();
+    context2->setStringVar("LUT", "./lut1d_green.ctf");
+
+    OCIO_CHECK_EQUAL(cfg->getProcessor(context2, "cs1", "cs2"), processors[0]);
+
+    // Even if the existing one was evicted from the cache but is still in use.
+
+    cfg->setProcessorCacheLimits(1, 0);
+    OCIO_CHECK_ASSERT(cfg->getProcessor("raw", "raw"));
+
+    OCIO::ContextRcPtr context3 = context->createEditableCopy();
+    context3->setStringVar("LUT", "././lut1d_green.ctf");
+
+    OCIO_CHECK_EQUAL(cfg->getProcessor(context3, "cs1", "cs2"), processors[0]);
+
+    // But not once the cache is cleared.
+
+    cfg->clearProcessorCache();
+    OCIO_CHECK_NE(cfg->getProcessor(context, "cs1", "cs2"), processors[0]);
+}
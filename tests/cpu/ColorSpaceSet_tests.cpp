@@ -314,3 +314,69 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_and_alias_lookup)
+{
+    // The lookups use an index which must follow the set changes.
+
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    OCIO::ColorSpaceRcPtr cs1 = OCIO::ColorSpace::Create();
+    cs1->setName("cs1");
+    cs1->addAlias("alias1");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs1));
+
+    OCIO::ColorSpaceRcPtr cs2 = OCIO::ColorSpace::Create();
+    cs2->setName("cs2");
+    cs2->addAlias("alias2");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs2));
+
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("CS1"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Alias1"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs2"), 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("ALIAS2"), 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("unknown"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(""), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(nullptr), -1);
+
+    // Replace a color space with different aliases.
+
+    cs1->removeAlias("alias1");
+    cs1->addAlias("alias3");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs1));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 2);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias1"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias3"), 0);
+
+    // The alias is now available.
+    OCIO::ColorSpaceRcPtr cs3 = OCIO::ColorSpace::Create();
+    cs3->setName("alias1");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs3));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias1"), 2);
+
+    OCIO::ColorSpaceRcPtr cs4 = OCIO::ColorSpace::Create();
+    cs4->setName("cs4");
+    cs4->addAlias("ALIAS3");
+    OCIO_CHECK_THROW_WHAT(css->addColorSpace(cs4), OCIO::Exception,
+                          "existing color space, 'cs1' is using the same alias");
+
+    // Remove a color space i.e. the next ones move.
+
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("cs1"));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs1"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias3"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias1"), 1);
+
+    // Copy.
+
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias2"), 0);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias1"), 1);
+
+    // Clear.
+
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias2"), 0);
+}
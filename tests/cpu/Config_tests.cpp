@@ -7529,6 +7529,125 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, warm_up_processors)
+{
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+    - !<View> {name: View2, colorspace: cs2}
+  Disp2:
+    - !<View> {name: View1, colorspace: cs2}
+
+looks:
+  - !<Look>
+    name: look1
+    process_space: ref
+    transform: !<ExponentTransform> {value: 1.1}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<BuiltinTransform> {style: ACEScct_to_ACES2065-1}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<ExponentTransform> {value: 2.2}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+    OCIO_CHECK_NO_THROW(config->validate());
+
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    // Warm up all the (display, view) pairs of a color space.
+
+    size_t numCalls = 0;
+    size_t lastTotal = 0;
+    auto callback = [&numCalls, &lastTotal](size_t numDone, size_t numTotal)
+    {
+        ++numCalls;
+        lastTotal = numTotal;
+        return numDone <= numTotal;
+    };
+
+    size_t numBuilt = 0;
+    OCIO_CHECK_NO_THROW(numBuilt = config->warmUpProcessors(context, "ref", callback));
+    OCIO_CHECK_EQUAL(numBuilt, 3);
+    OCIO_CHECK_EQUAL(numCalls, 3);
+    OCIO_CHECK_EQUAL(lastTotal, 3);
+
+    // The warmed up processors are the ones returned by getProcessor().
+    OCIO::ConstProcessorRcPtr proc
+        = config->getProcessor("ref", "Disp1", "View2", OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(proc.get(),
+                     config->getProcessor("ref", "Disp2", "View1",
+                                          OCIO::TRANSFORM_DIR_FORWARD).get());
+
+    // Warm up a list of processors, including looks and a faulty one.
+
+    OCIO::DisplayViewProcessorDescVec processors(3);
+    processors[0].m_srcColorSpace = "cs1";
+    processors[0].m_display       = "Disp1";
+    processors[0].m_view          = "View1";
+
+    processors[1].m_srcColorSpace = "cs1";
+    processors[1].m_display       = "Disp1";
+    processors[1].m_view          = "View2";
+    processors[1].m_looks         = "look1";
+
+    processors[2].m_srcColorSpace = "cs1";
+    processors[2].m_display       = "Disp1";
+    processors[2].m_view          = "Unknown";
+
+    {
+        OCIO::LogGuard logGuard;
+        OCIO_CHECK_NO_THROW(numBuilt = config->warmUpProcessors(context, processors, nullptr));
+        OCIO_CHECK_EQUAL(numBuilt, 2);
+        OCIO_CHECK_NE(logGuard.output().find("Could not warm up the processor"), std::string::npos);
+    }
+
+    // The callback cancels the warm up.
+
+    numCalls = 0;
+    auto cancel = [&numCalls](size_t, size_t)
+    {
+        ++numCalls;
+        return false;
+    };
+
+    OCIO_CHECK_NO_THROW(config->warmUpProcessors(context, "cs1", cancel));
+    OCIO_CHECK_EQUAL(numCalls, 1);
+
+    // Faulty arguments.
+
+    OCIO_CHECK_THROW_WHAT(config->warmUpProcessors(nullptr, "ref", nullptr),
+                          OCIO::Exception,
+                          "Context is null");
+    OCIO_CHECK_THROW_WHAT(config->warmUpProcessors(context, "", nullptr),
+                          OCIO::Exception,
+                          "Source color space name is empty");
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
@@ -9472,3 +9591,306 @@ OCIO_ADD_TEST(Config, create_from_config_io_proxy)
         OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
     }
 }
+
+OCIO_ADD_TEST(Config, name_lookups)
+{
+    // The name lookups use indexes which must follow the config changes.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    // Looks.
+
+    OCIO::LookRcPtr look = OCIO::Look::Create();
+    look->setName("look1");
+    look->setProcessSpace("raw");
+    OCIO_CHECK_NO_THROW(config->addLook(look));
+    look->setName("look2");
+    OCIO_CHECK_NO_THROW(config->addLook(look));
+
+    OCIO_REQUIRE_ASSERT(config->getLook("LOOK2"));
+    OCIO_CHECK_EQUAL(std::string(config->getLook("LOOK2")->getName()), "look2");
+    OCIO_CHECK_ASSERT(!config->getLook("look3"));
+    OCIO_CHECK_ASSERT(!config->getLook(""));
+
+    // Replace a look.
+    look->setName("Look1");
+    look->setDescription("replaced");
+    OCIO_CHECK_NO_THROW(config->addLook(look));
+    OCIO_CHECK_EQUAL(config->getNumLooks(), 2);
+    OCIO_REQUIRE_ASSERT(config->getLook("look1"));
+    OCIO_CHECK_EQUAL(std::string(config->getLook("look1")->getDescription()), "replaced");
+
+    // View transforms.
+
+    OCIO::ViewTransformRcPtr vt = OCIO::ViewTransform::Create(OCIO::REFERENCE_SPACE_SCENE);
+    vt->setName("vt1");
+    vt->setTransform(OCIO::MatrixTransform::Create(), OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE);
+    OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+    vt->setName("vt2");
+    OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+
+    OCIO_REQUIRE_ASSERT(config->getViewTransform("VT2"));
+    OCIO_CHECK_EQUAL(std::string(config->getViewTransform("VT2")->getName()), "vt2");
+    OCIO_CHECK_ASSERT(!config->getViewTransform("vt3"));
+
+    vt->setName("VT1");
+    vt->setDescription("replaced");
+    OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+    OCIO_CHECK_EQUAL(config->getNumViewTransforms(), 2);
+    OCIO_REQUIRE_ASSERT(config->getViewTransform("vt1"));
+    OCIO_CHECK_EQUAL(std::string(config->getViewTransform("vt1")->getDescription()), "replaced");
+
+    // Named transforms.
+
+    OCIO::NamedTransformRcPtr nt = OCIO::NamedTransform::Create();
+    nt->setName("nt1");
+    nt->addAlias("alias1");
+    nt->setTransform(OCIO::MatrixTransform::Create(), OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(config->addNamedTransform(nt));
+
+    nt->setName("nt2");
+    nt->removeAlias("alias1");
+    nt->addAlias("alias2");
+    OCIO_CHECK_NO_THROW(config->addNamedTransform(nt));
+
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("ALIAS1"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("ALIAS1")->getName()), "nt1");
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("Nt2"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("Nt2")->getName()), "nt2");
+
+    // Replace a named transform with a different alias.
+    nt->setName("nt1");
+    nt->removeAlias("alias2");
+    nt->addAlias("alias3");
+    OCIO_CHECK_NO_THROW(config->addNamedTransform(nt));
+    OCIO_CHECK_EQUAL(config->getNumNamedTransforms(), 2);
+    OCIO_CHECK_ASSERT(!config->getNamedTransform("alias1"));
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("alias3"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("alias3")->getName()), "nt1");
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("alias2"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("alias2")->getName()), "nt2");
+
+    // The copies keep the indexes.
+
+    OCIO::ConstConfigRcPtr copy = config->createEditableCopy();
+    OCIO_CHECK_ASSERT(copy->getLook("look2"));
+    OCIO_CHECK_ASSERT(copy->getViewTransform("vt2"));
+    OCIO_CHECK_ASSERT(copy->getNamedTransform("alias3"));
+
+    // Clear all.
+
+    config->clearLooks();
+    config->clearViewTransforms();
+    config->clearNamedTransforms();
+
+    OCIO_CHECK_ASSERT(!config->getLook("look2"));
+    OCIO_CHECK_ASSERT(!config->getViewTransform("vt2"));
+    OCIO_CHECK_ASSERT(!config->getNamedTransform("alias3"));
+
+    OCIO_CHECK_ASSERT(copy->getLook("look2"));
+    OCIO_CHECK_ASSERT(copy->getViewTransform("vt2"));
+    OCIO_CHECK_ASSERT(copy->getNamedTransform("alias3"));
+}
+
+OCIO_ADD_TEST(Config, inactive_color_spaces_append)
+{
+    // Appending a color space only refreshes its own active state.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO_CHECK_NO_THROW(config->setInactiveColorSpaces("cs2, alias3"));
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("cs1");
+    OCIO_CHECK_NO_THROW(config->addColorSpace(cs));
+    cs->setName("cs2");
+    OCIO_CHECK_NO_THROW(config->addColorSpace(cs));
+    cs->setName("cs3");
+    cs->addAlias("alias3");
+    OCIO_CHECK_NO_THROW(config->addColorSpace(cs));
+    cs->setName("cs4");
+    cs->removeAlias("alias3");
+    OCIO_CHECK_NO_THROW(config->addColorSpace(cs));
+
+    OCIO_REQUIRE_EQUAL(config->getNumColorSpaces(), 3);
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(0)), "raw");
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(1)), "cs1");
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(2)), "cs4");
+
+    OCIO_REQUIRE_EQUAL(config->getNumColorSpaces(OCIO::SEARCH_REFERENCE_SPACE_ALL,
+                                                 OCIO::COLORSPACE_INACTIVE), 2);
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(OCIO::SEARCH_REFERENCE_SPACE_ALL,
+                                                                  OCIO::COLORSPACE_INACTIVE, 0)),
+                     "cs2");
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(OCIO::SEARCH_REFERENCE_SPACE_ALL,
+                                                                  OCIO::COLORSPACE_INACTIVE, 1)),
+                     "cs3");
+
+    // Replace a color space.
+    cs->setName("cs1");
+    cs->addAlias("alias3");
+    OCIO_CHECK_THROW(config->addColorSpace(cs), OCIO::Exception);
+    cs->removeAlias("alias3");
+    cs->setDescription("replaced");
+    OCIO_CHECK_NO_THROW(config->addColorSpace(cs));
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 3);
+    OCIO_CHECK_EQUAL(std::string(config->getColorSpaceNameByIndex(1)), "cs1");
+}
+
+OCIO_ADD_TEST(Config, lazy_loading)
+{
+    static constexpr char CONFIG[] =
+        "ocio_profile_version: 2\n"
+        "\n"
+        "roles:\n"
+        "  default: ref\n"
+        "  scene_linear: ref\n"
+        "\n"
+        "displays:\n"
+        "  disp1:\n"
+        "    - !<View> {name: view1, colorspace: cs1}\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: ref\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "    from_scene_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    to_scene_reference: !<CDLTransform> {slope: [1, 2]}\n";
+
+    // The errors in the color space transforms are detected when loading the config.
+    {
+        std::istringstream is(CONFIG);
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromStream(is), OCIO::Exception,
+                              "'slope' values must be 3 floats");
+    }
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_CONFIG_LOADING_ENVVAR, "1");
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 3);
+
+    // The transforms are loaded on first use.
+
+    OCIO::ConstColorSpaceRcPtr cs1 = config->getColorSpace("cs1");
+    OCIO_REQUIRE_ASSERT(cs1);
+    OCIO_CHECK_ASSERT(!cs1->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+
+    OCIO::ConstTransformRcPtr tr = cs1->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    OCIO_REQUIRE_ASSERT(tr);
+    OCIO_CHECK_EQUAL(tr->getTransformType(), OCIO::TRANSFORM_TYPE_MATRIX);
+    OCIO_CHECK_ASSERT(tr == cs1->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE));
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(OCIO::ROLE_SCENE_LINEAR, "disp1", "view1",
+                                                    OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_ASSERT(proc);
+
+    float pixel[3]{ 0.f, 0.f, 0.f };
+    proc->getDefaultCPUProcessor()->applyRGB(pixel);
+    OCIO_CHECK_CLOSE(pixel[0], 0.1f, 1e-6f);
+    OCIO_CHECK_CLOSE(pixel[1], 0.2f, 1e-6f);
+    OCIO_CHECK_CLOSE(pixel[2], 0.3f, 1e-6f);
+
+    // The loading errors are only reported when used, and logged once as the copies share the
+    // not yet loaded transforms.
+
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+
+    OCIO::LogGuard logGuard;
+    std::ostringstream oss;
+    OCIO_CHECK_THROW_WHAT(copy->serialize(oss), OCIO::Exception,
+                          "'slope' values must be 3 floats");
+    OCIO_CHECK_ASSERT(logGuard.findAndRemove(
+        "[OpenColorIO Error]: Error: Loading the OCIO profile failed. At line 21, the value "
+        "parsing of the key 'slope' from 'CDLTransform' failed: 'slope' values must be 3 floats. "
+        "Found '2'."));
+    logGuard.print();
+
+    OCIO_CHECK_THROW_WHAT(config->getProcessor("cs2", "cs1"), OCIO::Exception,
+                          "'slope' values must be 3 floats");
+    OCIO_CHECK_THROW_WHAT(copy->getProcessor("cs2", "cs1"), OCIO::Exception,
+                          "'slope' values must be 3 floats");
+    OCIO_CHECK_THROW_WHAT(config->validate(), OCIO::Exception,
+                          "'slope' values must be 3 floats");
+}
+
+OCIO_ADD_TEST(Config, lazy_loading_cache_id)
+{
+    static constexpr char CONFIG[] =
+        "ocio_profile_version: 2\n"
+        "\n"
+        "roles:\n"
+        "  default: ref\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: ref\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "    from_scene_reference: !<GroupTransform>\n"
+        "      children:\n"
+        "        - !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+        "        - !<FileTransform> {src: $LUT}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    to_scene_reference: !<CDLTransform> {slope: [1, 2]}\n";
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_CONFIG_LOADING_ENVVAR, "1");
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+
+    OCIO::ContextRcPtr context1 = config->getCurrentContext()->createEditableCopy();
+    context1->setStringVar("LUT", (OCIO::GetTestFilesDir() + "/lut1d_1.spi1d").c_str());
+    OCIO::ContextRcPtr context2 = config->getCurrentContext()->createEditableCopy();
+    context2->setStringVar("LUT", (OCIO::GetTestFilesDir() + "/lut3d_1.spi3d").c_str());
+
+    // The cache ID does not load the transforms i.e. the error of cs2 is not logged.
+
+    OCIO::LogGuard logGuard;
+
+    std::string cacheID1;
+    std::string cacheID2;
+    OCIO_CHECK_NO_THROW(cacheID1 = config->getCacheID(context1));
+    OCIO_CHECK_NO_THROW(cacheID2 = config->getCacheID(context2));
+    OCIO_CHECK_ASSERT(logGuard.empty());
+
+    // The config part of the ID is the hash of the YAML content.
+    const std::string contentID = OCIO::CacheIDHash(CONFIG, strlen(CONFIG));
+    OCIO_CHECK_EQUAL(cacheID1.substr(0, cacheID1.find(':')), contentID);
+
+    // The file references of the not yet loaded transforms are part of the ID.
+    OCIO_CHECK_NE(cacheID1.substr(cacheID1.find(':')), cacheID2.substr(cacheID2.find(':')));
+
+    // The copies keep the ID.
+    OCIO_CHECK_EQUAL(std::string(config->createEditableCopy()->getCacheID(context1)), cacheID1);
+
+    // Once loaded, the file references come from the loaded transforms (an extra variable is
+    // needed to compute a new ID).
+    OCIO_CHECK_ASSERT(config->getColorSpace("cs1")->getTransform(
+        OCIO::COLORSPACE_DIR_FROM_REFERENCE));
+
+    OCIO::ContextRcPtr context3 = context2->createEditableCopy();
+    context3->setStringVar("UNUSED", "value");
+    const std::string cacheID3 = config->getCacheID(context3);
+    OCIO_CHECK_EQUAL(cacheID3.substr(cacheID3.find(':')), cacheID2.substr(cacheID2.find(':')));
+
+    // A config change resets the ID i.e. it is then the hash of the serialization, which loads
+    // all the transforms.
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+    copy->setDescription("changed");
+    OCIO_CHECK_THROW_WHAT(copy->getCacheID(context1), OCIO::Exception,
+                          "'slope' values must be 3 floats");
+    logGuard.clear();
+}
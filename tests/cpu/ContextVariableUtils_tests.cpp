@@ -137,3 +137,23 @@ OCIO_ADD_TEST(ContextVariableUtils, env_expand)
     }
 }
 
+
+OCIO_ADD_TEST(ContextVariableUtils, env_expand_steps)
+{
+    // Test the successive expansions of a string.
+
+    OCIO::EnvMap env_map;
+    env_map.insert(OCIO::EnvMap::value_type("A", "O"));
+    env_map.insert(OCIO::EnvMap::value_type("FOO", "bar"));
+
+    OCIO::UsedEnvs usedEnvs;
+    std::string steps;
+    OCIO_CHECK_EQUAL(OCIO::ResolveContextVariables("$FO$A", env_map, usedEnvs, steps), "bar");
+    OCIO_CHECK_EQUAL(steps, std::string("$FO$A\0$FOO\0bar\0", 15));
+    OCIO_CHECK_EQUAL(usedEnvs.size(), 2);
+
+    // Nothing is recorded for a string without any context variable.
+    steps.clear();
+    OCIO_CHECK_EQUAL(OCIO::ResolveContextVariables("/a/b", env_map, usedEnvs, steps), "/a/b");
+    OCIO_CHECK_ASSERT(steps.empty());
+}
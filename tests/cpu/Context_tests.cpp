@@ -172,3 +172,107 @@ OCIO_ADD_TEST(Context, string_vars)
     OCIO_CHECK_EQUAL(std::string("var3"), ctx1->getStringVarNameByIndex(2));
     OCIO_CHECK_EQUAL(std::string("val3"), ctx1->getStringVarByIndex(2));
 }
+
+OCIO_ADD_TEST(Context, string_vars_cache)
+{
+    // Test that a context variable change only invalidates the cached strings it could change.
+
+    OCIO::ContextRcPtr ctx = OCIO::Context::Create();
+    ctx->setStringVar("SHOT", "001");
+    ctx->setStringVar("SEQ", "abc");
+    ctx->setStringVar("A", "O");
+
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/abc/001");
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("$FO$A")), "$FOO");
+
+    // Changing or removing an unused context variable keeps the results.
+    ctx->setStringVar("A", "O");
+    ctx->setStringVar("B", "b");
+    ctx->setStringVar("B", nullptr);
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/abc/001");
+
+    // Changing a used context variable updates the results.
+    ctx->setStringVar("SHOT", "002");
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/abc/002");
+    ctx->setStringVar("SEQ", nullptr);
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/$SEQ/002");
+
+    // Adding a context variable updates the results where its name appears, including in the
+    // intermediate expansions.
+    ctx->setStringVar("SEQ", "def");
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/def/002");
+    ctx->setStringVar("FOO", "bar");
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("$FO$A")), "bar");
+
+    // Clearing the context variables invalidates all the results.
+    ctx->clearStringVars();
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SEQ/$SHOT")), "/$SEQ/$SHOT");
+
+    // The used context variables are still collected from the cached results.
+    ctx->setStringVar("SHOT", "003");
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SHOT")), "/003");
+
+    OCIO::ContextRcPtr usedVars = OCIO::Context::Create();
+    OCIO_CHECK_EQUAL(std::string(ctx->resolveStringVar("/$SHOT", usedVars)), "/003");
+    OCIO_REQUIRE_EQUAL(usedVars->getNumStringVars(), 1);
+    OCIO_CHECK_EQUAL(std::string(usedVars->getStringVarNameByIndex(0)), "SHOT");
+}
+
+OCIO_ADD_TEST(Context, string_vars_search_path_cache)
+{
+    OCIO::ContextRcPtr ctx = OCIO::Context::Create();
+    ctx->setSearchPath("$DIR");
+    ctx->setStringVar("DIR", (ociodir + "/src/OpenColorIO").c_str());
+    ctx->setStringVar("OTHER", "value");
+
+    const std::string res1 = ociodir + "/src/OpenColorIO/Context.cpp";
+    OCIO_CHECK_EQUAL(SanitizePath(ctx->resolveFileLocation("Context.cpp")), SanitizePath(res1.c_str()));
+
+    ctx->setStringVar("OTHER", "other");
+    OCIO_CHECK_EQUAL(SanitizePath(ctx->resolveFileLocation("Context.cpp")), SanitizePath(res1.c_str()));
+
+    ctx->setStringVar("DIR", (ociodir + "/tests/cpu").c_str());
+    const std::string res2 = ociodir + "/tests/cpu/Context_tests.cpp";
+    OCIO_CHECK_EQUAL(SanitizePath(ctx->resolveFileLocation("Context_tests.cpp")),
+                     SanitizePath(res2.c_str()));
+    OCIO_CHECK_THROW(ctx->resolveFileLocation("Context.cpp"), OCIO::ExceptionMissingFile);
+}
+
+OCIO_ADD_TEST(Context, string_vars_cache_id)
+{
+    // The cache identifier only depends on the context variables, not on their insertion order.
+
+    OCIO::ContextRcPtr ctx1 = OCIO::Context::Create();
+    ctx1->setStringVar("var1", "val1");
+    ctx1->setStringVar("var2", "val2");
+
+    OCIO::ContextRcPtr ctx2 = OCIO::Context::Create();
+    ctx2->setStringVar("var2", "val2");
+    ctx2->setStringVar("var3", "val3");
+    ctx2->setStringVar("var1", "val1");
+
+    const std::string id1 = ctx1->getCacheID();
+    OCIO_CHECK_NE(id1, std::string(ctx2->getCacheID()));
+
+    ctx2->setStringVar("var3", nullptr);
+    OCIO_CHECK_EQUAL(id1, std::string(ctx2->getCacheID()));
+
+    // The name and the value are not interchangeable.
+    ctx2->setStringVar("var1", nullptr);
+    ctx2->setStringVar("var1v", "al1");
+    OCIO_CHECK_NE(id1, std::string(ctx2->getCacheID()));
+
+    ctx2->setStringVar("var1v", nullptr);
+    ctx2->setStringVar("var1", "val1");
+    OCIO_CHECK_EQUAL(id1, std::string(ctx2->getCacheID()));
+
+    ctx2->setStringVar("var1", "val11");
+    OCIO_CHECK_NE(id1, std::string(ctx2->getCacheID()));
+
+    OCIO::ContextRcPtr ctx3 = ctx1->createEditableCopy();
+    OCIO_CHECK_EQUAL(id1, std::string(ctx3->getCacheID()));
+
+    ctx3->clearStringVars();
+    OCIO_CHECK_EQUAL(std::string(OCIO::Context::Create()->getCacheID()),
+                     std::string(ctx3->getCacheID()));
+}
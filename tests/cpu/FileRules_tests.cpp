@@ -1061,6 +1061,138 @@ OCIO_ADD_TEST(FileRules, rules_test)
     // and inactive color spaces in OCIO_ADD_TEST(Config, use_alias).
 }
 
+OCIO_ADD_TEST(FileRules, simple_glob_matcher)
+{
+    // The simple glob matcher must give the same results than the regular expression.
+
+    struct Glob
+    {
+        const char * m_pattern;
+        const char * m_extension;
+        bool m_isSimple;
+    };
+
+    const std::vector<Glob> globs{
+        { "*",               "*",      true  },
+        { "*",               "exr",    true  },
+        { "*",               "EXR",    true  },
+        { "*",               "tar.gz", true  },
+        { "/mnt/plates/*",   "*",      true  },
+        { "/mnt/plates/*",   "dpx",    true  },
+        { "/mnt/file",       "exr",    true  },
+        { "/mnt/file",       "*",      true  },
+        { "/mnt/(file)+$",   "exr",    true  },
+        { "*plates*",        "exr",    false },
+        { "/mnt/pl?tes/*",   "exr",    false },
+        { "/mnt/plates/*",   "[eE]xr", false },
+        { "*",               "ex?",    false },
+    };
+
+    const std::vector<std::string> paths{
+        "", ".", "exr", ".exr", "a.exr", "a.EXR", "a.eXr", "a.exrx", "a.ex", "a.exr.exr", "aexr",
+        "a.tar.gz", "a.TAR.gz", "a.gz", "/mnt/plates/a.dpx", "/mnt/plates/a.DPX",
+        "/mnt/plates/.dpx", "/mnt/plates/a", "/mnt/plates/", "/mnt/plates", "/mnt/plates.dpx",
+        "/mnt/plates/sub/a.exr", "/MNT/plates/a.dpx", "/mnt/file.exr", "/mnt/file.EXR",
+        "/mnt/file.exr.exr", "/mnt/file", "/mnt/filexexr", "/mnt/file.", "/mnt/(file)+$.exr",
+        "/mnt/plates/a\n.dpx", "a\r.exr", "/mnt/file.\n"
+    };
+
+    for (const auto & glob : globs)
+    {
+        const std::string exp = OCIO::BuildRegularExpression(glob.m_pattern, glob.m_extension);
+        const std::regex reg(exp);
+
+        OCIO::SimpleGlobMatcher matcher;
+        OCIO_REQUIRE_EQUAL(matcher.build(glob.m_pattern, glob.m_extension), glob.m_isSimple);
+
+        if (glob.m_isSimple)
+        {
+            for (const auto & path : paths)
+            {
+                if (OCIO::HasLineTerminator(path.c_str()))
+                {
+                    continue;
+                }
+
+                OCIO_CHECK_EQUAL(matcher.matches(path.c_str()), std::regex_match(path, reg));
+            }
+        }
+    }
+
+    // The rules fall back to the regular expression when the path has line terminators.
+
+    std::istringstream is;
+    is.str(g_config);
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is)->createEditableCopy());
+    auto rules = config->getFileRules()->createEditableCopy();
+    OCIO_CHECK_NO_THROW(rules->insertRule(0, "rule", "cs1", "*", "exr"));
+    config->setFileRules(rules);
+
+    size_t rulePos = 0;
+    config->getColorSpaceFromFilepath("a.exr", rulePos);
+    OCIO_CHECK_EQUAL(rulePos, 0);
+    config->getColorSpaceFromFilepath("a\n.exr", rulePos);
+    OCIO_CHECK_EQUAL(rulePos, 1);
+}
+
+OCIO_ADD_TEST(FileRules, get_color_spaces_from_filepaths)
+{
+    std::istringstream is;
+    is.str(g_config);
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is)->createEditableCopy());
+    auto rules = config->getFileRules()->createEditableCopy();
+    OCIO_CHECK_NO_THROW(rules->insertRule(0, "dpx file", "raw", "*", "dpx"));
+    OCIO_CHECK_NO_THROW(rules->insertRule(1, "regex", "cs2", R"(.*/(mine|yours)/.*)"));
+    OCIO_CHECK_NO_THROW(rules->insertPathSearchRule(2));
+    config->setFileRules(rules);
+
+    const std::vector<std::string> names{
+        "/mnt/user/show/img_cs1.dpx", "/mnt/mine/img_cs1.exr", "show/cs2/img_cs1.exr",
+        "show/cs1/img_other_cs1.exr", "/mnt/user/unknown.dpx", "/mnt/user/unknown.jpg", ""
+    };
+
+    // Enough paths to be processed by several threads.
+    std::vector<std::string> filePaths;
+    for (size_t idx = 0; idx < 1000; ++idx)
+    {
+        filePaths.push_back(names[idx % names.size()]);
+    }
+
+    std::vector<std::string> colorSpaces;
+    std::vector<size_t> ruleIndices;
+    OCIO_CHECK_NO_THROW(config->getColorSpacesFromFilepaths(filePaths, colorSpaces, ruleIndices));
+    OCIO_REQUIRE_EQUAL(colorSpaces.size(), filePaths.size());
+    OCIO_REQUIRE_EQUAL(ruleIndices.size(), filePaths.size());
+
+    for (size_t idx = 0; idx < filePaths.size(); ++idx)
+    {
+        size_t rulePos = 0;
+        const std::string colorSpace
+            = config->getColorSpaceFromFilepath(filePaths[idx].c_str(), rulePos);
+
+        OCIO_CHECK_EQUAL(colorSpaces[idx], colorSpace);
+        OCIO_CHECK_EQUAL(ruleIndices[idx], rulePos);
+    }
+
+    OCIO_CHECK_EQUAL(colorSpaces[0], "raw");
+    OCIO_CHECK_EQUAL(ruleIndices[0], 0);
+    OCIO_CHECK_EQUAL(colorSpaces[1], "cs2");
+    OCIO_CHECK_EQUAL(ruleIndices[1], 1);
+    OCIO_CHECK_EQUAL(colorSpaces[3], "other_cs1");
+    OCIO_CHECK_EQUAL(ruleIndices[3], 2);
+    OCIO_CHECK_EQUAL(colorSpaces[5], OCIO::ROLE_DEFAULT);
+    OCIO_CHECK_EQUAL(ruleIndices[5], 3);
+
+    // No path.
+
+    filePaths.clear();
+    OCIO_CHECK_NO_THROW(config->getColorSpacesFromFilepaths(filePaths, colorSpaces, ruleIndices));
+    OCIO_CHECK_ASSERT(colorSpaces.empty());
+    OCIO_CHECK_ASSERT(ruleIndices.empty());
+}
+
 OCIO_ADD_TEST(FileRules, rules_priority)
 {
     std::istringstream is;
@@ -11,6 +11,7 @@
 #include "ops/gamma/GammaOp.h"
 #include "ops/log/LogOp.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOp.h"
 #include "testutils/UnitTest.h"
 #include "transforms/FileTransform.h"
@@ -370,6 +371,88 @@ OCIO_ADD_TEST(OpOptimizers, combine_ops)
     }
 }
 
+OCIO_ADD_TEST(OpOptimizers, combine_lut3d_sequences)
+{
+    auto addLut = [](OCIO::OpRcPtrVec & ops, unsigned long length, OCIO::TransformDirection dir)
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(length);
+        for (auto & val : lut->getArray().getValues())
+        {
+            val *= val;
+        }
+        OCIO::CreateLut3DOp(ops, lut, dir);
+    };
+
+    const double m[4] = { 0.5, 0.5, 0.5, 1.0 };
+    const double alpha[4] = { 1.0, 1.0, 1.0, 0.5 };
+
+    OCIO::OpRcPtrVec ops;
+    addLut(ops, 9, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 17, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateScaleOp(ops, m, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 33, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateScaleOp(ops, alpha, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 9, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 17, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 9, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    OCIO_REQUIRE_EQUAL(ops.size(), 8);
+
+    OCIO::OpRcPtrVec chain;
+    for (size_t idx = 0; idx < 4; ++idx)
+    {
+        chain.push_back(ops[idx]->clone());
+    }
+
+    // The composition of 3D LUTs is not enabled.
+    OCIO_CHECK_EQUAL(OCIO::CombineLut3DSequences(ops, OCIO::OPTIMIZATION_DEFAULT), 0);
+    OCIO_CHECK_EQUAL(ops.size(), 8);
+
+    // The ops between the first and the last 3D LUTs are folded, except the ones processing the
+    // alpha channel. The pairs of 3D LUTs are left to CombineOps.
+    OCIO_CHECK_EQUAL(OCIO::CombineLut3DSequences(ops, OCIO::OPTIMIZATION_GOOD), 5);
+    OCIO_REQUIRE_EQUAL(ops.size(), 3);
+
+    OCIO::ConstOpRcPtr op = ops[0];
+    OCIO_REQUIRE_EQUAL(op->data()->getType(), OCIO::OpData::Lut3DType);
+    auto lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(op->data());
+    OCIO_CHECK_EQUAL(lut->getArray().getLength(), 33);
+    op = ops[1];
+    OCIO_CHECK_EQUAL(op->data()->getType(), OCIO::OpData::MatrixType);
+    op = ops[2];
+    OCIO_REQUIRE_EQUAL(op->data()->getType(), OCIO::OpData::Lut3DType);
+    lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(op->data());
+    OCIO_CHECK_EQUAL(lut->getArray().getLength(), 17);
+
+    // The grid entries are the evaluation of the whole chain i.e. nothing is resampled.
+    const OCIO::Lut3DOpData identity(33);
+    const auto & domain = identity.getArray().getValues();
+    std::vector<float> expected(domain.size());
+    OCIO::EvalTransform(domain.data(), expected.data(), long(domain.size() / 3), chain);
+
+    op = ops[0];
+    lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(op->data());
+    const auto & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(values[idx], expected[idx], 1e-6f);
+    }
+
+    OCIO_CHECK_NO_THROW(ops.optimize(OCIO::OPTIMIZATION_GOOD));
+    OCIO_CHECK_EQUAL(ops.size(), 3);
+
+    // A sequence starting with an inverse 3D LUT is only composed with the following 3D LUTs.
+    ops.clear();
+    addLut(ops, 9, OCIO::TRANSFORM_DIR_INVERSE);
+    addLut(ops, 17, OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::CreateScaleOp(ops, m, OCIO::TRANSFORM_DIR_FORWARD);
+    addLut(ops, 9, OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO_CHECK_EQUAL(OCIO::CombineLut3DSequences(ops, OCIO::OPTIMIZATION_GOOD), 0);
+    OCIO_CHECK_EQUAL(ops.size(), 4);
+}
+
 OCIO_ADD_TEST(OpOptimizers, non_optimizable)
 {
     OCIO::OpRcPtrVec ops;
@@ -303,6 +303,158 @@ OCIO_ADD_TEST(ParseUtils, string_to_float)
     OCIO_CHECK_EQUAL(fval, 1.0f);
 }
 
+OCIO_ADD_TEST(ParseUtils, from_chars_fast_path)
+{
+    // The fast path must give the same results as strtof.
+
+    const std::vector<std::string> values{
+        "0", "-0", "1", "+1", "0.5", "-0.125", ".5", "1.", "0.000001", "0.1234567", "16777216",
+        "16777217", "0.3333333", "1e5", "1.5E-3", "-2.5e+2", "1e10", "1e-10", "1e11", "1e", "1e+",
+        "0.30000001", "123456789", "0.00000000001", "0x10", "inf", "-nan", " 1.5", "1.5abc" };
+
+    for (const auto & value : values)
+    {
+        const char * first = value.c_str();
+        const char * last  = first + value.size();
+
+        char * endptr = nullptr;
+        const float ref = ::strtof(first, &endptr);
+
+        float val = 0.f;
+        const auto result = OCIO::NumberUtils::from_chars(first, last, val);
+        OCIO_REQUIRE_ASSERT(result.ec == std::errc());
+        OCIO_CHECK_EQUAL(result.ptr, endptr);
+        if (!std::isnan(ref))
+        {
+            OCIO_CHECK_EQUAL(val, ref);
+            OCIO_CHECK_EQUAL(std::signbit(val), std::signbit(ref));
+        }
+    }
+
+    // Check many values having 6 decimal digits (i.e. the most common LUT file values).
+
+    char buffer[16];
+    for (int i = 0; i <= 2000000; i += 3)
+    {
+        const int len = snprintf(buffer, sizeof(buffer), "%d.%06d", i / 1000000, i % 1000000);
+
+        float val = 0.f;
+        const auto result = OCIO::NumberUtils::from_chars(buffer, buffer + len, val);
+        OCIO_REQUIRE_ASSERT(result.ec == std::errc());
+        OCIO_REQUIRE_EQUAL(val, ::strtof(buffer, nullptr));
+    }
+
+    // Not a number.
+
+    float val = 0.f;
+    const std::string str("abc");
+    OCIO_CHECK_ASSERT(OCIO::NumberUtils::from_chars(str.c_str(), str.c_str() + 3, val).ec
+                      != std::errc());
+}
+
+OCIO_ADD_TEST(ParseUtils, string_to_floats)
+{
+    float values[3] = { 0.f, 0.f, 0.f };
+
+    std::string str("0.1 -2\t3e2  ");
+    OCIO_CHECK_ASSERT(OCIO::StringToFloats(str.c_str(), str.c_str() + str.size(), values, 3));
+    OCIO_CHECK_EQUAL(values[0], 0.1f);
+    OCIO_CHECK_EQUAL(values[1], -2.f);
+    OCIO_CHECK_EQUAL(values[2], 300.f);
+
+    // Like the former sscanf() based parsing, the end of a token is ignored.
+    str = "0.5f 1 2";
+    OCIO_CHECK_ASSERT(OCIO::StringToFloats(str.c_str(), str.c_str() + str.size(), values, 3));
+    OCIO_CHECK_EQUAL(values[0], 0.5f);
+
+    // Wrong number of values.
+    str = "1 2";
+    OCIO_CHECK_ASSERT(!OCIO::StringToFloats(str.c_str(), str.c_str() + str.size(), values, 3));
+    str = "1 2 3 4";
+    OCIO_CHECK_ASSERT(!OCIO::StringToFloats(str.c_str(), str.c_str() + str.size(), values, 3));
+
+    // Not a number.
+    str = "1 a 3";
+    OCIO_CHECK_ASSERT(!OCIO::StringToFloats(str.c_str(), str.c_str() + str.size(), values, 3));
+
+    // Only the [first, last) characters are parsed.
+    str = "1 2 3 4";
+    OCIO_CHECK_ASSERT(OCIO::StringToFloats(str.c_str(), str.c_str() + 5, values, 3));
+    OCIO_CHECK_EQUAL(values[2], 3.f);
+
+    int ints[3] = { 0, 0, 0 };
+    str = " 10 -2 +3";
+    OCIO_CHECK_ASSERT(OCIO::StringToInts(str.c_str(), str.c_str() + str.size(), ints, 3));
+    OCIO_CHECK_EQUAL(ints[0], 10);
+    OCIO_CHECK_EQUAL(ints[1], -2);
+    OCIO_CHECK_EQUAL(ints[2], 3);
+
+    str = "1 2.5 3";
+    OCIO_CHECK_ASSERT(!OCIO::StringToInts(str.c_str(), str.c_str() + str.size(), ints, 3));
+    str = "1 99999999999 3";
+    OCIO_CHECK_ASSERT(!OCIO::StringToInts(str.c_str(), str.c_str() + str.size(), ints, 3));
+
+    std::vector<int> intVec;
+    str = " 0 1023 4095 -1 ";
+    OCIO_CHECK_ASSERT(OCIO::StringToIntVec(str.c_str(), str.c_str() + str.size(), intVec));
+    OCIO_REQUIRE_EQUAL(intVec.size(), 4);
+    OCIO_CHECK_EQUAL(intVec[1], 1023);
+    OCIO_CHECK_EQUAL(intVec[3], -1);
+
+    str = "";
+    OCIO_CHECK_ASSERT(OCIO::StringToIntVec(str.c_str(), str.c_str() + str.size(), intVec));
+    OCIO_CHECK_ASSERT(intVec.empty());
+
+    // Like StringVecToIntVec(), ints followed by other characters are not ints.
+    str = "3DMESH";
+    OCIO_CHECK_ASSERT(!OCIO::StringToIntVec(str.c_str(), str.c_str() + str.size(), intVec));
+    str = "1 2 0x21";
+    OCIO_CHECK_ASSERT(!OCIO::StringToIntVec(str.c_str(), str.c_str() + str.size(), intVec));
+}
+
+OCIO_ADD_TEST(ParseUtils, nextline_buffer)
+{
+    std::istringstream iss("header\n  first line \r\n\n \t \r\nsecond\nlast");
+
+    std::string line;
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(iss, line));
+    OCIO_CHECK_EQUAL(line, "header");
+
+    std::string content;
+    OCIO::ReadRemainingContent(iss, content);
+    OCIO_CHECK_EQUAL(content, "  first line \r\n\n \t \r\nsecond\nlast");
+
+    const char * pos = content.c_str();
+    const char * end = pos + content.size();
+    const char * first = nullptr;
+    const char * last  = nullptr;
+
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last));
+    OCIO_CHECK_EQUAL(std::string(first, last), "first line");
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last));
+    OCIO_CHECK_EQUAL(std::string(first, last), "second");
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last));
+    OCIO_CHECK_EQUAL(std::string(first, last), "last");
+    OCIO_CHECK_ASSERT(!OCIO::nextline(pos, end, first, last));
+
+    // The line number counts the empty lines.
+    pos = content.c_str();
+    int lineNumber = 1;
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last, lineNumber));
+    OCIO_CHECK_EQUAL(lineNumber, 2);
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last, lineNumber));
+    OCIO_CHECK_EQUAL(std::string(first, last), "second");
+    OCIO_CHECK_EQUAL(lineNumber, 5);
+    OCIO_REQUIRE_ASSERT(OCIO::nextline(pos, end, first, last, lineNumber));
+    OCIO_CHECK_EQUAL(lineNumber, 6);
+    OCIO_CHECK_ASSERT(!OCIO::nextline(pos, end, first, last, lineNumber));
+    OCIO_CHECK_EQUAL(lineNumber, 6);
+
+    // Nothing left to read.
+    OCIO::ReadRemainingContent(iss, content);
+    OCIO_CHECK_ASSERT(content.empty());
+}
+
 OCIO_ADD_TEST(ParseUtils, float_double)
 {
     std::string resStr;
@@ -0,0 +1,506 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cmath>
+
+#include "ProcessorDiskCache.cpp"
+
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+struct DirectoryCreationGuard
+{
+    explicit DirectoryCreationGuard(const std::string name, unsigned lineNo)
+    {
+        OCIO_CHECK_NO_THROW_FROM(
+            m_directoryPath = OCIO::CreateTemporaryDirectory(name), lineNo
+        );
+    }
+    ~DirectoryCreationGuard()
+    {
+        // Even if not strictly required on most OSes, perform the cleanup.
+        OCIO::RemoveTemporaryDirectory(m_directoryPath);
+    }
+
+    std::string m_directoryPath;
+};
+
+// Copy a test file in the directory and return its path.
+std::string CopyTestFile(const std::string & fileName, const std::string & directory)
+{
+    const std::string filePath = pystring::os::path::join(directory, fileName);
+
+    std::ifstream ifs = OCIO::Platform::CreateInputFileStream(
+        (OCIO::GetTestFilesDir() + "/" + fileName).c_str(), std::ios_base::in);
+    std::ofstream ofs(filePath.c_str(), std::ios_base::out);
+    ofs << ifs.rdbuf();
+
+    return filePath;
+}
+
+// Get the key used by Processor::Impl::setTransformUsingDiskCache().
+std::string GetKey(const OCIO::ConstConfigRcPtr & config, const OCIO::ConstTransformRcPtr & transform)
+{
+    std::ostringstream oss;
+    oss << OCIO::GetVersion() << config->getCacheID(config->getCurrentContext()) << *transform
+        << OCIO::TRANSFORM_DIR_FORWARD;
+
+    const std::string fullstr = oss.str();
+    return OCIO::CacheIDHash(fullstr.c_str(), fullstr.size());
+}
+
+template <typename T>
+std::shared_ptr<const T> GetOpData(const OCIO::ConstOpRcPtr & op)
+{
+    return OCIO::DynamicPtrCast<const T>(op->data());
+}
+
+void ApplyOps(const OCIO::OpRcPtrVec & ops, std::vector<float> & pixels)
+{
+    for (const auto & op : ops)
+    {
+        op->apply(pixels.data(), long(pixels.size() / 4));
+    }
+}
+} // anon.
+
+
+OCIO_ADD_TEST(ProcessorDiskCache, save_and_load)
+{
+    DirectoryCreationGuard guard("ocio_processor_disk_cache_save_and_load", __LINE__);
+    const std::string & cacheDir = guard.m_directoryPath;
+
+    const std::string lut1d = CopyTestFile("lut1d_1.spi1d", cacheDir);
+    const std::string lut3d = CopyTestFile("lut3d_1.spi3d", cacheDir);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    {
+        OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+        file->setSrc(lut1d.c_str());
+        group->appendTransform(file);
+
+        file = OCIO::FileTransform::Create();
+        file->setSrc(lut3d.c_str());
+        file->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+        group->appendTransform(file);
+    }
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::BuildOps(ops, *config, config->getCurrentContext(), group,
+                                       OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO::ProcessorMetadataRcPtr metadata = OCIO::ProcessorMetadata::Create();
+    metadata->addFile(lut1d.c_str());
+    metadata->addFile(lut3d.c_str());
+    metadata->addLook("look");
+
+    std::string stamp;
+    OCIO_CHECK_ASSERT(OCIO::SaveProcessorToDiskCache(cacheDir, "entry", ops, metadata, stamp));
+    OCIO_CHECK_ASSERT(!stamp.empty());
+
+    // Load the entry.
+
+    OCIO::OpRcPtrVec loadedOps;
+    OCIO::ProcessorMetadataRcPtr loadedMetadata = OCIO::ProcessorMetadata::Create();
+    std::string loadedStamp;
+    OCIO_CHECK_ASSERT(OCIO::LoadProcessorFromDiskCache(cacheDir, "entry", loadedOps,
+                                                       loadedMetadata, loadedStamp));
+    OCIO_CHECK_EQUAL(loadedStamp, stamp);
+
+    OCIO_CHECK_EQUAL(loadedMetadata->getNumFiles(), 2);
+    OCIO_CHECK_EQUAL(std::string(loadedMetadata->getFile(0)), lut1d);
+    OCIO_CHECK_EQUAL(std::string(loadedMetadata->getFile(1)), lut3d);
+    OCIO_REQUIRE_EQUAL(loadedMetadata->getNumLooks(), 1);
+    OCIO_CHECK_EQUAL(std::string(loadedMetadata->getLook(0)), "look");
+
+    // The no-ops (i.e. the file ones) are not saved.
+    OCIO_REQUIRE_EQUAL(loadedOps.size(), 2);
+    OCIO::ConstOpRcPtr op0 = loadedOps[0];
+    OCIO::ConstOpRcPtr op1 = loadedOps[1];
+    OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::Lut1DType);
+    OCIO_CHECK_EQUAL(op1->data()->getType(), OCIO::OpData::Lut3DType);
+
+    std::vector<float> pixels{ 0.1f, 0.2f, 0.3f, 1.0f,
+                               0.9f, 0.5f, 0.0f, 0.5f,
+                               1.0f, 0.7f, 0.4f, 0.0f };
+    std::vector<float> loadedPixels = pixels;
+
+    ApplyOps(ops, pixels);
+    ApplyOps(loadedOps, loadedPixels);
+
+    for (size_t idx = 0; idx < pixels.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(loadedPixels[idx], pixels[idx], 1e-6f);
+    }
+
+    // Unknown entry.
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadProcessorFromDiskCache(cacheDir, "unknown", loadedOps,
+                                                        loadedMetadata, loadedStamp));
+
+    // The entry is stale when a used file changes.
+
+    {
+        std::ofstream ofs(lut3d.c_str(), std::ios_base::out | std::ios_base::app);
+        ofs << "\n";
+    }
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadProcessorFromDiskCache(cacheDir, "entry", loadedOps,
+                                                        loadedMetadata, loadedStamp));
+
+    // The files of the stale entry are removed.
+    OCIO_CHECK_ASSERT(OCIO::GetFileStamp(pystring::os::path::join(cacheDir, "entry.txt")).empty());
+    OCIO_CHECK_ASSERT(OCIO::GetFileStamp(
+        pystring::os::path::join(cacheDir, "entry_" + stamp + ".ctf")).empty());
+
+    // The ops without any validation.
+
+    OCIO::SaveOpsToDiskCache(cacheDir, "ops", ops);
+
+    loadedOps.clear();
+    OCIO_CHECK_ASSERT(OCIO::LoadOpsFromDiskCache(cacheDir, "ops", loadedOps));
+    OCIO_CHECK_EQUAL(loadedOps.size(), 2);
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadOpsFromDiskCache(cacheDir, "unknown", loadedOps));
+
+    // The cache files are not kept by the file cache i.e. a replaced file is read again.
+
+    OCIO::OpRcPtrVec lut1dOps;
+    lut1dOps.push_back(ops[0]);
+    OCIO::SaveOpsToDiskCache(cacheDir, "ops", lut1dOps);
+
+    OCIO_CHECK_ASSERT(OCIO::LoadOpsFromDiskCache(cacheDir, "ops", loadedOps));
+    OCIO_CHECK_EQUAL(loadedOps.size(), 1);
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, bit_exact)
+{
+    DirectoryCreationGuard guard("ocio_processor_disk_cache_bit_exact", __LINE__);
+    const std::string & cacheDir = guard.m_directoryPath;
+
+    // The values need the 9 significant digits of a float and the file bit-depths would scale and
+    // round them.
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16]{ 1. / 3., 0.1, 0.2, 0.,
+                          0.3, 2. / 3., 0.1, 0.,
+                          0.1, 0.2, 1. / 7., 0.,
+                          0., 0., 0., 1. };
+    matrix->setMatrix(m44);
+    matrix->setFileInputBitDepth(OCIO::BIT_DEPTH_UINT8);
+    matrix->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    group->appendTransform(matrix);
+
+    OCIO::Lut1DTransformRcPtr lut1d = OCIO::Lut1DTransform::Create(33, false);
+    lut1d->setFileOutputBitDepth(OCIO::BIT_DEPTH_F16);
+    for (unsigned long idx = 0; idx < 33; ++idx)
+    {
+        const float v = std::pow(float(idx) / 32.f, 1.f / 2.2f);
+        lut1d->setValue(idx, v, v * 0.999999f, v / 3.f);
+    }
+    group->appendTransform(lut1d);
+
+    OCIO::Lut3DTransformRcPtr lut3d = OCIO::Lut3DTransform::Create(5);
+    lut3d->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT12);
+    for (unsigned long r = 0; r < 5; ++r)
+    {
+        for (unsigned long g = 0; g < 5; ++g)
+        {
+            for (unsigned long b = 0; b < 5; ++b)
+            {
+                lut3d->setValue(r, g, b, std::sqrt(float(r) / 7.f), float(g) / 3.f,
+                                std::exp(-float(b) / 11.f));
+            }
+        }
+    }
+    group->appendTransform(lut3d);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::BuildOps(ops, *config, config->getCurrentContext(), group,
+                                       OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    OCIO_REQUIRE_EQUAL(ops.size(), 3);
+
+    OCIO::SaveOpsToDiskCache(cacheDir, "ops", ops);
+
+    OCIO::OpRcPtrVec loadedOps;
+    OCIO_REQUIRE_ASSERT(OCIO::LoadOpsFromDiskCache(cacheDir, "ops", loadedOps));
+    OCIO_REQUIRE_EQUAL(loadedOps.size(), 3);
+
+    // The matrix values are doubles written with 15 significant digits but the renderers use
+    // floats.
+    const auto & mat = GetOpData<OCIO::MatrixOpData>(ops[0])->getArray().getValues();
+    const auto & loadedMat = GetOpData<OCIO::MatrixOpData>(loadedOps[0])->getArray().getValues();
+    for (size_t idx = 0; idx < mat.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(float(loadedMat[idx]), float(mat[idx]));
+    }
+
+    OCIO_CHECK_ASSERT(GetOpData<OCIO::Lut1DOpData>(ops[1])->getArray().getValues()
+                      == GetOpData<OCIO::Lut1DOpData>(loadedOps[1])->getArray().getValues());
+    OCIO_CHECK_ASSERT(GetOpData<OCIO::Lut3DOpData>(ops[2])->getArray().getValues()
+                      == GetOpData<OCIO::Lut3DOpData>(loadedOps[2])->getArray().getValues());
+
+    std::vector<float> pixels;
+    for (int idx = 0; idx < 64; ++idx)
+    {
+        pixels.push_back(float(idx % 4) / 3.f);
+        pixels.push_back(float(idx % 8) / 7.f);
+        pixels.push_back(float(idx) / 63.f);
+        pixels.push_back(1.f);
+    }
+    std::vector<float> loadedPixels = pixels;
+
+    ApplyOps(ops, pixels);
+    ApplyOps(loadedOps, loadedPixels);
+
+    for (size_t idx = 0; idx < pixels.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(loadedPixels[idx], pixels[idx]);
+    }
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, config)
+{
+    DirectoryCreationGuard guard("ocio_processor_disk_cache_config", __LINE__);
+    const std::string & cacheDir = guard.m_directoryPath;
+
+    const std::string lut3d = CopyTestFile("lut3d_1.spi3d", cacheDir);
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc(lut3d.c_str());
+
+    OCIO::EnvironmentVariableGuard envGuard(OCIO::OCIO_PROCESSOR_CACHE_DIR_ENVVAR, cacheDir);
+
+    std::vector<float> pixels{ 0.1f, 0.2f, 0.3f, 1.0f };
+
+    // Create the entry.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    const std::string key = GetKey(config, file);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(file);
+    OCIO_CHECK_EQUAL(proc->getProcessorMetadata()->getNumFiles(), 1);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::ProcessorMetadataRcPtr metadata = OCIO::ProcessorMetadata::Create();
+    std::string stamp;
+    OCIO_REQUIRE_ASSERT(OCIO::LoadProcessorFromDiskCache(cacheDir, key, ops, metadata, stamp));
+    OCIO_REQUIRE_EQUAL(ops.size(), 1);
+    OCIO::ConstOpRcPtr op = ops[0];
+    OCIO_CHECK_EQUAL(op->data()->getType(), OCIO::OpData::Lut3DType);
+
+    std::vector<float> lutPixels = pixels;
+    proc->getDefaultCPUProcessor()->applyRGBA(lutPixels.data());
+
+    // The optimized ops of the CPU processor are also saved.
+    std::ostringstream oss;
+    oss << key << "_" << stamp << "_32f_32f_" << OCIO::OPTIMIZATION_DEFAULT << ".ctf";
+    OCIO_CHECK_ASSERT(!OCIO::GetFileStamp(pystring::os::path::join(cacheDir, oss.str())).empty());
+
+    // Replace the saved ops to check that another config uses the entry.
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4]{ 0.5, 0.5, 0.5, 0. };
+    matrix->setOffset(offset);
+
+    OCIO::OpRcPtrVec matrixOps;
+    OCIO::BuildOps(matrixOps, *config, config->getCurrentContext(), matrix,
+                   OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_ASSERT(OCIO::SaveProcessorToDiskCache(cacheDir, key, matrixOps, metadata, stamp));
+
+    // Note that the file caches do not detect the file changes.
+    OCIO::ClearAllCaches();
+
+    config = OCIO::Config::CreateRaw();
+    proc = config->getProcessor(file);
+
+    OCIO_REQUIRE_EQUAL(proc->getProcessorMetadata()->getNumFiles(), 1);
+    OCIO_CHECK_EQUAL(std::string(proc->getProcessorMetadata()->getFile(0)), lut3d);
+
+    std::vector<float> matrixPixels = pixels;
+    proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE)->applyRGBA(matrixPixels.data());
+    OCIO_CHECK_CLOSE(matrixPixels[0], 0.6f, 1e-6f);
+    OCIO_CHECK_CLOSE(matrixPixels[1], 0.7f, 1e-6f);
+    OCIO_CHECK_CLOSE(matrixPixels[2], 0.8f, 1e-6f);
+
+    // The entry is stale when the LUT file changes.
+
+    {
+        std::ofstream ofs(lut3d.c_str(), std::ios_base::out | std::ios_base::app);
+        ofs << "\n";
+    }
+
+    OCIO::ClearAllCaches();
+
+    config = OCIO::Config::CreateRaw();
+    proc = config->getProcessor(file);
+
+    std::vector<float> newPixels = pixels;
+    proc->getDefaultCPUProcessor()->applyRGBA(newPixels.data());
+    for (size_t idx = 0; idx < pixels.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(newPixels[idx], lutPixels[idx], 1e-6f);
+    }
+
+    // The processors not using any file are not saved.
+
+    config = OCIO::Config::CreateRaw();
+    proc = config->getProcessor(matrix);
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadProcessorFromDiskCache(cacheDir, GetKey(config, matrix), ops,
+                                                        metadata, stamp));
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, gpu_allocations)
+{
+    DirectoryCreationGuard guard("ocio_processor_disk_cache_gpu_allocations", __LINE__);
+    const std::string & cacheDir = guard.m_directoryPath;
+
+    const std::string lut3d = CopyTestFile("lut3d_1.spi3d", cacheDir);
+
+    OCIO::EnvironmentVariableGuard envGuard(OCIO::OCIO_PROCESSOR_CACHE_DIR_ENVVAR, cacheDir);
+
+    // The color space processors carry the GPU allocations of their color spaces.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("lut");
+    cs->setAllocation(OCIO::ALLOCATION_LG2);
+    const float vars[3]{ -8.f, 5.f, 0.1f };
+    cs->setAllocationVars(3, vars);
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc(lut3d.c_str());
+    cs->setTransform(file, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    config->addColorSpace(cs);
+
+    cs = OCIO::ColorSpace::Create();
+    cs->setName("ref");
+    config->addColorSpace(cs);
+
+    OCIO::ColorSpaceTransformRcPtr transform = OCIO::ColorSpaceTransform::Create();
+    transform->setSrc("lut");
+    transform->setDst("ref");
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(transform);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::ProcessorMetadataRcPtr metadata = OCIO::ProcessorMetadata::Create();
+    std::string stamp;
+    OCIO_REQUIRE_ASSERT(OCIO::LoadProcessorFromDiskCache(cacheDir, GetKey(config, transform), ops,
+                                                         metadata, stamp));
+
+    OCIO_REQUIRE_EQUAL(ops.size(), 3);
+
+    OCIO::AllocationData allocation;
+    OCIO_REQUIRE_ASSERT(OCIO::GetGpuAllocation(allocation, ops[0]));
+    OCIO_CHECK_EQUAL(allocation.allocation, OCIO::ALLOCATION_LG2);
+    OCIO_REQUIRE_EQUAL(allocation.vars.size(), 3);
+    OCIO_CHECK_EQUAL(allocation.vars[0], vars[0]);
+    OCIO_CHECK_EQUAL(allocation.vars[1], vars[1]);
+    OCIO_CHECK_EQUAL(allocation.vars[2], vars[2]);
+
+    OCIO::ConstOpRcPtr op = ops[1];
+    OCIO_CHECK_EQUAL(op->data()->getType(), OCIO::OpData::Lut3DType);
+
+    OCIO_REQUIRE_ASSERT(OCIO::GetGpuAllocation(allocation, ops[2]));
+    OCIO_CHECK_EQUAL(allocation.allocation, OCIO::ALLOCATION_UNIFORM);
+    OCIO_CHECK_ASSERT(allocation.vars.empty());
+
+    // The legacy GPU shader is the same when the processor comes from the disk cache.
+
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    proc->getOptimizedLegacyGPUProcessor(OCIO::OPTIMIZATION_DEFAULT, 32)
+        ->extractGpuShaderInfo(shaderDesc);
+
+    OCIO::ClearAllCaches();
+
+    proc = config->createEditableCopy()->getProcessor(transform);
+
+    OCIO::GpuShaderDescRcPtr loadedShaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    proc->getOptimizedLegacyGPUProcessor(OCIO::OPTIMIZATION_DEFAULT, 32)
+        ->extractGpuShaderInfo(loadedShaderDesc);
+
+    OCIO_CHECK_EQUAL(std::string(loadedShaderDesc->getShaderText()),
+                     std::string(shaderDesc->getShaderText()));
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, warm_up_processors)
+{
+    // The processor warm-up (e.g. ocioarchive --precompile) fills the processor cache directory.
+
+    DirectoryCreationGuard guard("ocio_processor_disk_cache_warm_up_processors", __LINE__);
+    const std::string & cacheDir = guard.m_directoryPath;
+
+    const std::string lut3d = CopyTestFile("lut3d_1.spi3d", cacheDir);
+
+    OCIO::EnvironmentVariableGuard envGuard(OCIO::OCIO_PROCESSOR_CACHE_DIR_ENVVAR, cacheDir);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    // The raw color space is a data one i.e. the display/view processors would be no-ops.
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("ref");
+    config->addColorSpace(cs);
+
+    cs = OCIO::ColorSpace::Create();
+    cs->setName("lut");
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc(lut3d.c_str());
+    cs->setTransform(file, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    config->addColorSpace(cs);
+
+    config->addDisplayView("disp", "lutView", "lut", "");
+    config->addDisplayView("disp", "refView", "ref", "");
+
+    size_t numBuilt = 0;
+    OCIO_CHECK_NO_THROW(numBuilt = config->warmUpProcessors(config->getCurrentContext(), "ref",
+                                                            nullptr));
+    // Note that the raw config already has the sRGB display with the Raw view.
+    OCIO_CHECK_EQUAL(numBuilt, 3);
+
+    auto getKey = [&config](const char * view)
+    {
+        OCIO::DisplayViewTransformRcPtr dt = OCIO::DisplayViewTransform::Create();
+        dt->setSrc("ref");
+        dt->setDisplay("disp");
+        dt->setView(view);
+        return GetKey(config, dt);
+    };
+
+    // Only the processor using a file is saved, along with its optimized CPU ops.
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::ProcessorMetadataRcPtr metadata = OCIO::ProcessorMetadata::Create();
+    std::string stamp;
+    OCIO_REQUIRE_ASSERT(OCIO::LoadProcessorFromDiskCache(cacheDir, getKey("lutView"), ops,
+                                                         metadata, stamp));
+    OCIO_REQUIRE_EQUAL(metadata->getNumFiles(), 1);
+    OCIO_CHECK_EQUAL(std::string(metadata->getFile(0)), lut3d);
+
+    std::ostringstream oss;
+    oss << getKey("lutView") << "_" << stamp << "_32f_32f_" << OCIO::OPTIMIZATION_DEFAULT
+        << ".ctf";
+    OCIO_CHECK_ASSERT(!OCIO::GetFileStamp(pystring::os::path::join(cacheDir, oss.str())).empty());
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadProcessorFromDiskCache(cacheDir, getKey("refView"), ops,
+                                                        metadata, stamp));
+}
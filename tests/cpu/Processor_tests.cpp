@@ -260,6 +260,10 @@ OCIO_ADD_TEST(Processor, optimization_env_override_basic)
     OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_NONE, OCIO::EnvironmentOverride(testFlag));
 
     OCIO::SetEnvVariable(OCIO::OCIO_OPTIMIZATION_FLAGS_ENVVAR, "0xFFFFFFFF");
+    OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_ALL | OCIO::OPTIMIZATION_LUT_COMPACT_STORAGE,
+                     OCIO::EnvironmentOverride(testFlag));
+
+    OCIO::SetEnvVariable(OCIO::OCIO_OPTIMIZATION_FLAGS_ENVVAR, "0xDFFFFFFF");
     OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_ALL, OCIO::EnvironmentOverride(testFlag));
 
     OCIO::SetEnvVariable(OCIO::OCIO_OPTIMIZATION_FLAGS_ENVVAR, "144457667");
@@ -73,6 +73,9 @@ OCIO_ADD_TEST_AVX2(packed_uint16_to_f32_test)
 #endif
 OCIO_ADD_TEST_AVX2(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX2(packed_all_test)
+OCIO_ADD_TEST_AVX2(log2_ulp_test)
+OCIO_ADD_TEST_AVX2(exp2_ulp_test)
+OCIO_ADD_TEST_AVX2(power_ulp_test)
 
 #endif
 
@@ -96,5 +99,8 @@ OCIO_ADD_TEST_AVX512(packed_uint16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_f16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX512(packed_all_test)
+OCIO_ADD_TEST_AVX512(log2_ulp_test)
+OCIO_ADD_TEST_AVX512(exp2_ulp_test)
+OCIO_ADD_TEST_AVX512(power_ulp_test)
 
 #endif
\ No newline at end of file
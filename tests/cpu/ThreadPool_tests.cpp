@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "ThreadPool.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadPool, parallel_for)
+{
+    OCIO::ThreadPool pool(4);
+    OCIO_CHECK_EQUAL(pool.getNumThreads(), 4U);
+
+    // All the items are processed exactly once whatever the chunk size and number of threads.
+
+    for (long chunkSize : { 1L, 7L, 100L, 1000L })
+    {
+        for (unsigned maxThreads : { 0U, 1U, 2U, 8U })
+        {
+            std::vector<std::atomic<int>> counts(997);
+            std::vector<std::atomic<int>> slotUsed(pool.getNumThreads());
+
+            pool.parallelFor((long)counts.size(), chunkSize, maxThreads,
+                             [&](long begin, long end, unsigned slot)
+            {
+                OCIO_CHECK_LE(end - begin, chunkSize);
+                OCIO_CHECK_LT(slot, pool.getNumThreads());
+
+                // No two threads run concurrently with the same slot.
+                OCIO_CHECK_EQUAL(slotUsed[slot].fetch_add(1), 0);
+
+                for (long idx = begin; idx < end; ++idx)
+                {
+                    ++counts[idx];
+                }
+
+                slotUsed[slot].fetch_sub(1);
+            });
+
+            for (const auto & count : counts)
+            {
+                OCIO_CHECK_EQUAL(count.load(), 1);
+            }
+        }
+    }
+
+    // Nothing to process.
+
+    bool called = false;
+    pool.parallelFor(0, 10, 0, [&](long, long, unsigned) { called = true; });
+    OCIO_CHECK_ASSERT(!called);
+}
+
+OCIO_ADD_TEST(ThreadPool, nested_parallel_for)
+{
+    // A task of the pool starting another parallel loop must not deadlock.
+
+    OCIO::ThreadPool pool(2);
+
+    std::atomic<long> total{ 0 };
+
+    pool.parallelFor(8, 1, 0, [&](long, long, unsigned)
+    {
+        pool.parallelFor(100, 10, 0, [&](long begin, long end, unsigned)
+        {
+            total += end - begin;
+        });
+    });
+
+    OCIO_CHECK_EQUAL(total.load(), 800L);
+}
+
+OCIO_ADD_TEST(ThreadPool, exceptions)
+{
+    OCIO::ThreadPool pool(3);
+
+    OCIO_CHECK_THROW_WHAT(pool.parallelFor(100, 1, 0, [](long begin, long, unsigned)
+                          {
+                              if (begin == 42)
+                              {
+                                  throw OCIO::Exception("Chunk failure.");
+                              }
+                          }),
+                          OCIO::Exception,
+                          "Chunk failure.");
+
+    // The pool is still usable.
+
+    std::atomic<long> total{ 0 };
+    pool.parallelFor(100, 1, 0, [&](long begin, long end, unsigned) { total += end - begin; });
+    OCIO_CHECK_EQUAL(total.load(), 100L);
+}
+
+OCIO_ADD_TEST(ThreadPool, global_pool)
+{
+    OCIO::ThreadPool & pool = OCIO::GetThreadPool();
+    OCIO_CHECK_GE(pool.getNumThreads(), 1U);
+    OCIO_CHECK_EQUAL(&pool, &OCIO::GetThreadPool());
+}
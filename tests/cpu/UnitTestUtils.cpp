@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Logging.h"
@@ -71,6 +73,32 @@ ConstProcessorRcPtr GetFileTransformProcessor(const std::string & fileName)
     return config->getProcessor(fileTransform);
 }
 
+void ApplyPlanarToPacked(const OpCPU & op, const float * inImg, float * outImg, long numPixels)
+{
+    std::vector<float> in[4], out[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        in[c].resize(numPixels);
+        out[c].resize(numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            in[c][idx] = inImg[4 * idx + c];
+        }
+    }
+
+    const float * inPlanes[4]{ in[0].data(), in[1].data(), in[2].data(), in[3].data() };
+    float * outPlanes[4]{ out[0].data(), out[1].data(), out[2].data(), out[3].data() };
+    op.applyPlanar(inPlanes, outPlanes, numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            outImg[4 * idx + c] = out[c][idx];
+        }
+    }
+}
+
 std::string CreateTemporaryDirectory(const std::string & name)
 {
     int nError = 0;
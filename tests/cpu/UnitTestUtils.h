@@ -42,6 +42,10 @@ FileTransformRcPtr CreateFileTransform(const std::string & fileName);
 // Create processor for a given file.
 ConstProcessorRcPtr GetFileTransformProcessor(const std::string & fileName);
 
+// Process the packed RGBA pixels with the planar apply of the CPU op, and pack the result
+// back into outImg so it can be compared with the result of the packed apply.
+void ApplyPlanarToPacked(const OpCPU & op, const float * inImg, float * outImg, long numPixels);
+
 class CachedFile;
 
 template <class LocalFileFormat, class LocalCachedFile>
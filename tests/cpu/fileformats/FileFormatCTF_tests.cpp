@@ -6820,7 +6820,7 @@ OCIO_ADD_TEST(CTFTransform, grading_rgbcurve_log_ctf)
                           0 0
                         0.5 0.5
                           1 1
-                        1.5 1.4
+                        1.5 1.39999998
             </ControlPoints>
         </Master>
     </GradingRGBCurve>
@@ -8186,13 +8186,13 @@ R"(<?xml version="1.0" encoding="UTF-8"?>
     <LUT3D inBitDepth="32f" outBitDepth="32f">
         <Array dim="2 2 2 3">
           0           0           0
-     0.0361      0.0361  0.53609997
-     0.3576  0.85759997      0.3576
-     0.3937      0.8937      0.8937
-     0.6063      0.1063      0.1063
- 0.64240003      0.1424  0.64239997
- 0.96389997  0.96389997      0.4639
-          1           1           1
+0.0361000001 0.0361000001   0.53609997
+ 0.357600003  0.857599974  0.357600003
+ 0.393700004  0.893700004  0.893700004
+ 0.606299996  0.106299996  0.106299996
+ 0.642400026  0.142399997  0.642399967
+  0.96389997   0.96389997       0.4639
+           1            1            1
         </Array>
     </LUT3D>
 </ProcessList>
@@ -8330,13 +8330,13 @@ R"(<?xml version="1.0" encoding="UTF-8"?>
     <LUT3D inBitDepth="32f" outBitDepth="32f">
         <Array dim="2 2 2 3">
           0           0           0
-     0.0361      0.0361  0.53609997
-     0.3576  0.85759997      0.3576
-     0.3937      0.8937      0.8937
-     0.6063      0.1063      0.1063
- 0.64240003      0.1424  0.64239997
- 0.96389997  0.96389997      0.4639
-          1           1           1
+0.0361000001 0.0361000001   0.53609997
+ 0.357600003  0.857599974  0.357600003
+ 0.393700004  0.893700004  0.893700004
+ 0.606299996  0.106299996  0.106299996
+ 0.642400026  0.142399997  0.642399967
+  0.96389997   0.96389997       0.4639
+           1            1            1
         </Array>
     </LUT3D>
 </ProcessList>
@@ -55,7 +55,7 @@ OCIO_ADD_TEST(FileFormatSpi3D, test)
     OCIO_CHECK_EQUAL(0.175453f, lutArray[30950]);
 }
 
-void ReadSpi3d(const std::string & fileContent)
+OCIO::CachedFileRcPtr ReadSpi3d(const std::string & fileContent)
 {
     std::istringstream is;
     is.str(fileContent);
@@ -63,7 +63,7 @@ void ReadSpi3d(const std::string & fileContent)
     // Read file
     OCIO::LocalFileFormat tester;
     const std::string SAMPLE_NAME("Memory File");
-    OCIO::CachedFileRcPtr cachedFile = tester.read(is, SAMPLE_NAME, OCIO::INTERP_DEFAULT);
+    return tester.read(is, SAMPLE_NAME, OCIO::INTERP_DEFAULT);
 }
 
 OCIO_ADD_TEST(FileFormatSpi3D, read_failure)
@@ -86,6 +86,31 @@ OCIO_ADD_TEST(FileFormatSpi3D, read_failure)
 
         OCIO_CHECK_NO_THROW(ReadSpi3d(SAMPLE_NO_ERROR));
     }
+    {
+        // The tokens after the blue value are ignored.
+        const std::string SAMPLE_EXTRA_TOKENS =
+            "SPILUT 1.0\n"
+            "3 3\n"
+            "2 2 2\n"
+            "0 0 0 0.0 0.0 0.0 # black\n"
+            "0 0 1 0.0 0.0 0.9 1.0\n"
+            "0 1 0 0.0 0.7 0.0\n"
+            "0 1 1 0.0 0.8 0.8\n"
+            "1 0 0 0.7 0.0 0.1\n"
+            "1 0 1 0.7 0.6 0.1\n"
+            "1 1 0 0.6 0.7 0.1\n"
+            "1 1 1 0.6 0.7 0.7 extra tokens\n";
+
+        OCIO::CachedFileRcPtr cachedFile;
+        OCIO_CHECK_NO_THROW(cachedFile = ReadSpi3d(SAMPLE_EXTRA_TOKENS));
+        OCIO::LocalCachedFileRcPtr lut
+            = OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(cachedFile);
+        OCIO_REQUIRE_ASSERT(lut);
+        const OCIO::Array & array = lut->lut->getArray();
+        OCIO_CHECK_EQUAL(array[5], 0.9f);
+        OCIO_CHECK_EQUAL(array[21], 0.6f);
+        OCIO_CHECK_EQUAL(array[23], 0.7f);
+    }
     {
         // Wrong first line
         const std::string SAMPLE_ERROR =
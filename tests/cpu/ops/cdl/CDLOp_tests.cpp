@@ -3,8 +3,11 @@
 
 
 #include <limits>
+#include <vector>
 
 #include "ops/cdl/CDLOp.cpp"
+#include "ops/cdl/CDLOpCPU_AVX2.h"
+#include "ops/cdl/CDLOpCPU_AVX512.h"
 
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
@@ -796,3 +799,155 @@ OCIO_ADD_TEST(CDLOp, create_transform)
     }
 }
 
+
+OCIO_ADD_TEST(CDLOp, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    // 19 pixels exercise both the vectorized loops and their tails.
+    constexpr long numPixels = 19;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    float rgba[4 * numPixels];
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        rgba[idx] = -0.3f + 0.023f * float(idx);
+    }
+    rgba[4 * 3 + 0] = qnan;
+    rgba[4 * 5 + 1] = inf;
+    rgba[4 * 7 + 2] = -inf;
+    rgba[4 * 17 + 3] = qnan;
+
+    const OCIO::CDLOpData::ChannelParams slope(1.35, 1.1, 0.71);
+    const OCIO::CDLOpData::ChannelParams offset(0.05, -0.23, 0.11);
+    const OCIO::CDLOpData::ChannelParams power(0.93, 0.81, 1.27);
+
+    for (int style = OCIO::CDLOpData::CDL_V1_2_FWD;
+         style <= OCIO::CDLOpData::CDL_NO_CLAMP_REV; ++style)
+    {
+        OCIO::ConstCDLOpDataRcPtr cdl
+            = std::make_shared<OCIO::CDLOpData>(OCIO::CDLOpData::Style(style),
+                                                slope, offset, power, 1.23);
+
+        for (bool fastPower : { false, true })
+        {
+            OCIO::ConstOpCPURcPtr op = OCIO::GetCDLCPURenderer(cdl, fastPower);
+            OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+            float packed[4 * numPixels];
+            op->apply(rgba, packed, numPixels);
+
+            float planar[4 * numPixels];
+            OCIO::ApplyPlanarToPacked(*op, rgba, planar, numPixels);
+
+            for (long idx = 0; idx < 4 * numPixels; ++idx)
+            {
+                if (std::isnan(packed[idx]))
+                {
+                    OCIO_CHECK_ASSERT(std::isnan(planar[idx]));
+                }
+                else
+                {
+                    OCIO_CHECK_EQUAL(planar[idx], packed[idx]);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the function of one instruction set against the renderer using the precise power.
+void ValidateCDLFuncs(CDLOpCPUApplyFunc * (*getApplyFunc)(bool, bool), unsigned line)
+{
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr unsigned numPixels = 37;
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.0107f - 0.3f;
+    }
+    in[4] = qnan;
+    in[7] = qnan;
+
+    for (const auto style : { OCIO::CDLOpData::CDL_V1_2_FWD, OCIO::CDLOpData::CDL_V1_2_REV,
+                              OCIO::CDLOpData::CDL_NO_CLAMP_FWD, OCIO::CDLOpData::CDL_NO_CLAMP_REV })
+    {
+        OCIO::ConstCDLOpDataRcPtr data
+            = std::make_shared<OCIO::CDLOpData>(
+                style,
+                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::slope[0],
+                                               CDL_DATA_1::slope[1],
+                                               CDL_DATA_1::slope[2]),
+                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::offset[0],
+                                               CDL_DATA_1::offset[1],
+                                               CDL_DATA_1::offset[2]),
+                OCIO::CDLOpData::ChannelParams(CDL_DATA_1::power[0],
+                                               CDL_DATA_1::power[1],
+                                               CDL_DATA_1::power[2]),
+                CDL_DATA_1::saturation);
+
+        OCIO::RenderParams params;
+        params.update(data);
+
+        CDLOpCPUApplyFunc * applyFunc = getApplyFunc(params.isReverse(), !params.isNoClamp());
+        OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+
+        std::vector<float> out(in.size());
+        applyFunc(params.getSlope(), params.getOffset(), params.getPower(),
+                  params.getSaturation(), in.data(), out.data(), numPixels);
+
+        std::vector<float> ref(in.size());
+        const auto cpu = OCIO::GetCDLCPURenderer(data, false);
+        cpu->apply(in.data(), ref.data(), numPixels);
+
+        for (size_t idx = 0; idx < out.size(); ++idx)
+        {
+            if (std::isnan(ref[idx]))
+            {
+                OCIO_CHECK_ASSERT_FROM(std::isnan(out[idx]), line);
+            }
+            else
+            {
+                // The fast power approximation has the same accuracy as the SSE renderers.
+                OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(out[idx], ref[idx], 2e-5f, 1.0f),
+                                       line);
+            }
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CDLOp, avx2_renderers)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ValidateCDLFuncs(OCIO::AVX2GetCDLApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(CDLOp, avx512_renderers)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ValidateCDLFuncs(OCIO::AVX512GetCDLApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
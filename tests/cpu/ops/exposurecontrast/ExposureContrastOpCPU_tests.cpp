@@ -2,9 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <vector>
+
 #include "ops/exposurecontrast/ExposureContrastOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -430,3 +433,125 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log_params)
     TestLogParamForStyle(OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV, true);
 }
 
+
+OCIO_ADD_TEST(ExposureContrastRenderer, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    // 19 pixels exercise both the vectorized loops and their tails.
+    constexpr long numPixels = 19;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    float rgba[4 * numPixels];
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        rgba[idx] = -0.3f + 0.023f * float(idx);
+    }
+    rgba[4 * 3 + 0] = qnan;
+    rgba[4 * 5 + 1] = inf;
+    rgba[4 * 7 + 2] = -inf;
+    rgba[4 * 17 + 3] = qnan;
+
+    for (int style = OCIO::ExposureContrastOpData::STYLE_LINEAR;
+         style <= OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV; ++style)
+    {
+        OCIO::ExposureContrastOpDataRcPtr ec = std::make_shared<OCIO::ExposureContrastOpData>(
+            OCIO::ExposureContrastOpData::Style(style));
+
+        ec->setExposure(0.8);
+        ec->setContrast(1.3);
+        ec->setGamma(1.1);
+        ec->setPivot(0.18);
+
+        OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
+        OCIO::ConstOpCPURcPtr op = OCIO::GetExposureContrastCPURenderer(const_ec);
+        OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+        float packed[4 * numPixels];
+        op->apply(rgba, packed, numPixels);
+
+        float planar[4 * numPixels];
+        OCIO::ApplyPlanarToPacked(*op, rgba, planar, numPixels);
+
+        for (long idx = 0; idx < 4 * numPixels; ++idx)
+        {
+            if (std::isnan(packed[idx]))
+            {
+                OCIO_CHECK_ASSERT(std::isnan(planar[idx]));
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(planar[idx], packed[idx]);
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the function of one instruction set against the precise power computation.
+void ValidateECFuncs(ECOpCPUApplyFunc * applyFunc, unsigned line)
+{
+    OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr long numPixels = 37;
+
+    const float inScale  = 1.3f;
+    const float power    = 0.8f;
+    const float outScale = 0.18f;
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.0173f - 0.5f;
+    }
+
+    std::vector<float> out(in.size());
+    applyFunc(inScale, power, outScale, in.data(), out.data(), numPixels);
+
+    for (size_t idx = 0; idx < out.size(); ++idx)
+    {
+        if (idx % 4 == 3)
+        {
+            // The alpha channel is not modified.
+            OCIO_CHECK_EQUAL_FROM(out[idx], in[idx], line);
+            continue;
+        }
+
+        const float expected = powf(std::max(0.0f, in[idx] * inScale), power) * outScale;
+        OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(out[idx], expected, 1e-4f, 1.0f), line);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ExposureContrastRenderer, avx2_power)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ValidateECFuncs(OCIO::AVX2GetECPowerApplyFunc(), __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(ExposureContrastRenderer, avx512_power)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ValidateECFuncs(OCIO::AVX512GetECPowerApplyFunc(), __LINE__);
+#else
+    throw SkipException();
+#endif
+}
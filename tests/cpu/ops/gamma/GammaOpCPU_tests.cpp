@@ -15,6 +15,20 @@ namespace OCIO = OCIO_NAMESPACE;
 
 namespace
 {
+
+// The expected values of the basic styles come from the SSE power approximation. The AVX2 &
+// AVX-512 versions (only used by the basic styles) round slightly differently.
+float GetBasicStyleErrorThreshold(float errorThreshold)
+{
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX2() || OCIO::CPUInfo::instance().hasAVX512())
+    {
+        return std::max(errorThreshold, 2e-6f);
+    }
+#endif
+    return errorThreshold;
+}
+
 void ApplyGamma(const OCIO::OpRcPtr & op, 
                 float * image, const float * result,
                 long numPixels, unsigned line,
@@ -59,7 +73,7 @@ constexpr float inf = std::numeric_limits<float>::infinity();
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 7;
 
     float input_32f[numPixels*4] = {
@@ -125,7 +139,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 7;
 
     float input_32f[numPixels*4] = {
@@ -189,7 +203,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_rev)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -281,7 +295,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -372,7 +386,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_rev)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -451,7 +465,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = GetBasicStyleErrorThreshold(1e-7f);
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -760,3 +774,146 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+OCIO_ADD_TEST(GammaOpCPU, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    // 19 pixels exercise both the vectorized loops and their tails.
+    constexpr long numPixels = 19;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    float rgba[4 * numPixels];
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        rgba[idx] = -0.3f + 0.023f * float(idx);
+    }
+    rgba[4 * 3 + 0] = qnan;
+    rgba[4 * 5 + 1] = inf;
+    rgba[4 * 7 + 2] = -inf;
+    rgba[4 * 17 + 3] = qnan;
+
+    const OCIO::GammaOpData::Params basic{ 2.2 };
+    const OCIO::GammaOpData::Params basicA{ 1.8 };
+    const OCIO::GammaOpData::Params moncurve{ 2.4, 0.055 };
+    const OCIO::GammaOpData::Params moncurveA{ 1.9, 0.1 };
+
+    for (int style = OCIO::GammaOpData::BASIC_FWD;
+         style <= OCIO::GammaOpData::MONCURVE_MIRROR_REV; ++style)
+    {
+        const bool isMoncurve = style >= OCIO::GammaOpData::MONCURVE_FWD;
+        const auto & params  = isMoncurve ? moncurve : basic;
+        const auto & paramsA = isMoncurve ? moncurveA : basicA;
+
+        OCIO::ConstGammaOpDataRcPtr gamma
+            = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::Style(style),
+                                                  params, params, params, paramsA);
+
+        for (bool fastPower : { false, true })
+        {
+            OCIO::ConstOpCPURcPtr op = OCIO::GetGammaRenderer(gamma, fastPower);
+            OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+            float packed[4 * numPixels];
+            op->apply(rgba, packed, numPixels);
+
+            float planar[4 * numPixels];
+            OCIO::ApplyPlanarToPacked(*op, rgba, planar, numPixels);
+
+            for (long idx = 0; idx < 4 * numPixels; ++idx)
+            {
+                if (std::isnan(packed[idx]))
+                {
+                    OCIO_CHECK_ASSERT(std::isnan(planar[idx]));
+                }
+                else
+                {
+                    OCIO_CHECK_EQUAL(planar[idx], packed[idx]);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the functions of one instruction set against the precise power computation.
+void ValidateGammaFuncs(GammaOpCPUApplyFunc * (*getApplyFunc)(OCIO::GammaOpData::Style),
+                        unsigned line)
+{
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr long numPixels = 37;
+
+    const float gamma[4] = { 2.2f, 2.6f, 1.0f / 2.4f, 1.5f };
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.0173f - 0.5f;
+    }
+
+    for (const auto style : { OCIO::GammaOpData::BASIC_FWD,
+                              OCIO::GammaOpData::BASIC_MIRROR_FWD,
+                              OCIO::GammaOpData::BASIC_PASS_THRU_FWD })
+    {
+        GammaOpCPUApplyFunc * applyFunc = getApplyFunc(style);
+        OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+
+        std::vector<float> out(in.size());
+        applyFunc(gamma, in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < out.size(); ++idx)
+        {
+            const float v = in[idx];
+            const float power = std::pow(std::fabs(v), gamma[idx % 4]);
+
+            float expected = v > 0.0f ? power : v;
+            if (style == OCIO::GammaOpData::BASIC_FWD)
+            {
+                expected = v > 0.0f ? power : 0.0f;
+            }
+            else if (style == OCIO::GammaOpData::BASIC_MIRROR_FWD)
+            {
+                expected = std::copysign(power, v);
+            }
+
+            OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(out[idx], expected, 1e-4f, 1.0f),
+                                   line);
+        }
+    }
+
+    // The moncurve styles are not supported.
+    OCIO_CHECK_ASSERT_FROM(!getApplyFunc(OCIO::GammaOpData::MONCURVE_FWD), line);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(GammaOpCPU, avx2_renderers)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ValidateGammaFuncs(OCIO::AVX2GetGammaApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(GammaOpCPU, avx512_renderers)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ValidateGammaFuncs(OCIO::AVX512GetGammaApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
@@ -620,3 +620,165 @@ OCIO_ADD_TEST(LogOpCPU, cameralog2lin_test)
     OCIO_CHECK_ASSERT(OCIO::IsNan(rgba[10]));
 }
 
+
+OCIO_ADD_TEST(LogOpCPU, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    // 19 pixels exercise both the vectorized loops and their tails.
+    constexpr long numPixels = 19;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    float rgba[4 * numPixels];
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        rgba[idx] = -0.3f + 0.023f * float(idx);
+    }
+    rgba[4 * 3 + 0] = qnan;
+    rgba[4 * 5 + 1] = inf;
+    rgba[4 * 7 + 2] = -inf;
+    rgba[4 * 17 + 3] = qnan;
+
+    const OCIO::LogOpData::Params lin2log{ 0.4, 0.6, 1.1, 0.05 };
+    const OCIO::LogOpData::Params camera{ 0.2, 0.6, 1.1, 0.05, 0.1, 1.2 };
+
+    std::vector<OCIO::ConstLogOpDataRcPtr> logs;
+    for (auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        logs.push_back(std::make_shared<OCIO::LogOpData>(2.0, dir));
+        logs.push_back(std::make_shared<OCIO::LogOpData>(10.0, dir));
+        logs.push_back(std::make_shared<OCIO::LogOpData>(10.0, lin2log, lin2log, lin2log, dir));
+        logs.push_back(std::make_shared<OCIO::LogOpData>(2.0, camera, camera, camera, dir));
+    }
+
+    for (auto & log : logs)
+    {
+        for (bool fastExp : { false, true })
+        {
+            OCIO::ConstOpCPURcPtr op = OCIO::GetLogRenderer(log, fastExp);
+            OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+            float packed[4 * numPixels];
+            op->apply(rgba, packed, numPixels);
+
+            float planar[4 * numPixels];
+            OCIO::ApplyPlanarToPacked(*op, rgba, planar, numPixels);
+
+            for (long idx = 0; idx < 4 * numPixels; ++idx)
+            {
+                if (std::isnan(packed[idx]))
+                {
+                    OCIO_CHECK_ASSERT(std::isnan(planar[idx]));
+                }
+                else
+                {
+                    OCIO_CHECK_EQUAL(planar[idx], packed[idx]);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the functions of one instruction set against the precise log & exp computations.
+void ValidateLogFuncs(LogOpCPUApplyFunc * (*getLogApplyFunc)(bool),
+                      L2LOpCPUApplyFunc * (*getL2LApplyFunc)(bool),
+                      unsigned line)
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr long numPixels = 37;
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.0173f - 0.5f;
+    }
+
+    const float p0[3] = {  1.1f,  0.9f,  1.3f   };
+    const float p1[3] = {  0.01f, 0.02f, 0.005f };
+    const float p2[3] = {  0.3f,  0.25f, 0.2f   };
+    const float p3[3] = {  0.6f,  0.55f, 0.5f   };
+
+    const float m0[3] = { -0.6f, -0.55f, -0.5f  };
+    const float m1[3] = {  3.3f,  4.0f,   5.0f  };
+    const float m2[3] = { -0.01f, -0.02f, -0.005f };
+    const float m3[3] = {  0.9f,  1.1f,   0.75f };
+
+    std::vector<float> outLog(in.size()), outAntiLog(in.size());
+    std::vector<float> outLin2Log(in.size()), outLog2Lin(in.size());
+
+    OCIO_REQUIRE_ASSERT_FROM(getLogApplyFunc(false), line);
+    OCIO_REQUIRE_ASSERT_FROM(getLogApplyFunc(true), line);
+    OCIO_REQUIRE_ASSERT_FROM(getL2LApplyFunc(true), line);
+    OCIO_REQUIRE_ASSERT_FROM(getL2LApplyFunc(false), line);
+
+    getLogApplyFunc(false)(OCIO::LOG10_2, in.data(), outLog.data(), numPixels);
+    getLogApplyFunc(true)(OCIO::LOG2_10, in.data(), outAntiLog.data(), numPixels);
+    getL2LApplyFunc(true)(p0, p1, p2, p3, in.data(), outLin2Log.data(), numPixels);
+    getL2LApplyFunc(false)(m0, m1, m2, m3, in.data(), outLog2Lin.data(), numPixels);
+
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        const size_t c = idx % 4;
+        const float v = in[idx];
+
+        if (c == 3)
+        {
+            // The alpha channel is not modified.
+            OCIO_CHECK_EQUAL_FROM(outLog[idx], v, line);
+            OCIO_CHECK_EQUAL_FROM(outAntiLog[idx], v, line);
+            OCIO_CHECK_EQUAL_FROM(outLin2Log[idx], v, line);
+            OCIO_CHECK_EQUAL_FROM(outLog2Lin[idx], v, line);
+            continue;
+        }
+
+        const float expected[4] = {
+            std::log2(std::max(v, minValue)) * OCIO::LOG10_2,
+            std::exp2(v * OCIO::LOG2_10),
+            std::log2(std::max(v * p0[c] + p1[c], minValue)) * p2[c] + p3[c],
+            (std::exp2((v + m0[c]) * m1[c]) + m2[c]) * m3[c] };
+
+        const float actual[4] = { outLog[idx], outAntiLog[idx], outLin2Log[idx], outLog2Lin[idx] };
+
+        for (int i = 0; i < 4; ++i)
+        {
+            OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(actual[i], expected[i], 1e-4f, 1.0f),
+                                   line);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(LogOpCPU, avx2_renderers)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ValidateLogFuncs(OCIO::AVX2GetLogApplyFunc, OCIO::AVX2GetL2LApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(LogOpCPU, avx512_renderers)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ValidateLogFuncs(OCIO::AVX512GetLogApplyFunc, OCIO::AVX512GetL2LApplyFunc, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
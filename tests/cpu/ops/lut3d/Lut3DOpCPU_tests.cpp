@@ -3,6 +3,7 @@
 
 
 #include <limits>
+#include <random>
 
 #include "ops/lut3d/Lut3DOpCPU.cpp"
 
@@ -55,3 +56,558 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+namespace
+{
+
+OCIO::Lut3DOpDataRcPtr CreateCompactTestLut(OCIO::Interpolation interpol, unsigned long gridSize,
+                                            bool hdr)
+{
+    // Non-identity LUT, with values out of [0, 1] when hdr is true.
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interpol, gridSize);
+    for (float & val : lut->getArray().getValues())
+    {
+        val = hdr ? std::pow(val, 1.7f) * 1.1f - 0.05f : std::pow(val, 1.7f);
+    }
+    return lut;
+}
+
+std::vector<float> CreateCompactTestImage(long numPixels)
+{
+    // Random values including out of domain values.
+    std::vector<float> pixels(numPixels * 4);
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> dist(-0.1f, 1.1f);
+    for (float & val : pixels)
+    {
+        val = dist(gen);
+    }
+    return pixels;
+}
+
+void Lut3DCompactRendererTest(OCIO::Interpolation interpol, bool hdr)
+{
+    OCIO::ConstLut3DOpDataRcPtr lutConst = CreateCompactTestLut(interpol, 17, hdr);
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+
+    float maxError = -1.f;
+    OCIO::ConstOpCPURcPtr compactRenderer = OCIO::GetLut3DRenderer(lutConst, true, maxError);
+
+    auto compact = OCIO::DynamicPtrCast<const OCIO::Lut3DCompactRenderer>(compactRenderer);
+    OCIO_REQUIRE_ASSERT(compact);
+    OCIO_CHECK_EQUAL(compact->isHalf(), hdr);
+    OCIO_CHECK_EQUAL(compact->getMaxError(), maxError);
+
+    // The half floats have 11 significant bits and the values are less than 1.05.
+    OCIO_CHECK_ASSERT(maxError > 0.f);
+    OCIO_CHECK_ASSERT(maxError <= (hdr ? 1.05f / 2048.f : 0.5f / 65535.f));
+
+    // More than one block of pixels, including out of domain values.
+    static constexpr long NumPixels = 1001;
+    std::vector<float> pixels = CreateCompactTestImage(NumPixels);
+
+    std::vector<float> ref(pixels.size());
+    renderer->apply(pixels.data(), ref.data(), NumPixels);
+
+    std::vector<float> res(pixels.size());
+    compactRenderer->apply(pixels.data(), res.data(), NumPixels);
+
+    for (size_t idx = 0; idx < res.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], ref[idx], maxError + 1e-5f);
+    }
+
+    // One pixel at a time i.e. without the SIMD gathers.
+    for (long idx = 0; idx < NumPixels; ++idx)
+    {
+        float pixel[4];
+        compactRenderer->apply(&pixels[4 * idx], pixel, 1);
+        for (long c = 0; c < 4; ++c)
+        {
+            OCIO_CHECK_CLOSE(pixel[c], res[4 * idx + c], 2e-6f);
+        }
+    }
+
+    // In place.
+    compactRenderer->apply(pixels.data(), pixels.data(), NumPixels);
+    for (size_t idx = 0; idx < res.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(pixels[idx], res[idx]);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, compact_storage_linear)
+{
+    Lut3DCompactRendererTest(OCIO::INTERP_LINEAR, false);
+    Lut3DCompactRendererTest(OCIO::INTERP_LINEAR, true);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, compact_storage_tetra)
+{
+    Lut3DCompactRendererTest(OCIO::INTERP_TETRAHEDRAL, false);
+    Lut3DCompactRendererTest(OCIO::INTERP_TETRAHEDRAL, true);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, compact_storage_fallback)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 4);
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    const long useCount = lutConst.use_count();
+
+    float maxError = -1.f;
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst, true, maxError);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::Lut3DCompactRenderer>(renderer));
+    OCIO_CHECK_ASSERT(maxError >= 0.f && maxError <= 0.5f / 65535.f);
+    // The renderer does not keep a reference to the LUT.
+    OCIO_CHECK_EQUAL(lutConst.use_count(), useCount);
+
+    // Values out of the half float range are not supported.
+    lut->getArray().getValues()[5] = 1e6f;
+    renderer = OCIO::GetLut3DRenderer(lutConst, true, maxError);
+    OCIO_CHECK_ASSERT(!OCIO::DynamicPtrCast<const OCIO::Lut3DCompactRenderer>(renderer));
+    OCIO_CHECK_EQUAL(maxError, 0.f);
+
+    // Inverse LUTs are not supported.
+    lut->getArray().getValues()[5] = 0.5f;
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    renderer = OCIO::GetLut3DRenderer(lutConst, true, maxError);
+    OCIO_CHECK_ASSERT(!OCIO::DynamicPtrCast<const OCIO::Lut3DCompactRenderer>(renderer));
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer));
+
+    // Compact storage not requested.
+    lut->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+    renderer = OCIO::GetLut3DRenderer(lutConst, false, maxError);
+    OCIO_CHECK_ASSERT(!OCIO::DynamicPtrCast<const OCIO::Lut3DCompactRenderer>(renderer));
+}
+
+namespace
+{
+
+void Lut3DCompactFuncTest(OCIO::apply_lut16_func * func, bool hdr, int line)
+{
+    static constexpr long NumPixels = 1001;
+    const std::vector<float> pixels = CreateCompactTestImage(NumPixels);
+
+    for (int dim : { 2, 5, 33 })
+    {
+        OCIO::ConstLut3DOpDataRcPtr lut = CreateCompactTestLut(OCIO::INTERP_TETRAHEDRAL, dim, hdr);
+        float maxError = 0.f;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut, true, maxError);
+
+        // Build the RGB 16-bit table followed by the padding value.
+        const auto & values = lut->getArray().getValues();
+        std::vector<uint16_t> lutTable(values.size() + 1, 0);
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            lutTable[idx] = hdr ? half(values[idx]).bits()
+                                : static_cast<uint16_t>(values[idx] * 65535.f + 0.5f);
+        }
+
+        std::vector<float> res(pixels.size());
+        func(lutTable.data(), dim, pixels.data(), res.data(), NumPixels);
+
+        // Compare with the renderer processing one pixel at a time i.e. without SIMD.
+        for (long idx = 0; idx < NumPixels; ++idx)
+        {
+            float pixel[4];
+            renderer->apply(&pixels[4 * idx], pixel, 1);
+            for (long c = 0; c < 4; ++c)
+            {
+                OCIO_CHECK_CLOSE_FROM(res[4 * idx + c], pixel[c], 2e-6f, line);
+            }
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, compact_storage_simd)
+{
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2())
+    {
+        Lut3DCompactFuncTest(OCIO::applyTetrahedralUnorm16AVX2, false, __LINE__);
+#if OCIO_USE_F16C
+        if (OCIO::CPUInfo::instance().hasF16C())
+        {
+            Lut3DCompactFuncTest(OCIO::applyTetrahedralHalfAVX2, true, __LINE__);
+        }
+#endif
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512())
+    {
+        Lut3DCompactFuncTest(OCIO::applyTetrahedralUnorm16AVX512, false, __LINE__);
+        Lut3DCompactFuncTest(OCIO::applyTetrahedralHalfAVX512, true, __LINE__);
+    }
+#endif
+}
+
+namespace
+{
+
+// Inverse renderer searching the cubes containing the inverse with a walk of the RangeTree (i.e.
+// the search used before the CubeGrid) to validate the results of the grid search.
+class InvLut3DTreeWalkRenderer : public OCIO::InvLut3DRenderer
+{
+public:
+    explicit InvLut3DTreeWalkRenderer(OCIO::ConstLut3DOpDataRcPtr & lut)
+        : OCIO::InvLut3DRenderer(lut)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        const unsigned long * gsz = m_tree.getGridSize();
+        const float maxDim = float(gsz[0] - 3u);
+        const unsigned long chans = m_tree.getChans();
+        const unsigned long depth = m_tree.getDepth();
+        const auto & levels = m_tree.getLevels();
+        const auto & baseInds = m_tree.getBaseInds();
+
+        unsigned long offs[3] = { gsz[2] * gsz[1], gsz[2], 1 };
+
+        unsigned long list_len = 8;
+        long ops_list[] =               { 0, 0, 1, 1, 1, 1, 1, 1 };
+        unsigned long entering_list[] = { 2, 1, 0, 2, 0, 2, 0, 2 };
+        unsigned long new_verts[] = {
+            1, 0, 0,  1, 1, 1,  1, 1, 0,  0, 1, 0,
+            0, 1, 1,  0, 0, 1,  1, 0, 1,  1, 0, 0 };
+        unsigned long path_list[] = {
+            0, 0, 0,  0, 0, 0,  0, 1, 2,  1, 0, 2,
+            1, 2, 0,  2, 1, 0,  2, 0, 1,  0, 2, 1 };
+        unsigned long path_order[] = { 1, 0, 2 };
+        unsigned long new_vert_list[8];
+        for (int i = 0; i < 8; i++)
+        {
+            new_vert_list[i] = new_verts[i * 3] * offs[0] + new_verts[i * 3 + 1] * offs[1]
+                               + new_verts[i * 3 + 2] * offs[2];
+        }
+        for (unsigned long i = 0; i < chans; i++)
+        {
+            offs[i] = offs[i] * chans;
+        }
+
+        static constexpr long MAX_LEVELS = 16;
+        unsigned long currentChild[MAX_LEVELS];
+        unsigned long currentNumChildren[MAX_LEVELS];
+        unsigned long currentChildInd[MAX_LEVELS];
+
+        const float * in = (const float *)inImg;
+        float * out = (float *)outImg;
+
+        for (long i = 0; i < numPixels; ++i)
+        {
+            float fxval[3] = { OCIO::Clamp(in[0], 0.f, 1.f),
+                               OCIO::Clamp(in[1], 0.f, 1.f),
+                               OCIO::Clamp(in[2], 0.f, 1.f) };
+
+            unsigned long baseIndx[3] = { 0, 0, 0 };
+            float result[3] = { 0.f, 0.f, 0.f };
+
+            currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
+            currentChild[0] = 0;
+            currentChildInd[0] = 0;
+
+            long level = 0;
+            while (level >= 0)
+            {
+                while (currentChild[level] < currentNumChildren[level])
+                {
+                    const unsigned long node = currentChildInd[level];
+                    const bool inRange =
+                        fxval[0] >= levels[level].minVals[node * chans] &&
+                        fxval[1] >= levels[level].minVals[node * chans + 1] &&
+                        fxval[2] >= levels[level].minVals[node * chans + 2] &&
+                        fxval[0] <= levels[level].maxVals[node * chans] &&
+                        fxval[1] <= levels[level].maxVals[node * chans + 1] &&
+                        fxval[2] <= levels[level].maxVals[node * chans + 2];
+                    currentChild[level]++;
+                    currentChildInd[level]++;
+
+                    if (inRange)
+                    {
+                        if (level == long(depth) - 1)
+                        {
+                            for (unsigned long k = 0; k < chans; k++)
+                                baseIndx[k] = baseInds[node].inds[k];
+
+                            if (OCIO::invert_hypercube(3, result, m_grvec.data(), offs, fxval,
+                                                       baseIndx, list_len, ops_list,
+                                                       entering_list, new_vert_list,
+                                                       path_list, path_order) != 0)
+                            {
+                                level = 0;  // to exit outer loop
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            const long newLevel = level + 1;
+                            currentNumChildren[newLevel] = levels[level].numChildren[node];
+                            currentChildInd[newLevel] = levels[level].child0offsets[node];
+                            level = newLevel;
+                            currentChild[level] = 0;
+                        }
+                    }
+                }
+                level--;
+            }
+
+            out[0] = OCIO::Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+            out[1] = OCIO::Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+            out[2] = OCIO::Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+            out[3] = in[3];
+
+            in  += 4;
+            out += 4;
+        }
+    }
+};
+
+void InvLut3DGridSearchTest(unsigned long gridSize, float gamma, float crosstalk)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL,
+                                                                     gridSize);
+    auto & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = std::pow(values[idx + 0], gamma);
+        const float g = std::pow(values[idx + 1], gamma * 1.1f);
+        const float b = std::pow(values[idx + 2], gamma * 0.9f);
+        values[idx + 0] = (1.f - 2.f * crosstalk) * r + crosstalk * g + crosstalk * b;
+        values[idx + 1] = crosstalk * r + (1.f - 2.f * crosstalk) * g + crosstalk * b;
+        values[idx + 2] = crosstalk * r + crosstalk * g + (1.f - 2.f * crosstalk) * b;
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+    OCIO_REQUIRE_ASSERT(OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer));
+    InvLut3DTreeWalkRenderer treeWalkRenderer(lutConst);
+
+    // Random values over the whole domain, and the domain corners.
+    static constexpr long NumPixels = 4096;
+    std::vector<float> pixels(NumPixels * 4);
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    for (long idx = 0; idx < NumPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = idx < 8 ? float(idx & 1)        : dist(gen);
+        pixels[4 * idx + 1] = idx < 8 ? float((idx >> 1) & 1) : dist(gen);
+        pixels[4 * idx + 2] = idx < 8 ? float((idx >> 2) & 1) : dist(gen);
+        pixels[4 * idx + 3] = 1.f;
+    }
+
+    std::vector<float> res(pixels.size());
+    renderer->apply(pixels.data(), res.data(), NumPixels);
+
+    std::vector<float> ref(pixels.size());
+    treeWalkRenderer.apply(pixels.data(), ref.data(), NumPixels);
+
+    for (size_t idx = 0; idx < res.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(res[idx], ref[idx]);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, inverse_grid_search)
+{
+    // The search of the cubes using the grid finds the same inverse as the tree walk.
+    InvLut3DGridSearchTest(2, 1.f, 0.f);
+    InvLut3DGridSearchTest(5, 1.5f, 0.1f);
+    InvLut3DGridSearchTest(17, 0.7f, 0.2f);
+    InvLut3DGridSearchTest(33, 2.2f, 0.05f);
+    InvLut3DGridSearchTest(65, 1.2f, 0.15f);
+}
+
+namespace
+{
+
+OCIO::Lut3DOpDataRcPtr CreateBrickedTestLut(OCIO::Interpolation interpol, unsigned long gridSize)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interpol, gridSize);
+    auto & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = values[idx + 0];
+        const float g = values[idx + 1];
+        const float b = values[idx + 2];
+        values[idx + 0] = std::pow(r, 1.7f) * 0.9f + 0.1f * g;
+        values[idx + 1] = std::pow(g, 0.8f) * 0.8f + 0.2f * b;
+        values[idx + 2] = std::pow(b, 1.2f) * 1.1f - 0.1f * r;
+    }
+    return lut;
+}
+
+std::vector<float> CreateBrickedTestImage(long numPixels)
+{
+    // Random values including out of domain values, and the domain corners.
+    std::vector<float> pixels(numPixels * 4);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-0.1f, 1.1f);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = idx < 8 ? float(idx & 1)        : dist(gen);
+        pixels[4 * idx + 1] = idx < 8 ? float((idx >> 1) & 1) : dist(gen);
+        pixels[4 * idx + 2] = idx < 8 ? float((idx >> 2) & 1) : dist(gen);
+        pixels[4 * idx + 3] = dist(gen);
+    }
+    return pixels;
+}
+
+void Lut3DBrickedRendererTest(OCIO::Interpolation interpol, unsigned long gridSize)
+{
+    OCIO::ConstLut3DOpDataRcPtr lut = CreateBrickedTestLut(interpol, gridSize);
+
+    OCIO::ConstOpCPURcPtr renderer, brickedRenderer;
+    if (interpol == OCIO::INTERP_TETRAHEDRAL)
+    {
+        renderer        = std::make_shared<OCIO::Lut3DTetrahedralRenderer>(lut, false);
+        brickedRenderer = std::make_shared<OCIO::Lut3DTetrahedralRenderer>(lut, true);
+    }
+    else
+    {
+        renderer        = std::make_shared<OCIO::Lut3DRenderer>(lut, false);
+        brickedRenderer = std::make_shared<OCIO::Lut3DRenderer>(lut, true);
+    }
+
+    // Not a multiple of the SIMD widths.
+    static constexpr long NumPixels = 1001;
+    const std::vector<float> pixels = CreateBrickedTestImage(NumPixels);
+
+    std::vector<float> ref(pixels.size());
+    renderer->apply(pixels.data(), ref.data(), NumPixels);
+
+    std::vector<float> res(pixels.size());
+    brickedRenderer->apply(pixels.data(), res.data(), NumPixels);
+
+    for (size_t idx = 0; idx < res.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(res[idx], ref[idx]);
+    }
+
+    // One pixel at a time (i.e. the scalar code of the tetrahedral renderer).
+    for (long idx = 0; idx < NumPixels; idx += 97)
+    {
+        brickedRenderer->apply(&pixels[4 * idx], &res[4 * idx], 1);
+        for (long c = 0; c < 4; ++c)
+        {
+            OCIO_CHECK_EQUAL(res[4 * idx + c], ref[4 * idx + c]);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, bricked_layout)
+{
+    // The bricked layout gives the same results as the blue-fastest layout, including the LUT
+    // sizes which are not a multiple of the brick size.
+    for (unsigned long gridSize : { 2ul, 5ul, 8ul, 17ul, 33ul, 65ul })
+    {
+        Lut3DBrickedRendererTest(OCIO::INTERP_LINEAR, gridSize);
+        Lut3DBrickedRendererTest(OCIO::INTERP_TETRAHEDRAL, gridSize);
+    }
+
+    // The renderers only use the bricked layout for the large LUTs.
+    OCIO::ConstLut3DOpDataRcPtr lut = CreateBrickedTestLut(OCIO::INTERP_TETRAHEDRAL, 17);
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lut);
+    OCIO_CHECK_ASSERT(!OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer)->isBricked());
+
+    lut = CreateBrickedTestLut(OCIO::INTERP_TETRAHEDRAL, OCIO::MinBrickedLutSize);
+    renderer = OCIO::GetLut3DRenderer(lut);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer)->isBricked());
+}
+
+namespace
+{
+
+void Lut3DBrickedFuncTest(OCIO::apply_lut_func * func, OCIO::apply_lut_func * brickedFunc, int line)
+{
+    static constexpr long NumPixels = 1001;
+    const std::vector<float> pixels = CreateBrickedTestImage(NumPixels);
+
+    for (int dim : { 2, 5, 33, 65 })
+    {
+        // Build both layouts of the LUT table (RGBA entries).
+        OCIO::ConstLut3DOpDataRcPtr lut = CreateBrickedTestLut(OCIO::INTERP_TETRAHEDRAL, dim);
+        const auto & values = lut->getArray().getValues();
+
+        const long numBricks = OCIO::GetLut3DNumBricks(dim);
+        std::vector<float> lutTable(dim * dim * dim * 4, 0.f);
+        std::vector<float> brickedTable(numBricks * numBricks * numBricks * 64 * 4, 0.f);
+        long idx = 0;
+        for (int r = 0; r < dim; ++r)
+        {
+            for (int g = 0; g < dim; ++g)
+            {
+                for (int b = 0; b < dim; ++b, ++idx)
+                {
+                    const int offset = OCIO::GetLut3DIndexBlueFast(r, g, b, dim, 4);
+                    const int brickedOffset = OCIO::GetLut3DIndexBricked(r, g, b, numBricks, 4);
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        lutTable[offset + c] = values[3 * idx + c];
+                        brickedTable[brickedOffset + c] = values[3 * idx + c];
+                    }
+                }
+            }
+        }
+
+        std::vector<float> ref(pixels.size());
+        func(lutTable.data(), dim, pixels.data(), ref.data(), NumPixels);
+
+        std::vector<float> res(pixels.size());
+        brickedFunc(brickedTable.data(), dim, pixels.data(), res.data(), NumPixels);
+
+        for (size_t i = 0; i < res.size(); ++i)
+        {
+            OCIO_CHECK_EQUAL_FROM(res[i], ref[i], line);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DRenderer, bricked_layout_simd)
+{
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2())
+    {
+        Lut3DBrickedFuncTest(OCIO::applyTetrahedralSSE2, OCIO::applyTetrahedralBrickedSSE2,
+                             __LINE__);
+    }
+#endif
+
+#if OCIO_USE_AVX
+    if (OCIO::CPUInfo::instance().hasAVX())
+    {
+        Lut3DBrickedFuncTest(OCIO::applyTetrahedralAVX, OCIO::applyTetrahedralBrickedAVX,
+                             __LINE__);
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2())
+    {
+        Lut3DBrickedFuncTest(OCIO::applyTetrahedralAVX2, OCIO::applyTetrahedralBrickedAVX2,
+                             __LINE__);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512())
+    {
+        Lut3DBrickedFuncTest(OCIO::applyTetrahedralAVX512, OCIO::applyTetrahedralBrickedAVX512,
+                             __LINE__);
+    }
+#endif
+}
@@ -312,6 +312,49 @@ OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
     OCIO_CHECK_EQUAL(invFastLutData->getArray().getLength(), 48);
 }
 
+OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_by_slabs)
+{
+    // The grid of the fast LUT is evaluated by slabs of pixels (possibly in parallel), the
+    // result must be identical to the evaluation of the whole grid at once.
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(17);
+    for (auto & val : lut->getArray().getValues())
+    {
+        val *= val;
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstLut3DOpDataRcPtr invLut = lut;
+    OCIO::Lut3DOpDataRcPtr fastLut;
+    OCIO_CHECK_NO_THROW(fastLut = OCIO::MakeFastLut3DFromInverse(invLut));
+
+    const long gridSize = fastLut->getArray().getLength();
+    const long numPixels = gridSize * gridSize * gridSize;
+
+    const OCIO::Lut3DOpData domain(gridSize);
+    const auto & domainValues = domain.getArray().getValues();
+    std::vector<float> pixels(numPixels * 4, 1.0f);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = domainValues[3 * idx + 0];
+        pixels[4 * idx + 1] = domainValues[3 * idx + 1];
+        pixels[4 * idx + 2] = domainValues[3 * idx + 2];
+    }
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateLut3DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    OCIO_REQUIRE_EQUAL(ops.size(), 1);
+    ops[0]->apply(pixels.data(), numPixels);
+
+    const auto & fastValues = fastLut->getArray().getValues();
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        OCIO_REQUIRE_EQUAL(fastValues[3 * idx + 0], pixels[4 * idx + 0]);
+        OCIO_REQUIRE_EQUAL(fastValues[3 * idx + 1], pixels[4 * idx + 1]);
+        OCIO_REQUIRE_EQUAL(fastValues[3 * idx + 2], pixels[4 * idx + 2]);
+    }
+}
+
 OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
 {
     OCIO::ConstLut3DOpDataRcPtr lutRef = std::make_shared<OCIO::Lut3DOpData>(5);
@@ -358,3 +401,80 @@ OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
     }
 
 }
+
+OCIO_ADD_TEST(Lut3DOpData, compose_sequence)
+{
+    // Per-channel power LUTs of increasing sizes.
+    auto makeLut = [](unsigned long length, float gamma)
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(length);
+        for (auto & val : lut->getArray().getValues())
+        {
+            val = std::pow(val, gamma);
+        }
+        return lut;
+    };
+
+    OCIO::ConstLut3DOpDataRcPtr lut1 = makeLut(9, 1.2f);
+    OCIO::ConstLut3DOpDataRcPtr lut2 = makeLut(17, 0.8f);
+    OCIO::ConstLut3DOpDataRcPtr lut3 = makeLut(33, 1.5f);
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::Compose(OCIO::ConstLut3DOpDataVec{ lut1 }),
+                          OCIO::Exception, "There is nothing to compose the 3D LUT with");
+
+    OCIO::Lut3DOpDataRcPtr composed;
+    OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose(
+                            OCIO::ConstLut3DOpDataVec{ lut1, lut2, lut3 }));
+    OCIO_CHECK_EQUAL(composed->getArray().getLength(), 33);
+    OCIO_CHECK_EQUAL(composed->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+
+    // Pairwise composition resamples the grid for each pair.
+    OCIO::ConstLut3DOpDataRcPtr composed12 = OCIO::Lut3DOpData::Compose(lut1, lut2);
+    OCIO::Lut3DOpDataRcPtr composedPairwise = OCIO::Lut3DOpData::Compose(composed12, lut3);
+    OCIO_CHECK_EQUAL(composedPairwise->getArray().getLength(), 33);
+
+    // The sequence is resampled only once i.e. it is the evaluation of the whole chain on the
+    // grid, whereas the pairwise composition also interpolates the intermediate result.
+    OCIO::OpRcPtrVec ops;
+    for (const auto & lut : { lut1, lut2, lut3 })
+    {
+        OCIO::Lut3DOpDataRcPtr data = std::const_pointer_cast<OCIO::Lut3DOpData>(lut);
+        OCIO::CreateLut3DOp(ops, data, OCIO::TRANSFORM_DIR_FORWARD);
+    }
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    const OCIO::Lut3DOpData identity(33);
+    const auto & domain = identity.getArray().getValues();
+    std::vector<float> chain(domain.size());
+    OCIO::EvalTransform(domain.data(), chain.data(), long(domain.size() / 3), ops);
+
+    float maxError = 0.f;
+    float maxErrorPairwise = 0.f;
+    for (size_t idx = 0; idx < chain.size(); ++idx)
+    {
+        maxError = std::max(maxError,
+                            std::abs(composed->getArray().getValues()[idx] - chain[idx]));
+        maxErrorPairwise = std::max(maxErrorPairwise,
+                                    std::abs(composedPairwise->getArray().getValues()[idx] - chain[idx]));
+    }
+    OCIO_CHECK_LT(maxError, 1e-6f);
+    OCIO_CHECK_LT(maxError, maxErrorPairwise);
+
+    // Inverse sequence.
+    OCIO::Lut3DOpDataRcPtr lut1Inv = lut1->clone();
+    lut1Inv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::Lut3DOpDataRcPtr lut2Inv = lut2->clone();
+    lut2Inv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::Lut3DOpDataRcPtr lut3Inv = lut3->clone();
+    lut3Inv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::Lut3DOpDataRcPtr composedInv;
+    OCIO_CHECK_NO_THROW(composedInv = OCIO::Lut3DOpData::Compose(
+                            OCIO::ConstLut3DOpDataVec{ lut3Inv, lut2Inv, lut1Inv }));
+    OCIO_CHECK_EQUAL(composedInv->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_ASSERT(composedInv->getArray().getValues() == composed->getArray().getValues());
+
+    // The directions of the LUTs are restored.
+    OCIO_CHECK_EQUAL(lut1Inv->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_EQUAL(lut3Inv->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+}
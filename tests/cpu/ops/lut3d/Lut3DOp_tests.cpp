@@ -536,6 +536,61 @@ OCIO_ADD_TEST(Lut3DOp, cpu_renderer_inverse)
     OCIO_CHECK_ASSERT(bufferImage[0] > 0.5f);
 }
 
+OCIO_ADD_TEST(Lut3DOp, cpu_renderer_inverse_domain)
+{
+    // The unit test validates the processing of inversed ops over the whole domain (i.e. the
+    // search of the cubes containing the inverse), including the domain bounds.
+
+    // An invertible LUT mixing the channels.
+    OCIO::Lut3DOpDataRcPtr fwdLutData = std::make_shared<OCIO::Lut3DOpData>(17);
+    fwdLutData->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    auto & values = fwdLutData->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = std::pow(values[idx + 0], 1.3f);
+        const float g = std::pow(values[idx + 1], 1.3f);
+        const float b = std::pow(values[idx + 2], 1.3f);
+        values[idx + 0] = 0.8f * r + 0.1f * g + 0.1f * b;
+        values[idx + 1] = 0.1f * r + 0.8f * g + 0.1f * b;
+        values[idx + 2] = 0.1f * r + 0.1f * g + 0.8f * b;
+    }
+
+    OCIO::Lut3DOp fwdLut(fwdLutData);
+    OCIO_CHECK_NO_THROW(fwdLut.finalize());
+
+    OCIO::Lut3DOpDataRcPtr invLutData = fwdLutData->inverse();
+    OCIO::Lut3DOp invLut(invLutData);
+    OCIO_CHECK_NO_THROW(invLut.finalize());
+
+    // Include the domain bounds and the values in between the grid points.
+    constexpr long numSteps = 21;
+    std::vector<float> image;
+    for (long r = 0; r < numSteps; ++r)
+    {
+        for (long g = 0; g < numSteps; ++g)
+        {
+            for (long b = 0; b < numSteps; ++b)
+            {
+                image.push_back(float(r) / float(numSteps - 1));
+                image.push_back(float(g) / float(numSteps - 1));
+                image.push_back(float(b) / float(numSteps - 1));
+                image.push_back(1.f);
+            }
+        }
+    }
+    const long numPixels = long(image.size() / 4);
+    const std::vector<float> srcImage = image;
+
+    // Apply forward and inverse LUTs.
+    OCIO_CHECK_NO_THROW(fwdLut.apply(image.data(), numPixels));
+    OCIO_CHECK_NO_THROW(invLut.apply(image.data(), numPixels));
+
+    for (size_t i = 0; i < image.size(); ++i)
+    {
+        OCIO_CHECK_CLOSE(srcImage[i], image[i], 1e-5f);
+    }
+}
+
 OCIO_ADD_TEST(Lut3DOp, cpu_renderer_lut3d_with_nan)
 {
     const std::string fileName("clf/lut3d_identity_12i_16f.clf");
@@ -120,3 +120,235 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+OCIO_ADD_TEST(MatrixOpCPU, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    constexpr long numPixels = 11;
+
+    std::vector<float> rgba(4 * numPixels);
+    for (size_t idx = 0; idx < rgba.size(); ++idx)
+    {
+        rgba[idx] = float(idx) * 0.137f - 1.5f;
+    }
+
+    OCIO::MatrixOpDataRcPtr scale(OCIO::MatrixOpData::CreateDiagonalMatrix(2.0));
+
+    OCIO::MatrixOpDataRcPtr scaleOffset = scale->clone();
+    scaleOffset->setOffsetValue(0, 0.1);
+    scaleOffset->setOffsetValue(3, 0.4);
+
+    OCIO::MatrixOpDataRcPtr matrix = scale->clone();
+    matrix->setArrayValue(1, 0.3);
+    matrix->setArrayValue(6, -0.2);
+    matrix->setArrayValue(12, 0.5);
+
+    OCIO::MatrixOpDataRcPtr matrixOffset = matrix->clone();
+    matrixOffset->setOffsetValue(1, 0.2);
+    matrixOffset->setOffsetValue(2, -0.3);
+
+    for (const auto & mat : { scale, scaleOffset, matrix, matrixOffset })
+    {
+        OCIO::ConstMatrixOpDataRcPtr m = mat;
+        OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+        OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+        std::vector<float> packed = rgba;
+        op->apply(packed.data(), packed.data(), numPixels);
+
+        // Split the packed image in four planes.
+        std::vector<std::vector<float>> in(4, std::vector<float>(numPixels));
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                in[c][idx] = rgba[4 * idx + c];
+            }
+        }
+
+        std::vector<std::vector<float>> out(4, std::vector<float>(numPixels, -1.f));
+
+        const float * inPlanes[4]{ in[0].data(), in[1].data(), in[2].data(), in[3].data() };
+        float * outPlanes[4]{ out[0].data(), out[1].data(), out[2].data(), out[3].data() };
+
+        // Different input and output planes.
+        op->applyPlanar(inPlanes, outPlanes, numPixels);
+
+        // In place processing.
+        float * inOutPlanes[4]{ in[0].data(), in[1].data(), in[2].data(), in[3].data() };
+        op->applyPlanar(inOutPlanes, inOutPlanes, numPixels);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                OCIO_CHECK_EQUAL(out[c][idx], packed[4 * idx + c]);
+                OCIO_CHECK_EQUAL(in[c][idx], packed[4 * idx + c]);
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the packed & planar functions of one instruction set against the expected values, and
+// check that the planar processing gives exactly the same results than the packed one.
+void ValidateMatrixFuncs(MatrixOpCPUApplyFunc * applyFunc,
+                         MatrixOpCPUApplyPlanarFunc * applyPlanarFunc,
+                         bool hasOffsets,
+                         unsigned line)
+{
+    OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+    OCIO_REQUIRE_ASSERT_FROM(applyPlanarFunc, line);
+
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr long numPixels = 37;
+
+    const float column1[4] = { 1.1f,  0.1f, -0.2f, 0.3f };
+    const float column2[4] = { 0.2f,  0.9f,  0.1f, 0.0f };
+    const float column3[4] = { 0.3f, -0.1f,  1.2f, 0.1f };
+    const float column4[4] = { 0.0f,  0.2f,  0.0f, 0.9f };
+    const float * columns[4] = { column1, column2, column3, column4 };
+    const float offset[4] = { 0.1f, -0.2f, 0.3f, 0.05f };
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.071f - 2.5f;
+    }
+
+    std::vector<float> packed(4 * numPixels, -1.f);
+    applyFunc(columns, offset, in.data(), packed.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            float expected = in[4 * idx + 0] * column1[c] + in[4 * idx + 1] * column2[c]
+                           + in[4 * idx + 2] * column3[c] + in[4 * idx + 3] * column4[c];
+            if (hasOffsets)
+            {
+                expected += offset[c];
+            }
+
+            OCIO_CHECK_CLOSE_FROM(packed[4 * idx + c], expected, 1e-5f, line);
+        }
+    }
+
+    std::vector<float> planes(4 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            planes[c * numPixels + idx] = in[4 * idx + c];
+        }
+    }
+
+    // In place processing.
+    float * inOutPlanes[4] = { &planes[0], &planes[numPixels],
+                               &planes[2 * numPixels], &planes[3 * numPixels] };
+    applyPlanarFunc(columns, offset, inOutPlanes, inOutPlanes, numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            OCIO_CHECK_EQUAL_FROM(planes[c * numPixels + idx], packed[4 * idx + c], line);
+        }
+    }
+}
+
+void ValidateScaleFuncs(ScaleOpCPUApplyFunc * applyFunc,
+                        ScaleOpCPUApplyPlanarFunc * applyPlanarFunc,
+                        bool hasOffsets,
+                        unsigned line)
+{
+    OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+    OCIO_REQUIRE_ASSERT_FROM(applyPlanarFunc, line);
+
+    constexpr long numPixels = 37;
+
+    const float scale[4]  = { 1.1f, 0.9f, 1.2f, 0.5f };
+    const float offset[4] = { 0.1f, -0.2f, 0.3f, 0.05f };
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.071f - 2.5f;
+    }
+
+    std::vector<float> packed(4 * numPixels, -1.f);
+    applyFunc(scale, offset, in.data(), packed.data(), numPixels);
+
+    std::vector<float> planes(4 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const float expected = in[4 * idx + c] * scale[c] + (hasOffsets ? offset[c] : 0.0f);
+            OCIO_CHECK_CLOSE_FROM(packed[4 * idx + c], expected, 1e-5f, line);
+
+            planes[c * numPixels + idx] = in[4 * idx + c];
+        }
+    }
+
+    float * inOutPlanes[4] = { &planes[0], &planes[numPixels],
+                               &planes[2 * numPixels], &planes[3 * numPixels] };
+    applyPlanarFunc(scale, offset, inOutPlanes, inOutPlanes, numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            OCIO_CHECK_EQUAL_FROM(planes[c * numPixels + idx], packed[4 * idx + c], line);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(MatrixOpCPU, avx2_renderers)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ValidateMatrixFuncs(OCIO::AVX2GetMatrixApplyFunc(true),
+                        OCIO::AVX2GetMatrixApplyPlanarFunc(true), true, __LINE__);
+    ValidateMatrixFuncs(OCIO::AVX2GetMatrixApplyFunc(false),
+                        OCIO::AVX2GetMatrixApplyPlanarFunc(false), false, __LINE__);
+
+    ValidateScaleFuncs(OCIO::AVX2GetScaleApplyFunc(true),
+                       OCIO::AVX2GetScaleApplyPlanarFunc(true), true, __LINE__);
+    ValidateScaleFuncs(OCIO::AVX2GetScaleApplyFunc(false),
+                       OCIO::AVX2GetScaleApplyPlanarFunc(false), false, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, avx512_renderers)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ValidateMatrixFuncs(OCIO::AVX512GetMatrixApplyFunc(true),
+                        OCIO::AVX512GetMatrixApplyPlanarFunc(true), true, __LINE__);
+    ValidateMatrixFuncs(OCIO::AVX512GetMatrixApplyFunc(false),
+                        OCIO::AVX512GetMatrixApplyPlanarFunc(false), false, __LINE__);
+
+    ValidateScaleFuncs(OCIO::AVX512GetScaleApplyFunc(true),
+                       OCIO::AVX512GetScaleApplyPlanarFunc(true), true, __LINE__);
+    ValidateScaleFuncs(OCIO::AVX512GetScaleApplyFunc(false),
+                       OCIO::AVX512GetScaleApplyPlanarFunc(false), false, __LINE__);
+#else
+    throw SkipException();
+#endif
+}
@@ -341,3 +341,209 @@ OCIO_ADD_TEST(RangeOpCPU, inverse)
     OCIO_CHECK_CLOSE(image[10], 1.500f, g_error);
     OCIO_CHECK_CLOSE(image[11], 0.000f, g_error);
 }
+
+OCIO_ADD_TEST(RangeOpCPU, planar_renderers)
+{
+    // The planar processing must give the same results than the packed one for all renderers.
+
+    constexpr long numPixels = 5;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float rgba[4 * numPixels] = { -0.50f, -0.25f, 0.50f, 0.0f,
+                                         0.75f,  1.00f, 1.25f, 1.0f,
+                                         1.25f,  1.50f, 1.75f, 0.5f,
+                                         qnan,   0.10f, 2.50f, qnan,
+                                        -3.00f,  qnan,  0.90f, 2.0f };
+
+    auto minOnly = std::make_shared<OCIO::RangeOpData>(0., OCIO::RangeOpData::EmptyValue(),
+                                                       0., OCIO::RangeOpData::EmptyValue());
+    auto maxOnly = std::make_shared<OCIO::RangeOpData>(OCIO::RangeOpData::EmptyValue(), 1.,
+                                                       OCIO::RangeOpData::EmptyValue(), 1.);
+    auto minMax = std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.);
+    auto scaleMinMax = std::make_shared<OCIO::RangeOpData>(0., 1., 0.5, 1.5);
+
+    for (const auto & range : { minOnly, maxOnly, minMax, scaleMinMax })
+    {
+        OCIO_CHECK_NO_THROW(range->validate());
+
+        OCIO::ConstRangeOpDataRcPtr r = range;
+        OCIO::ConstOpCPURcPtr op = OCIO::GetRangeRenderer(r);
+        OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+        float packed[4 * numPixels];
+        op->apply(rgba, packed, numPixels);
+
+        float planes[4][numPixels];
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                planes[c][idx] = rgba[4 * idx + c];
+            }
+        }
+
+        float out[4][numPixels];
+        const float * inPlanes[4]{ planes[0], planes[1], planes[2], planes[3] };
+        float * outPlanes[4]{ out[0], out[1], out[2], out[3] };
+        op->applyPlanar(inPlanes, outPlanes, numPixels);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                const float expected = packed[4 * idx + c];
+                if (std::isnan(expected))
+                {
+                    OCIO_CHECK_ASSERT(std::isnan(out[c][idx]));
+                }
+                else
+                {
+                    OCIO_CHECK_EQUAL(out[c][idx], expected);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Validate the packed & planar functions of one instruction set against the scalar computation,
+// and check that the planar processing gives exactly the same results than the packed one.
+void ValidateRangeFuncs(RangeOpCPUApplyFunc * applyFunc,
+                        RangeOpCPUApplyPlanarFunc * applyPlanarFunc,
+                        bool scales, bool clampLower, bool clampUpper,
+                        unsigned line)
+{
+    OCIO_REQUIRE_ASSERT_FROM(applyFunc, line);
+    OCIO_REQUIRE_ASSERT_FROM(applyPlanarFunc, line);
+
+    // Not a multiple of the number of pixels processed per iteration.
+    constexpr long numPixels = 37;
+
+    const float scale      = scales ? 0.8f  : 1.0f;
+    const float offset     = scales ? 0.15f : 0.0f;
+    const float lowerBound = 0.1f;
+    const float upperBound = 0.9f;
+
+    std::vector<float> in(4 * numPixels);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx] = float(idx) * 0.013f - 0.5f;
+    }
+    in[5]  = std::numeric_limits<float>::quiet_NaN();
+    in[7]  = std::numeric_limits<float>::quiet_NaN();
+    in[42] = std::numeric_limits<float>::infinity();
+
+    std::vector<float> packed(4 * numPixels, -1.f);
+    applyFunc(scale, offset, lowerBound, upperBound, in.data(), packed.data(), numPixels);
+
+    std::vector<float> planes(4 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const float v = in[4 * idx + c];
+            planes[c * numPixels + idx] = v;
+
+            if (c == 3)
+            {
+                // The alpha channel is never modified.
+                OCIO_CHECK_ASSERT_FROM(std::isnan(v) ? std::isnan(packed[4 * idx + c])
+                                                     : packed[4 * idx + c] == v, line);
+                continue;
+            }
+
+            float expected = v * scale + offset;
+            if (clampLower)
+            {
+                expected = std::max(lowerBound, expected);
+            }
+            if (clampUpper)
+            {
+                expected = std::min(upperBound, expected);
+            }
+
+            if (std::isinf(expected))
+            {
+                OCIO_CHECK_EQUAL_FROM(packed[4 * idx + c], expected, line);
+            }
+            else
+            {
+                OCIO_CHECK_CLOSE_FROM(packed[4 * idx + c], expected, g_error, line);
+            }
+        }
+    }
+
+    float * inOutPlanes[4] = { &planes[0], &planes[numPixels],
+                               &planes[2 * numPixels], &planes[3 * numPixels] };
+    applyPlanarFunc(scale, offset, lowerBound, upperBound, inOutPlanes, inOutPlanes, numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            OCIO_CHECK_EQUAL_FROM(planes[c * numPixels + idx], packed[4 * idx + c], line);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(RangeOpCPU, avx2_renderers)
+{
+#if OCIO_USE_AVX2
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    for (const auto & args : { std::make_tuple(true,  true,  true),
+                               std::make_tuple(false, true,  true),
+                               std::make_tuple(false, true,  false),
+                               std::make_tuple(false, false, true) })
+    {
+        const bool scales     = std::get<0>(args);
+        const bool clampLower = std::get<1>(args);
+        const bool clampUpper = std::get<2>(args);
+
+        ValidateRangeFuncs(OCIO::AVX2GetRangeApplyFunc(scales, clampLower, clampUpper),
+                           OCIO::AVX2GetRangeApplyPlanarFunc(scales, clampLower, clampUpper),
+                           scales, clampLower, clampUpper, __LINE__);
+    }
+
+    // A scaling range always has both bounds.
+    OCIO_CHECK_ASSERT(!OCIO::AVX2GetRangeApplyFunc(true, false, true));
+#else
+    throw SkipException();
+#endif
+}
+
+OCIO_ADD_TEST(RangeOpCPU, avx512_renderers)
+{
+#if OCIO_USE_AVX512
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    for (const auto & args : { std::make_tuple(true,  true,  true),
+                               std::make_tuple(false, true,  true),
+                               std::make_tuple(false, true,  false),
+                               std::make_tuple(false, false, true) })
+    {
+        const bool scales     = std::get<0>(args);
+        const bool clampLower = std::get<1>(args);
+        const bool clampUpper = std::get<2>(args);
+
+        ValidateRangeFuncs(OCIO::AVX512GetRangeApplyFunc(scales, clampLower, clampUpper),
+                           OCIO::AVX512GetRangeApplyPlanarFunc(scales, clampLower, clampUpper),
+                           scales, clampLower, clampUpper, __LINE__);
+    }
+
+    // A scaling range always has both bounds.
+    OCIO_CHECK_ASSERT(!OCIO::AVX512GetRangeApplyFunc(true, false, true));
+#else
+    throw SkipException();
+#endif
+}
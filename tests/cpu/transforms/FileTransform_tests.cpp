@@ -569,3 +569,93 @@ OCIO_ADD_TEST(FileTransform, cc_file_with_different_file_extension)
         OCIO_CHECK_NO_THROW(cfg->getProcessor(tr2));
     }
 }
+
+OCIO_ADD_TEST(FileTransform, prefetch)
+{
+    OCIO::ClearAllCaches();
+
+    const std::string lut1 = OCIO::GetTestFilesDir() + "/lut1d_1.spi1d";
+    const std::string lut2 = OCIO::GetTestFilesDir() + "/lut1d_2.spi1d";
+    const std::string lut3 = OCIO::GetTestFilesDir() + "/lut3d_1.spi3d";
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    for (const auto & lut : { lut1, lut2, lut1 })
+    {
+        OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+        file->setSrc(lut.c_str());
+        group->appendTransform(file);
+    }
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO_CHECK_NO_THROW(OCIO::PrefetchFileTransforms(*config, config->getCurrentContext(), group,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut1));
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut2));
+    OCIO_CHECK_EQUAL(OCIO::g_fileCache.getNumEntries(), 2);
+
+    // The files are not loaded again when building the processor.
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+    OCIO_REQUIRE_ASSERT(proc);
+    OCIO_CHECK_EQUAL(proc->getProcessorMetadata()->getNumFiles(), 2);
+    OCIO_CHECK_EQUAL(OCIO::g_fileCache.getNumEntries(), 2);
+
+    // Nothing is prefetched when only one file is not loaded yet.
+    const std::string lut4 = OCIO::GetTestFilesDir() + "/lut1d_3.spi1d";
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc(lut3.c_str());
+    group->appendTransform(file);
+
+    OCIO_CHECK_NO_THROW(OCIO::PrefetchFileTransforms(*config, config->getCurrentContext(), group,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_ASSERT(!OCIO::g_fileCache.exists(lut3));
+
+    // The missing files are skipped, and the error is reported when building the ops.
+    file = OCIO::FileTransform::Create();
+    file->setSrc("missing.spi1d");
+    group->appendTransform(file);
+
+    file = OCIO::FileTransform::Create();
+    file->setSrc(lut4.c_str());
+    group->appendTransform(file);
+
+    OCIO_CHECK_NO_THROW(OCIO::PrefetchFileTransforms(*config, config->getCurrentContext(), group,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut3));
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut4));
+
+    OCIO_CHECK_THROW_WHAT(config->getProcessor(group), OCIO::Exception, "missing.spi1d");
+
+    OCIO::ClearAllCaches();
+
+    // Only the files used by the config elements referenced by the transform are prefetched.
+    OCIO::ConfigRcPtr cfg = OCIO::Config::CreateRaw()->createEditableCopy();
+    cfg->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    auto addColorSpace = [&cfg](const char * name, const char * src)
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName(name);
+        OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+        file->setSrc(src);
+        cs->setTransform(file, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+        cfg->addColorSpace(cs);
+    };
+    addColorSpace("cs1", "lut1d_1.spi1d");
+    addColorSpace("cs2", "lut1d_2.spi1d");
+    addColorSpace("cs3", "lut3d_1.spi3d");
+
+    OCIO::ColorSpaceTransformRcPtr cst = OCIO::ColorSpaceTransform::Create();
+    cst->setSrc("cs1");
+    cst->setDst("cs2");
+
+    OCIO_CHECK_NO_THROW(OCIO::PrefetchFileTransforms(*cfg, cfg->getCurrentContext(), cst,
+                                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut1));
+    OCIO_CHECK_ASSERT(OCIO::g_fileCache.exists(lut2));
+    OCIO_CHECK_ASSERT(!OCIO::g_fileCache.exists(lut3));
+
+    OCIO::ClearAllCaches();
+}
@@ -1,6 +1,7 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright Contributors to the OpenColorIO Project.
 
+import json
 import logging
 import unittest
 
@@ -364,6 +365,101 @@ class CPUProcessorTest(unittest.TestCase):
                 delta=self.FLOAT_DELTA
             )
 
+    def test_apply_parallel(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # Wrap buffers in ImageDesc
+        arr = self.float_rgb_3d.copy()
+        image = OCIO.PackedImageDesc(arr, 7, 3, 3)
+        dst_arr = np.zeros_like(self.float_rgb_3d)
+        dst_image = OCIO.PackedImageDesc(dst_arr, 7, 3, 3)
+
+        # Same results as the single-threaded processing
+        self.default_cpu_proc_fwd.applyParallel(image, dst_image, numThreads=2)
+        self.default_cpu_proc_fwd.applyParallel(image)
+
+        for i in range(arr.size):
+            self.assertEqual(arr.flat[i], dst_arr.flat[i])
+            self.assertAlmostEqual(
+                arr.flat[i], 
+                self.float_rgb_3d.flat[i] * 0.5,
+                delta=self.FLOAT_DELTA
+            )
+
+    def test_statistics(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        cpu_proc = self.default_cpu_proc_fwd
+        self.assertFalse(cpu_proc.isStatisticsEnabled())
+
+        cpu_proc.setStatisticsEnabled(True)
+        try:
+            arr = self.float_rgb_3d.copy()
+            image = OCIO.PackedImageDesc(arr, 7, 3, 3)
+            cpu_proc.apply(image)
+
+            stats = json.loads(cpu_proc.getStatisticsAsJSON())
+            self.assertGreater(len(stats), 0)
+            self.assertEqual(len(stats), cpu_proc.getNumStatistics())
+            for idx, stat in enumerate(stats):
+                self.assertEqual(stat['pixels'], 21)
+                self.assertEqual(stat['name'], cpu_proc.getStatisticsName(idx))
+                self.assertEqual(cpu_proc.getStatisticsNumPixels(idx), 21)
+
+            cpu_proc.resetStatistics()
+            stats = json.loads(cpu_proc.getStatisticsAsJSON())
+            for stat in stats:
+                self.assertEqual(stat['pixels'], 0)
+        finally:
+            cpu_proc.setStatisticsEnabled(False)
+
+    def test_compact_lut_max_error(self):
+        self.assertEqual(self.default_cpu_proc_fwd.getCompactLutMaxError(), 0.0)
+
+        lut = OCIO.Lut3DTransform(gridSize=5)
+        lut.setValue(1, 2, 3, 0.1234567, 0.7654321, 0.3333333)
+        proc = self.config.getProcessor(lut)
+
+        # The flag is not part of OPTIMIZATION_ALL.
+        cpu_proc = proc.getOptimizedCPUProcessor(OCIO.OPTIMIZATION_ALL)
+        self.assertEqual(cpu_proc.getCompactLutMaxError(), 0.0)
+
+        cpu_proc = proc.getOptimizedCPUProcessor(OCIO.OptimizationFlags(
+            OCIO.OPTIMIZATION_DEFAULT | OCIO.OPTIMIZATION_LUT_COMPACT_STORAGE
+        ))
+        self.assertGreater(cpu_proc.getCompactLutMaxError(), 0.0)
+        self.assertLess(cpu_proc.getCompactLutMaxError(), 1e-5)
+
+    def test_apply_chunk_size(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        self.assertEqual(OCIO.GetCPUProcessorChunkSize(), 0)
+
+        with self.assertRaises(OCIO.Exception):
+            OCIO.SetCPUProcessorChunkSize(-1)
+
+        # Lines of 7 pixels processed by chunks of 2 pixels
+        OCIO.SetCPUProcessorChunkSize(2)
+        try:
+            arr = self.float_rgb_3d.copy()
+            image = OCIO.PackedImageDesc(arr, 7, 3, 3)
+            self.default_cpu_proc_fwd.apply(image)
+        finally:
+            OCIO.SetCPUProcessorChunkSize(0)
+
+        for i in range(arr.size):
+            self.assertAlmostEqual(
+                arr.flat[i],
+                self.float_rgb_3d.flat[i] * 0.5,
+                delta=self.FLOAT_DELTA
+            )
+
     def test_apply_rgb_list(self):
         # Forward transform returns modified values
         fwd_result = self.default_cpu_proc_fwd.applyRGB(self.float_rgb_list)
@@ -1216,6 +1216,40 @@ colorspaces:
             "studio-config-latest.ocio"
         )
 
+    def test_warm_up_processors(self):
+        config = OCIO.Config.CreateRaw()
+        context = config.getCurrentContext()
+
+        progress = []
+        def callback(numDone, numTotal):
+            progress.append((numDone, numTotal))
+            return True
+
+        self.assertEqual(config.warmUpProcessors(context, "raw", callback), 1)
+        self.assertEqual(progress, [(1, 1)])
+
+        desc = OCIO.DisplayViewProcessorDesc()
+        desc.srcColorSpace = "raw"
+        desc.display = "sRGB"
+        desc.view = "Raw"
+        self.assertEqual(desc.looks, "")
+
+        unknown = OCIO.DisplayViewProcessorDesc()
+        unknown.srcColorSpace = "raw"
+        unknown.display = "sRGB"
+        unknown.view = "unknown"
+
+        self.assertEqual(config.warmUpProcessors(context, [desc, unknown]), 1)
+
+        # The callback cancels the warm up.
+        def cancel(numDone, numTotal):
+            progress.append((numDone, numTotal))
+            return False
+
+        progress = []
+        config.warmUpProcessors(context, [desc, desc, desc], cancel)
+        self.assertEqual(len(progress), 1)
+
     def test_inactive_colorspaces(self):
       config = OCIO.Config.CreateFromBuiltinConfig("studio-config-v1.0.0_aces-v1.3_ocio-v2.1")
       config.validate()
@@ -17,6 +17,9 @@ class ConstantsTest(unittest.TestCase):
         self.assertEqual(OCIO.OCIO_INACTIVE_COLORSPACES_ENVVAR, 'OCIO_INACTIVE_COLORSPACES')
         self.assertEqual(OCIO.OCIO_OPTIMIZATION_FLAGS_ENVVAR, 'OCIO_OPTIMIZATION_FLAGS')
         self.assertEqual(OCIO.OCIO_USER_CATEGORIES_ENVVAR, 'OCIO_USER_CATEGORIES')
+        self.assertEqual(OCIO.OCIO_CPU_STATISTICS_ENVVAR, 'OCIO_CPU_STATISTICS')
+        self.assertEqual(OCIO.OCIO_PROCESSOR_CACHE_DIR_ENVVAR, 'OCIO_PROCESSOR_CACHE_DIR')
+        self.assertEqual(OCIO.OCIO_LAZY_CONFIG_LOADING_ENVVAR, 'OCIO_LAZY_CONFIG_LOADING')
 
         # Cache (env. variables).
         self.assertEqual(OCIO.OCIO_DISABLE_ALL_CACHES, 'OCIO_DISABLE_ALL_CACHES')
@@ -383,6 +383,11 @@ class FileRulesTest(unittest.TestCase):
         self.assertEqual(csName, 'default')
         self.assertEqual(ruleIndex, 3)
 
+        csNames, ruleIndices = cfg.getColorSpacesFromFilepaths(
+            filePaths=['test.png', 'pic.exr', 'pic.txt'])
+        self.assertEqual(csNames, ['cs2', 'cs3', 'default'])
+        self.assertEqual(ruleIndices, [1, 2, 3])
+
         rules.removeRule(0)
         rules.removeRule(0)
         rules.removeRule(0)